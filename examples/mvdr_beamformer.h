@@ -52,12 +52,10 @@ public:
   {
     // Create data objects and views
     vView = new tensor_t<complex, 2>({num_el, num_beams});
-    vhView = new tensor_t<complex, 2>({num_beams, num_el});
     cbfView = new tensor_t<complex, 2>({num_beams, data_len});
     inVecView = new tensor_t<complex, 2>({num_el, data_len});
 
     ivsView = new tensor_t<complex, 2>({num_el, snap_len});
-    ivshView = new tensor_t<complex, 2>({snap_len, num_el});
     covMatView = new tensor_t<complex, 2>({num_el, num_el});
     invCovMatView = new tensor_t<complex, 2>({num_el, num_el});
     abfBView = new tensor_t<complex, 2>({num_el, num_beams});
@@ -65,8 +63,11 @@ public:
     abfAInvView = new tensor_t<complex, 2>({num_beams, num_beams});
     abfWeightsView = new tensor_t<complex, 2>({num_el, num_beams});
 
-    cbf_mm = new matxMatMulHandle_t(*cbfView, *vhView, *inVecView);
-    cov_mat_mm = new matxMatMulHandle_t(*covMatView, *ivsView, *ivshView);
+    // Hermitian transposes are read in place through the conjugate flags
+    cbf_mm = new matxMatMulHandle_t(*cbfView, vView->Permute({1, 0}),
+                                    *inVecView, true, false);
+    cov_mat_mm = new matxMatMulHandle_t(*covMatView, *ivsView,
+                                        ivsView->Permute({1, 0}), false, true);
   }
 
   /**
@@ -76,11 +77,9 @@ public:
   {
     covMatView->PrefetchDevice(stream);
     vView->PrefetchDevice(stream);
-    vhView->PrefetchDevice(stream);
     cbfView->PrefetchDevice(stream);
     inVecView->PrefetchDevice(stream);
     ivsView->PrefetchDevice(stream);
-    ivshView->PrefetchDevice(stream);
     invCovMatView->PrefetchDevice(stream);
     abfBView->PrefetchDevice(stream);
     abfAView->PrefetchDevice(stream);
@@ -92,25 +91,21 @@ public:
    */
   void Run(cudaStream_t stream)
   {
-    (*vhView = hermitianT(*vView)).run(stream);
-
-    cbf_mm->Exec(*cbfView, *vhView, *inVecView, stream);
+    cbf_mm->Exec(*cbfView, vView->Permute({1, 0}), *inVecView, stream);
 
     copy(*ivsView, inVecView->Slice({0, 0}, {matxEnd, snap_len_}), stream);
 
-    (*ivshView = hermitianT(*ivsView)).run(stream);
-
-    cov_mat_mm->Exec(*covMatView, *ivsView, *ivshView, stream);
-
-    (*covMatView = (*covMatView * (1.0f / static_cast<float>(snap_len_))) +
-                   eye<complex>({num_el_, num_el_}) * load_coeff_)
-        .run(stream);
+    // Normalize by the snapshot count through alpha. The diagonal load is
+    // written into the covariance first and added by the GEMM's beta term
+    cov_mat_mm->Exec(*covMatView, *ivsView, ivsView->Permute({1, 0}),
+                     eye<complex>({num_el_, num_el_}) * load_coeff_, stream,
+                     1.0f / static_cast<float>(snap_len_));
     inv(*invCovMatView, *covMatView, stream);
 
     // Find A and B to solve xA=B. Matlab uses A/B to solve for x, which is the
     // same as x = BA^-1
     matmul(*abfBView, *invCovMatView, *vView, stream);
-    matmul(*abfAView, *vhView, *abfBView, stream);
+    matmul(*abfAView, hermitianT(*vView), *abfBView, stream);
 
     inv(*abfAInvView, *abfAView, stream);
     matmul(*abfWeightsView, *abfBView, *abfAInvView, stream);
@@ -130,11 +125,9 @@ private:
   cuda::std::complex<float> load_coeff_ = {0.1f, 0.f};
 
   tensor_t<complex, 2> *vView;
-  tensor_t<complex, 2> *vhView;
   tensor_t<complex, 2> *cbfView;
   tensor_t<complex, 2> *inVecView;
   tensor_t<complex, 2> *ivsView;
-  tensor_t<complex, 2> *ivshView;
   tensor_t<complex, 2> *covMatView;
   tensor_t<complex, 2> *invCovMatView;
   tensor_t<complex, 2> *abfWeightsView;
@@ -284,6 +284,117 @@ __global__ void Conv2D(OutType d_out, InType d_in, FilterType d_filter,
     }
   }
 }
+
+// Per-batch 1/sqrt(E1 * E2) scale used by normalized lag-limited correlation.
+// One block per batch.
+template <typename ScaleType, typename In1Type, typename In2Type>
+__global__ void CorrLagEnergy(ScaleType *scale, In1Type d_in1, In2Type d_in2)
+{
+  extern __shared__ float s_exch[];
+  ScaleType *s_red = reinterpret_cast<ScaleType *>(&s_exch[0]);
+  const index_t b = blockIdx.x;
+  const index_t n1 = d_in1.Size(d_in1.Rank() - 1);
+  const index_t n2 = d_in2.Size(d_in2.Rank() - 1);
+
+  ScaleType e1 = 0;
+  ScaleType e2 = 0;
+  for (index_t m = threadIdx.x; m < n1; m += blockDim.x) {
+    e1 += static_cast<ScaleType>(NormF<typename In1Type::scalar_type>::op(
+        batch_at(d_in1, b, m)));
+  }
+  for (index_t m = threadIdx.x; m < n2; m += blockDim.x) {
+    e2 += static_cast<ScaleType>(NormF<typename In2Type::scalar_type>::op(
+        batch_at(d_in2, b, m)));
+  }
+
+  s_red[threadIdx.x] = e1;
+  s_red[blockDim.x + threadIdx.x] = e2;
+  __syncthreads();
+  for (unsigned int s = blockDim.x / 2; s > 0; s >>= 1) {
+    if (threadIdx.x < s) {
+      s_red[threadIdx.x] += s_red[threadIdx.x + s];
+      s_red[blockDim.x + threadIdx.x] += s_red[blockDim.x + threadIdx.x + s];
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    const ScaleType e = s_red[0] * s_red[blockDim.x];
+    scale[b] = e > ScaleType(0) ? ScaleType(1) / sqrt(e) : ScaleType(0);
+  }
+}
+
+// Lag-limited direct correlation r[l] = sum_m in1[m + l] * conj(in2[m]) for
+// l in [-max_lag, max_lag]. blockIdx.x selects a tile of lags and blockIdx.y
+// the batch. The block stages a tile of in2 and the matching window of in1
+// in shared memory, and each thread owns one lag of the tile, so every
+// loaded sample is reused by all lags in the tile.
+template <typename OutType, typename In1Type, typename In2Type,
+          typename ScaleType>
+__global__ void CorrLag1D(OutType d_out, In1Type d_in1, In2Type d_in2,
+                          index_t max_lag, const ScaleType *scale)
+{
+  extern __shared__ float s_exch[];
+  using in1_t = typename In1Type::scalar_type;
+  using in2_t = typename In2Type::scalar_type;
+  using out_t = typename OutType::scalar_type;
+
+  const index_t b = blockIdx.y;
+  const index_t tile = blockDim.x;
+  const index_t n1 = d_in1.Size(d_in1.Rank() - 1);
+  const index_t n2 = d_in2.Size(d_in2.Rank() - 1);
+  const index_t lag0 = static_cast<index_t>(blockIdx.x) * tile - max_lag;
+  const index_t lag = lag0 + threadIdx.x;
+
+  // in2 tile followed by an in1 window of 2 * tile samples
+  in2_t *s_in2 = reinterpret_cast<in2_t *>(&s_exch[0]);
+  in1_t *s_in1 = matx::AlignAddr<in1_t>(
+      reinterpret_cast<uint8_t *>(s_in2 + tile));
+
+  out_t val = 0;
+  for (index_t m0 = 0; m0 < n2; m0 += tile) {
+    const index_t m = m0 + threadIdx.x;
+    s_in2[threadIdx.x] =
+        m < n2 ? ConjF<in2_t>::op(batch_at(d_in2, b, m)) : in2_t(0);
+    for (index_t t = threadIdx.x; t < 2 * tile; t += blockDim.x) {
+      const index_t idx = m0 + lag0 + t;
+      s_in1[t] = (idx >= 0 && idx < n1) ? batch_at(d_in1, b, idx) : in1_t(0);
+    }
+    __syncthreads();
+
+    for (index_t k = 0; k < tile; k++) {
+      val += s_in1[threadIdx.x + k] * s_in2[k];
+    }
+    __syncthreads();
+  }
+
+  if (lag <= max_lag) {
+    if (scale != nullptr) {
+      val = val * scale[b];
+    }
+    batch_at(d_out, b, lag + max_lag) = val;
+  }
+}
+
+// Gathers lags [-max_lag, max_lag] out of a circular correlation of length
+// nfft, applying the optional normalization on the way out
+template <typename OutType, typename InType, typename ScaleType>
+__global__ void CorrLagGather(OutType d_out, InType d_full, index_t max_lag,
+                              const ScaleType *scale)
+{
+  const index_t b = blockIdx.y;
+  const index_t j = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const index_t nfft = d_full.Size(d_full.Rank() - 1);
+
+  if (j <= 2 * max_lag) {
+    const index_t lag = j - max_lag;
+    auto val = batch_at(d_full, b, lag < 0 ? lag + nfft : lag);
+    if (scale != nullptr) {
+      val = val * scale[b];
+    }
+    batch_at(d_out, b, j) = val;
+  }
+}
 #endif
 
 }; // namespace matx
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx_type_utils.h"
+#include <cuda.h>
+#include <stdint.h>
+
+namespace matx {
+
+#ifdef __CUDACC__
+/**
+ * Subtract the column means from each batch of observations. One thread owns
+ * one column of one batch, so neighbouring threads read neighbouring columns
+ * and both passes over the rows are coalesced.
+ */
+template <typename DevsType, typename InType>
+__global__ void CovCenter(DevsType d_devs, InType d_in, index_t batches)
+{
+  using compute_t = promote_matx_half_t<typename InType::scalar_type>;
+  constexpr int RANK = InType::Rank();
+  const index_t rows = d_in.Size(RANK - 2);
+  const index_t cols = d_in.Size(RANK - 1);
+  const index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx >= batches * cols) {
+    return;
+  }
+
+  const index_t b = idx / cols;
+  const index_t x = idx % cols;
+  compute_t mu = 0;
+  for (index_t y = 0; y < rows; y++) {
+    mu += static_cast<compute_t>(batch_at2(d_in, b, y, x));
+  }
+  mu /= static_cast<value_type_t<compute_t>>(rows);
+
+  for (index_t y = 0; y < rows; y++) {
+    batch_at2(d_devs, b, y, x) =
+        static_cast<compute_t>(batch_at2(d_in, b, y, x)) - mu;
+  }
+}
+
+/**
+ * Fill the strictly lower triangle of each batch from the upper triangle,
+ * conjugating for complex types
+ */
+template <typename OutType>
+__global__ void CovMirrorUpper(OutType d_c, index_t batches)
+{
+  using compute_t = promote_matx_half_t<typename OutType::scalar_type>;
+  constexpr int RANK = OutType::Rank();
+  const index_t n = d_c.Size(RANK - 1);
+  const index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx >= batches * n * n) {
+    return;
+  }
+
+  const index_t b = idx / (n * n);
+  const index_t i = (idx / n) % n;
+  const index_t j = idx % n;
+  if (i <= j) {
+    return;
+  }
+
+  const compute_t v = static_cast<compute_t>(batch_at2(d_c, b, j, i));
+  if constexpr (is_complex_v<compute_t>) {
+    batch_at2(d_c, b, i, j) = compute_t(v.real(), -v.imag());
+  }
+  else {
+    batch_at2(d_c, b, i, j) = v;
+  }
+}
+#endif
+
+}; // namespace matx
@@ -0,0 +1,379 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx_type_utils.h"
+#include <cuda.h>
+#include <stdint.h>
+
+namespace matx {
+
+/**
+ * Cheap pivoting magnitude: |x| for real types and |re| + |im| for complex
+ */
+template <typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ auto matxSmallMag(const T &v)
+{
+  if constexpr (is_complex_v<T>) {
+    const auto r = v.real();
+    const auto i = v.imag();
+    return (r < 0 ? -r : r) + (i < 0 ? -i : i);
+  }
+  else {
+    return v < 0 ? -v : v;
+  }
+}
+
+/**
+ * c = a * b for W interleaved matrices. The lane index is innermost so the
+ * host compiler vectorizes across batches; device code uses W = 1 with one
+ * matrix per thread.
+ */
+template <index_t M, index_t K, index_t N, index_t W, typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void
+matxSmallMatMulLanes(T (&c)[M][N][W], const T (&a)[M][K][W],
+                     const T (&b)[K][N][W])
+{
+  for (index_t i = 0; i < M; i++) {
+    for (index_t j = 0; j < N; j++) {
+      for (index_t w = 0; w < W; w++) {
+        c[i][j][w] = 0;
+      }
+      for (index_t p = 0; p < K; p++) {
+        for (index_t w = 0; w < W; w++) {
+          c[i][j][w] += a[i][p][w] * b[p][j][w];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Gauss-Jordan inverse with per-lane partial pivoting. a is destroyed and x
+ * receives the inverse. Returns false if any lane hit a zero pivot; those
+ * lanes hold non-finite values.
+ */
+template <index_t N, index_t W, typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ bool
+matxSmallInvLanes(T (&x)[N][N][W], T (&a)[N][N][W])
+{
+  bool ok = true;
+  for (index_t i = 0; i < N; i++) {
+    for (index_t j = 0; j < N; j++) {
+      for (index_t w = 0; w < W; w++) {
+        x[i][j][w] = i == j ? T(1) : T(0);
+      }
+    }
+  }
+
+  for (index_t k = 0; k < N; k++) {
+    for (index_t w = 0; w < W; w++) {
+      index_t p = k;
+      auto best = matxSmallMag(a[k][k][w]);
+      for (index_t i = k + 1; i < N; i++) {
+        const auto m = matxSmallMag(a[i][k][w]);
+        if (m > best) {
+          best = m;
+          p = i;
+        }
+      }
+      ok = ok && best != decltype(best)(0);
+
+      if (p != k) {
+        for (index_t j = 0; j < N; j++) {
+          const T ta = a[k][j][w];
+          a[k][j][w] = a[p][j][w];
+          a[p][j][w] = ta;
+          const T tx = x[k][j][w];
+          x[k][j][w] = x[p][j][w];
+          x[p][j][w] = tx;
+        }
+      }
+    }
+
+    T scale[W];
+    for (index_t w = 0; w < W; w++) {
+      scale[w] = T(1) / a[k][k][w];
+    }
+    for (index_t j = 0; j < N; j++) {
+      for (index_t w = 0; w < W; w++) {
+        a[k][j][w] *= scale[w];
+        x[k][j][w] *= scale[w];
+      }
+    }
+
+    for (index_t i = 0; i < N; i++) {
+      if (i == k) {
+        continue;
+      }
+
+      T f[W];
+      for (index_t w = 0; w < W; w++) {
+        f[w] = a[i][k][w];
+      }
+      for (index_t j = 0; j < N; j++) {
+        for (index_t w = 0; w < W; w++) {
+          a[i][j][w] -= f[w] * a[k][j][w];
+          x[i][j][w] -= f[w] * x[k][j][w];
+        }
+      }
+    }
+  }
+  return ok;
+}
+
+/**
+ * Closed-form inverse for N <= 4, x = adj(a) / det(a). There is no pivoting
+ * and no branching, so the lanes vectorize fully. The 4 x 4 case expands the
+ * determinant in 2 x 2 minors of the top and bottom row pairs. Returns false
+ * if any lane has a zero determinant; those lanes hold non-finite values.
+ */
+template <index_t N, index_t W, typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ bool
+matxSmallAdjInvLanes(T (&x)[N][N][W], const T (&a)[N][N][W])
+{
+  static_assert(N >= 1 && N <= 4, "Adjugate inverse supports N <= 4");
+  bool ok = true;
+  for (index_t w = 0; w < W; w++) {
+    if constexpr (N == 1) {
+      ok = ok & (a[0][0][w] != T(0));
+      x[0][0][w] = T(1) / a[0][0][w];
+    }
+    else if constexpr (N == 2) {
+      const T det = a[0][0][w] * a[1][1][w] - a[0][1][w] * a[1][0][w];
+      ok = ok & (det != T(0));
+      const T r = T(1) / det;
+      x[0][0][w] = a[1][1][w] * r;
+      x[0][1][w] = -a[0][1][w] * r;
+      x[1][0][w] = -a[1][0][w] * r;
+      x[1][1][w] = a[0][0][w] * r;
+    }
+    else if constexpr (N == 3) {
+      const T c0 = a[1][1][w] * a[2][2][w] - a[1][2][w] * a[2][1][w];
+      const T c1 = a[1][2][w] * a[2][0][w] - a[1][0][w] * a[2][2][w];
+      const T c2 = a[1][0][w] * a[2][1][w] - a[1][1][w] * a[2][0][w];
+      const T det = a[0][0][w] * c0 + a[0][1][w] * c1 + a[0][2][w] * c2;
+      ok = ok & (det != T(0));
+      const T r = T(1) / det;
+      x[0][0][w] = c0 * r;
+      x[1][0][w] = c1 * r;
+      x[2][0][w] = c2 * r;
+      x[0][1][w] = (a[0][2][w] * a[2][1][w] - a[0][1][w] * a[2][2][w]) * r;
+      x[1][1][w] = (a[0][0][w] * a[2][2][w] - a[0][2][w] * a[2][0][w]) * r;
+      x[2][1][w] = (a[0][1][w] * a[2][0][w] - a[0][0][w] * a[2][1][w]) * r;
+      x[0][2][w] = (a[0][1][w] * a[1][2][w] - a[0][2][w] * a[1][1][w]) * r;
+      x[1][2][w] = (a[0][2][w] * a[1][0][w] - a[0][0][w] * a[1][2][w]) * r;
+      x[2][2][w] = (a[0][0][w] * a[1][1][w] - a[0][1][w] * a[1][0][w]) * r;
+    }
+    else {
+      const auto m = [&](index_t i, index_t j) { return a[i][j][w]; };
+      const T s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+      const T s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+      const T s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+      const T s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+      const T s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+      const T s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+      const T c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+      const T c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+      const T c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+      const T c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+      const T c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+      const T c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+      const T det =
+          s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      ok = ok & (det != T(0));
+      const T r = T(1) / det;
+      x[0][0][w] = (m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3) * r;
+      x[0][1][w] = (-m(0, 1) * c5 + m(0, 2) * c4 - m(0, 3) * c3) * r;
+      x[0][2][w] = (m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3) * r;
+      x[0][3][w] = (-m(2, 1) * s5 + m(2, 2) * s4 - m(2, 3) * s3) * r;
+      x[1][0][w] = (-m(1, 0) * c5 + m(1, 2) * c2 - m(1, 3) * c1) * r;
+      x[1][1][w] = (m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1) * r;
+      x[1][2][w] = (-m(3, 0) * s5 + m(3, 2) * s2 - m(3, 3) * s1) * r;
+      x[1][3][w] = (m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1) * r;
+      x[2][0][w] = (m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0) * r;
+      x[2][1][w] = (-m(0, 0) * c4 + m(0, 1) * c2 - m(0, 3) * c0) * r;
+      x[2][2][w] = (m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0) * r;
+      x[2][3][w] = (-m(2, 0) * s4 + m(2, 1) * s2 - m(2, 3) * s0) * r;
+      x[3][0][w] = (-m(1, 0) * c3 + m(1, 1) * c1 - m(1, 2) * c0) * r;
+      x[3][1][w] = (m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0) * r;
+      x[3][2][w] = (-m(3, 0) * s3 + m(3, 1) * s1 - m(3, 2) * s0) * r;
+      x[3][3][w] = (m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0) * r;
+    }
+  }
+  return ok;
+}
+
+/**
+ * Determinant by LU with per-lane partial pivoting. a is destroyed.
+ */
+template <index_t N, index_t W, typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void
+matxSmallDetLanes(T (&d)[W], T (&a)[N][N][W])
+{
+  for (index_t w = 0; w < W; w++) {
+    d[w] = T(1);
+  }
+
+  for (index_t k = 0; k < N; k++) {
+    for (index_t w = 0; w < W; w++) {
+      index_t p = k;
+      auto best = matxSmallMag(a[k][k][w]);
+      for (index_t i = k + 1; i < N; i++) {
+        const auto m = matxSmallMag(a[i][k][w]);
+        if (m > best) {
+          best = m;
+          p = i;
+        }
+      }
+
+      if (p != k) {
+        for (index_t j = k; j < N; j++) {
+          const T t = a[k][j][w];
+          a[k][j][w] = a[p][j][w];
+          a[p][j][w] = t;
+        }
+        d[w] = -d[w];
+      }
+      d[w] *= a[k][k][w];
+    }
+
+    for (index_t i = k + 1; i < N; i++) {
+      T f[W];
+      for (index_t w = 0; w < W; w++) {
+        f[w] = a[i][k][w] / a[k][k][w];
+      }
+      for (index_t j = k + 1; j < N; j++) {
+        for (index_t w = 0; w < W; w++) {
+          a[i][j][w] -= f[w] * a[k][j][w];
+        }
+      }
+    }
+  }
+}
+
+#ifdef __CUDACC__
+template <index_t M, index_t K, index_t N, typename CType, typename AType,
+          typename BType, typename ScaleType, typename EpiType>
+__global__ void SmallMatMul(CType d_c, AType d_a, BType d_b, index_t batches,
+                            ScaleType alpha, ScaleType beta, EpiType epi)
+{
+  using compute_t = promote_matx_half_t<typename CType::scalar_type>;
+  const index_t b = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (b >= batches) {
+    return;
+  }
+
+  compute_t a[M][K][1];
+  compute_t bm[K][N][1];
+  compute_t c[M][N][1];
+  for (index_t i = 0; i < M; i++) {
+    for (index_t j = 0; j < K; j++) {
+      a[i][j][0] = static_cast<compute_t>(batch_at2(d_a, b, i, j));
+    }
+  }
+  for (index_t i = 0; i < K; i++) {
+    for (index_t j = 0; j < N; j++) {
+      bm[i][j][0] = static_cast<compute_t>(batch_at2(d_b, b, i, j));
+    }
+  }
+
+  matxSmallMatMulLanes(c, a, bm);
+
+  for (index_t i = 0; i < M; i++) {
+    for (index_t j = 0; j < N; j++) {
+      compute_t v = c[i][j][0] * alpha;
+      if (beta != ScaleType(0)) {
+        v += static_cast<compute_t>(batch_at2(d_c, b, i, j)) * beta;
+      }
+      if constexpr (!std::is_same_v<EpiType, matxNoEpilogue_t>) {
+        v += static_cast<compute_t>(batch_get_value2(epi, d_c, b, i, j));
+      }
+      batch_at2(d_c, b, i, j) = v;
+    }
+  }
+}
+
+template <index_t N, typename OutType, typename InType>
+__global__ void SmallInv(OutType d_out, InType d_in, index_t batches,
+                         int *d_info)
+{
+  using compute_t = promote_matx_half_t<typename OutType::scalar_type>;
+  const index_t b = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (b >= batches) {
+    return;
+  }
+
+  compute_t a[N][N][1];
+  compute_t x[N][N][1];
+  for (index_t i = 0; i < N; i++) {
+    for (index_t j = 0; j < N; j++) {
+      a[i][j][0] = static_cast<compute_t>(batch_at2(d_in, b, i, j));
+    }
+  }
+
+  // Every failing thread writes the same value, so no atomic is needed
+  if (!matxSmallInvLanes(x, a)) {
+    *d_info = 1;
+  }
+
+  for (index_t i = 0; i < N; i++) {
+    for (index_t j = 0; j < N; j++) {
+      batch_at2(d_out, b, i, j) = x[i][j][0];
+    }
+  }
+}
+
+template <index_t N, typename OutType, typename InType>
+__global__ void SmallDet(OutType d_out, InType d_in, index_t batches)
+{
+  using compute_t = promote_matx_half_t<typename InType::scalar_type>;
+  const index_t b = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (b >= batches) {
+    return;
+  }
+
+  compute_t a[N][N][1];
+  compute_t d[1];
+  for (index_t i = 0; i < N; i++) {
+    for (index_t j = 0; j < N; j++) {
+      a[i][j][0] = static_cast<compute_t>(batch_at2(d_in, b, i, j));
+    }
+  }
+
+  matxSmallDetLanes(d, a);
+  batch_at0(d_out, b) = d[0];
+}
+#endif
+
+}; // namespace matx
@@ -35,11 +35,16 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "kernels/matx_conv_kernels.cuh"
+#include "matx_cache.h"
 #include "matx_dim.h"
 #include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_fft.h"
 #include "matx_tensor.h"
 
 namespace matx {
@@ -98,6 +103,148 @@ inline void matxDirectConv1DInternal(tensor_impl_t<T, RANK> o, InType i,
 #endif  
 }
 
+// Number of consecutive outputs each host thread computes per task
+constexpr index_t CONV_HOST_CHUNK = 4096;
+// Number of outputs kept in registers across a pass over the filter taps
+constexpr index_t CONV_HOST_REG_BLOCK = 8;
+
+/**
+ * Offset of the first output sample into the FULL convolution. The SAME
+ * offsets match the device 1D kernel.
+ */
+inline index_t matxConvModeOffset(matxConvCorrMode_t mode, index_t filter_len)
+{
+  if (mode == MATX_C_MODE_SAME) {
+    return (filter_len & 1) ? ((filter_len - 1) >> 1) : (filter_len >> 1);
+  }
+  else if (mode == MATX_C_MODE_VALID) {
+    return filter_len - 1;
+  }
+
+  return 0;
+}
+
+/**
+ * Accumulate out[j] += sum_r f[r] * x[j + r] for j in [0, out_len)
+ *
+ * x must hold out_len + filter_len - 1 contiguous samples. Outputs are
+ * register-blocked in groups of CONV_HOST_REG_BLOCK so each filter tap is
+ * loaded once per group, and the inner loop over the group is a fixed-length
+ * unit-stride loop the compiler can vectorize.
+ */
+template <typename AccType, typename XType, typename FType>
+inline void matxConvRowHost(AccType *out, const XType *x, const FType *f,
+                            index_t out_len, index_t filter_len)
+{
+  index_t j = 0;
+  for (; j + CONV_HOST_REG_BLOCK <= out_len; j += CONV_HOST_REG_BLOCK) {
+    AccType acc[CONV_HOST_REG_BLOCK];
+    for (index_t u = 0; u < CONV_HOST_REG_BLOCK; u++) {
+      acc[u] = out[j + u];
+    }
+
+    for (index_t r = 0; r < filter_len; r++) {
+      const FType fv = f[r];
+      const XType *xp = x + j + r;
+      for (index_t u = 0; u < CONV_HOST_REG_BLOCK; u++) {
+        acc[u] += fv * xp[u];
+      }
+    }
+
+    for (index_t u = 0; u < CONV_HOST_REG_BLOCK; u++) {
+      out[j + u] = acc[u];
+    }
+  }
+
+  for (; j < out_len; j++) {
+    AccType acc = out[j];
+    for (index_t r = 0; r < filter_len; r++) {
+      acc += f[r] * x[j + r];
+    }
+    out[j] = acc;
+  }
+}
+
+/**
+ * Host direct 1D convolution
+ *
+ * Every dimension but the last is a batch. Each task convolves one chunk of
+ * one batch: the input window it needs is copied to a zero-padded contiguous
+ * buffer so the inner loop has no bounds checks, then the register-blocked
+ * row kernel runs over it. Complex signals with real filters are split into
+ * real and imaginary planes so the inner loop is purely real.
+ */
+template <typename T, int RANK, typename InType, typename FilterType>
+inline void matxDirectConv1DHostInternal(tensor_impl_t<T, RANK> &o, InType &i,
+                                         FilterType &filter,
+                                         matxConvCorrMode_t mode,
+                                         const HostExecutor &exec)
+{
+  using in_t = promote_matx_half_t<typename InType::scalar_type>;
+  using filt_t = promote_matx_half_t<typename FilterType::scalar_type>;
+  constexpr bool split = is_complex_v<in_t> && !is_complex_v<filt_t>;
+  using x_t = std::conditional_t<split, value_type_t<in_t>, in_t>;
+  using acc_t = decltype(std::declval<x_t>() * std::declval<filt_t>());
+  constexpr index_t planes = split ? 2 : 1;
+
+  MATX_STATIC_ASSERT(RANK == InType::Rank(), matxInvalidDim);
+  MATX_STATIC_ASSERT(FilterType::Rank() == 1, matxInvalidDim);
+
+  const index_t sig_len = i.Size(RANK - 1);
+  const index_t filt_len = filter.Size(0);
+  const index_t out_len = o.Size(RANK - 1);
+  const index_t off = matxConvModeOffset(mode, filt_len);
+  const index_t batches = batch_count(i, 1);
+
+  // Reversed taps turn the convolution into a sliding dot product
+  std::vector<filt_t> fr(filt_len);
+  for (index_t r = 0; r < filt_len; r++) {
+    fr[r] = static_cast<filt_t>(filter(filt_len - 1 - r));
+  }
+
+  const index_t nchunks = (out_len + CONV_HOST_CHUNK - 1) / CONV_HOST_CHUNK;
+
+  exec.ParallelFor(batches * nchunks, [&](index_t item) {
+    const index_t b = item / nchunks;
+    const index_t n0 = (item - b * nchunks) * CONV_HOST_CHUNK;
+    const index_t cnt = std::min(CONV_HOST_CHUNK, out_len - n0);
+    const index_t win_start = off + n0 - (filt_len - 1);
+    const index_t win_len = cnt + filt_len - 1;
+
+    std::vector<x_t> xw(win_len * planes);
+    std::vector<acc_t> acc(cnt * planes, acc_t(0));
+
+    for (index_t t = 0; t < win_len; t++) {
+      const index_t m = win_start + t;
+      in_t v = (m >= 0 && m < sig_len)
+                   ? static_cast<in_t>(batch_at(i, b, m))
+                   : in_t(0);
+      if constexpr (split) {
+        xw[t] = v.real();
+        xw[win_len + t] = v.imag();
+      }
+      else {
+        xw[t] = v;
+      }
+    }
+
+    for (index_t p = 0; p < planes; p++) {
+      matxConvRowHost(acc.data() + p * cnt, xw.data() + p * win_len,
+                      fr.data(), cnt, filt_len);
+    }
+
+    for (index_t j = 0; j < cnt; j++) {
+      if constexpr (split) {
+        batch_at(o, b, n0 + j) =
+            static_cast<T>(cuda::std::complex<acc_t>(acc[j], acc[cnt + j]));
+      }
+      else {
+        batch_at(o, b, n0 + j) = static_cast<T>(acc[j]);
+      }
+    }
+  });
+}
+
 // Entry point that allows swappable inputs, and also optimizes shared memory by
 // passing in the shortest signal as the filter. Note the swap parameter does
 // not do anything for convolution, so we never swap unless it's a correlation
@@ -126,6 +273,49 @@ inline void conv1d(tensor_t<T, RANK> o, In1Type i1, In2Type i2,
   }
 }
 
+/**
+ * Host direct 1D convolution
+ *
+ * Same semantics as the stream version of conv1d, but runs on host threads.
+ * All modes are supported, and every dimension but the last is treated as a
+ * batch.
+ *
+ * @param o
+ *   Output tensor
+ * @param i1
+ *   First input operator
+ * @param i2
+ *   Second input operator
+ * @param mode
+ *   Convolution mode (FULL, SAME, or VALID)
+ * @param exec
+ *   Host executor
+ */
+template <typename T, int RANK, typename In1Type, typename In2Type>
+inline void conv1d(tensor_t<T, RANK> o, In1Type i1, In2Type i2,
+                   matxConvCorrMode_t mode, const HostExecutor &exec)
+{
+  tensor_impl_t<T,RANK> &o_base = o;
+  typename base_type<In1Type>::type &in1_base = i1;
+  typename base_type<In2Type>::type &in2_base = i2;
+
+  if constexpr (In1Type::Rank() < In2Type::Rank()) {
+    matxDirectConv1DHostInternal(o_base, in2_base, in1_base, mode, exec);
+  }
+  else if constexpr (In1Type::Rank() == In2Type::Rank()) {
+    MATX_STATIC_ASSERT(RANK == 1, matxInvalidDim);
+    if (i1.Size(0) < i2.Size(0)) {
+      matxDirectConv1DHostInternal(o_base, in2_base, in1_base, mode, exec);
+    }
+    else {
+      matxDirectConv1DHostInternal(o_base, in1_base, in2_base, mode, exec);
+    }
+  }
+  else {
+    matxDirectConv1DHostInternal(o_base, in1_base, in2_base, mode, exec);
+  }
+}
+
 template <typename T, int RANK, typename InType, typename FilterType>
 void matxDirectConv2DInternal(tensor_impl_t<T, RANK> &o, InType &i,
                               FilterType &filter, matxConvCorrMode_t mode,
@@ -171,6 +361,344 @@ void matxDirectConv2DInternal(tensor_impl_t<T, RANK> &o, InType &i,
 #endif  
 }
 
+/**
+ * Factor a dense 2D filter into a column and a row filter if it is rank 1
+ *
+ * Picks the largest-magnitude tap as a pivot, builds hcol from the pivot
+ * column and hrow from the pivot row, and accepts the factorization if every
+ * tap is reproduced to within a small multiple of machine precision. This is
+ * exact for any rank-1 filter and costs one pass over the taps.
+ *
+ * @param f
+ *   Row-major filter taps
+ * @param fh
+ *   Number of filter rows
+ * @param fw
+ *   Number of filter columns
+ * @param hcol
+ *   Column (vertical) filter output of length fh
+ * @param hrow
+ *   Row (horizontal) filter output of length fw
+ * @returns
+ *   True if the filter is separable, in which case f(y, x) = hcol[y] * hrow[x]
+ */
+template <typename FT>
+inline bool matxSeparateFilter2D(const FT *f, index_t fh, index_t fw,
+                                 std::vector<FT> &hcol, std::vector<FT> &hrow)
+{
+  using std::abs;
+  using cuda::std::abs;
+  using real_t = value_type_t<FT>;
+
+  index_t pr = 0;
+  index_t pc = 0;
+  real_t maxabs = 0;
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      const real_t a = static_cast<real_t>(abs(f[y * fw + x]));
+      if (a > maxabs) {
+        maxabs = a;
+        pr = y;
+        pc = x;
+      }
+    }
+  }
+
+  if (maxabs == real_t(0)) {
+    return false;
+  }
+
+  const FT piv = f[pr * fw + pc];
+  hcol.resize(fh);
+  hrow.resize(fw);
+  for (index_t y = 0; y < fh; y++) {
+    hcol[y] = f[y * fw + pc] / piv;
+  }
+  for (index_t x = 0; x < fw; x++) {
+    hrow[x] = f[pr * fw + x];
+  }
+
+  const real_t tol =
+      real_t(64) * std::numeric_limits<real_t>::epsilon() * maxabs;
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      if (static_cast<real_t>(abs(f[y * fw + x] - hcol[y] * hrow[x])) > tol) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Factor a 2D filter operator into column and row filters if it is rank 1
+ *
+ * The filter is read on the host, so a filter produced on the device must be
+ * synchronized first. The result can be passed to the separable conv2d
+ * overloads.
+ *
+ * @param hcol
+ *   Column (vertical) filter output. Size must match filter rows
+ * @param hrow
+ *   Row (horizontal) filter output. Size must match filter columns
+ * @param filter
+ *   Rank 2 filter
+ * @returns
+ *   True if the filter is separable and hcol/hrow were written
+ */
+template <typename FT, typename FilterType>
+inline bool matxSeparateFilter2D(tensor_t<FT, 1> &hcol, tensor_t<FT, 1> &hrow,
+                                 FilterType filter)
+{
+  MATX_STATIC_ASSERT(FilterType::Rank() == 2, matxInvalidDim);
+  const index_t fh = filter.Size(0);
+  const index_t fw = filter.Size(1);
+  MATX_ASSERT(hcol.Size(0) == fh && hrow.Size(0) == fw, matxInvalidSize);
+
+  std::vector<FT> f(fh * fw);
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      f[y * fw + x] = static_cast<FT>(filter(y, x));
+    }
+  }
+
+  std::vector<FT> c, r;
+  if (!matxSeparateFilter2D(f.data(), fh, fw, c, r)) {
+    return false;
+  }
+
+  for (index_t y = 0; y < fh; y++) {
+    hcol(y) = c[y];
+  }
+  for (index_t x = 0; x < fw; x++) {
+    hrow(x) = r[x];
+  }
+
+  return true;
+}
+
+/**
+ * Host separable 2D convolution
+ *
+ * Applies f(y, x) = hcol[y] * hrow[x] as a horizontal pass followed by a
+ * vertical pass, which is O(fh + fw) per output instead of O(fh * fw). Each
+ * task handles a block of output rows: the horizontal pass writes the rows
+ * the block needs into a small intermediate that stays in cache, and the
+ * vertical pass is a unit-stride multiply-add over those rows.
+ */
+template <typename T, int RANK, typename InType, typename FiltT>
+void matxSepConv2DHostCore(tensor_impl_t<T, RANK> &o, InType &i,
+                           const std::vector<FiltT> &hcol,
+                           const std::vector<FiltT> &hrow,
+                           matxConvCorrMode_t mode, const HostExecutor &exec)
+{
+  using in_t = promote_matx_half_t<typename InType::scalar_type>;
+  constexpr bool split = is_complex_v<in_t> && !is_complex_v<FiltT>;
+  using x_t = std::conditional_t<split, value_type_t<in_t>, in_t>;
+  using acc_t = decltype(std::declval<x_t>() * std::declval<FiltT>());
+  constexpr index_t planes = split ? 2 : 1;
+  constexpr index_t rows_per_task = 32;
+
+  const index_t ih = i.Size(RANK - 2);
+  const index_t iw = i.Size(RANK - 1);
+  const index_t fh = static_cast<index_t>(hcol.size());
+  const index_t fw = static_cast<index_t>(hrow.size());
+  const index_t oh = o.Size(RANK - 2);
+  const index_t ow = o.Size(RANK - 1);
+  const index_t offy = matxConvModeOffset(mode, fh);
+  const index_t offx = matxConvModeOffset(mode, fw);
+  const index_t batches = batch_count(i, 2);
+
+  const index_t nrb = (oh + rows_per_task - 1) / rows_per_task;
+  const index_t wpad = ow + fw - 1;
+  const index_t col0 = offx - (fw - 1);
+
+  exec.ParallelFor(batches * nrb, [&](index_t item) {
+    const index_t b = item / nrb;
+    const index_t ty0 = (item - b * nrb) * rows_per_task;
+    const index_t nrows = std::min(rows_per_task, oh - ty0);
+    const index_t in_rows = nrows + fh - 1;
+    const index_t row0 = ty0 + offy - (fh - 1);
+
+    std::vector<x_t> xw(wpad * planes);
+    std::vector<acc_t> inter(in_rows * ow * planes, acc_t(0));
+    std::vector<acc_t> acc(ow * planes);
+
+    // Horizontal pass over every input row this block touches. Rows outside
+    // the image stay zero.
+    for (index_t r = 0; r < in_rows; r++) {
+      const index_t iy = row0 + r;
+      if (iy < 0 || iy >= ih) {
+        continue;
+      }
+
+      std::fill(xw.begin(), xw.end(), x_t(0));
+      for (index_t t = 0; t < wpad; t++) {
+        const index_t ix = col0 + t;
+        if (ix < 0 || ix >= iw) {
+          continue;
+        }
+
+        in_t v = static_cast<in_t>(batch_at2(i, b, iy, ix));
+        if constexpr (split) {
+          xw[t] = v.real();
+          xw[wpad + t] = v.imag();
+        }
+        else {
+          xw[t] = v;
+        }
+      }
+
+      for (index_t p = 0; p < planes; p++) {
+        matxConvRowHost(inter.data() + (p * in_rows + r) * ow,
+                        xw.data() + p * wpad, hrow.data(), ow, fw);
+      }
+    }
+
+    // Vertical pass
+    for (index_t r = 0; r < nrows; r++) {
+      std::fill(acc.begin(), acc.end(), acc_t(0));
+      for (index_t p = 0; p < planes; p++) {
+        acc_t *dst = acc.data() + p * ow;
+        for (index_t y = 0; y < fh; y++) {
+          const FiltT fv = hcol[y];
+          const acc_t *src = inter.data() + (p * in_rows + r + y) * ow;
+          for (index_t tx = 0; tx < ow; tx++) {
+            dst[tx] += fv * src[tx];
+          }
+        }
+      }
+
+      for (index_t tx = 0; tx < ow; tx++) {
+        if constexpr (split) {
+          batch_at2(o, b, ty0 + r, tx) = static_cast<T>(
+              cuda::std::complex<acc_t>(acc[tx], acc[ow + tx]));
+        }
+        else {
+          batch_at2(o, b, ty0 + r, tx) = static_cast<T>(acc[tx]);
+        }
+      }
+    }
+  });
+}
+
+/**
+ * Host direct 2D convolution
+ *
+ * Filter indexing matches the device Conv2D kernel, so FULL outputs agree.
+ * SAME and VALID crop the FULL output at matxConvModeOffset in each
+ * dimension, the same way conv1d does. Each task produces a block of output
+ * rows for one batch. The input rows the block touches are
+ * copied once into a zero-padded buffer, and every (output row, filter row)
+ * pair is then one call to the register-blocked row kernel.
+ */
+template <typename T, int RANK, typename InType, typename FilterType>
+void matxDirectConv2DHostInternal(tensor_impl_t<T, RANK> &o, InType &i,
+                                  FilterType &filter, matxConvCorrMode_t mode,
+                                  const HostExecutor &exec)
+{
+  using in_t = promote_matx_half_t<typename InType::scalar_type>;
+  using filt_t = promote_matx_half_t<typename FilterType::scalar_type>;
+  constexpr bool split = is_complex_v<in_t> && !is_complex_v<filt_t>;
+  using x_t = std::conditional_t<split, value_type_t<in_t>, in_t>;
+  using acc_t = decltype(std::declval<x_t>() * std::declval<filt_t>());
+  constexpr index_t planes = split ? 2 : 1;
+  constexpr index_t rows_per_task = 8;
+
+  MATX_STATIC_ASSERT(RANK == InType::Rank(), matxInvalidDim);
+  MATX_STATIC_ASSERT(FilterType::Rank() == 2, matxInvalidDim);
+  MATX_STATIC_ASSERT(RANK >= 2, matxInvalidDim);
+
+  const index_t ih = i.Size(RANK - 2);
+  const index_t iw = i.Size(RANK - 1);
+  const index_t fh = filter.Size(0);
+  const index_t fw = filter.Size(1);
+  const index_t oh = o.Size(RANK - 2);
+  const index_t ow = o.Size(RANK - 1);
+  const index_t offy = matxConvModeOffset(mode, fh);
+  const index_t offx = matxConvModeOffset(mode, fw);
+  const index_t batches = batch_count(i, 2);
+
+  std::vector<filt_t> f(fh * fw);
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      f[y * fw + x] = static_cast<filt_t>(filter(y, x));
+    }
+  }
+
+  // Box, Gaussian and CFAR-style filters are rank 1. Once the filter is big
+  // enough for two 1D passes to beat one 2D pass, check for that and take the
+  // separable path instead.
+  if (fh * fw >= 2 * (fh + fw)) {
+    std::vector<filt_t> hcol, hrow;
+    if (matxSeparateFilter2D(f.data(), fh, fw, hcol, hrow)) {
+      matxSepConv2DHostCore(o, i, hcol, hrow, mode, exec);
+      return;
+    }
+  }
+
+  const index_t nrb = (oh + rows_per_task - 1) / rows_per_task;
+  const index_t wpad = ow + fw - 1;
+  const index_t col0 = offx - (fw - 1);
+
+  exec.ParallelFor(batches * nrb, [&](index_t item) {
+    const index_t b = item / nrb;
+    const index_t ty0 = (item - b * nrb) * rows_per_task;
+    const index_t nrows = std::min(rows_per_task, oh - ty0);
+    const index_t in_rows = nrows + fh - 1;
+    const index_t row0 = ty0 + offy - (fh - 1);
+    const index_t plane_len = in_rows * wpad;
+
+    std::vector<x_t> xw(plane_len * planes, x_t(0));
+    std::vector<acc_t> acc(ow * planes);
+
+    for (index_t r = 0; r < in_rows; r++) {
+      const index_t iy = row0 + r;
+      if (iy < 0 || iy >= ih) {
+        continue;
+      }
+
+      for (index_t t = 0; t < wpad; t++) {
+        const index_t ix = col0 + t;
+        if (ix < 0 || ix >= iw) {
+          continue;
+        }
+
+        in_t v = static_cast<in_t>(batch_at2(i, b, iy, ix));
+        if constexpr (split) {
+          xw[r * wpad + t] = v.real();
+          xw[plane_len + r * wpad + t] = v.imag();
+        }
+        else {
+          xw[r * wpad + t] = v;
+        }
+      }
+    }
+
+    for (index_t r = 0; r < nrows; r++) {
+      std::fill(acc.begin(), acc.end(), acc_t(0));
+      for (index_t p = 0; p < planes; p++) {
+        for (index_t y = 0; y < fh; y++) {
+          matxConvRowHost(acc.data() + p * ow,
+                          xw.data() + p * plane_len + (r + y) * wpad,
+                          f.data() + y * fw, ow, fw);
+        }
+      }
+
+      for (index_t tx = 0; tx < ow; tx++) {
+        if constexpr (split) {
+          batch_at2(o, b, ty0 + r, tx) = static_cast<T>(
+              cuda::std::complex<acc_t>(acc[tx], acc[ow + tx]));
+        }
+        else {
+          batch_at2(o, b, ty0 + r, tx) = static_cast<T>(acc[tx]);
+        }
+      }
+    }
+  });
+}
+
 // Entry point that allows swappable inputs, and also optimizes shared memory by
 // passing in the shortest signal as the filter
 template <typename T, int RANK, typename In1Type, typename In2Type>
@@ -198,4 +726,536 @@ inline void conv2d(tensor_t<T, RANK> o, In1Type i1, In2Type i2,
   }
 }
 
+
+/**
+ * Host direct 2D convolution
+ *
+ * Same filter indexing as the stream version of conv2d, but runs on host
+ * threads, and every dimension but the last two is treated as a batch. SAME
+ * and VALID keep the centered and fully overlapped parts of the FULL output
+ * using the conv1d offsets in each dimension. The device kernel does not
+ * apply these offsets yet, so the two only agree in FULL mode.
+ *
+ * @param o
+ *   Output tensor
+ * @param i1
+ *   First input operator
+ * @param i2
+ *   Second input operator
+ * @param mode
+ *   Convolution mode (FULL, SAME, or VALID)
+ * @param exec
+ *   Host executor
+ */
+template <typename T, int RANK, typename In1Type, typename In2Type>
+inline void conv2d(tensor_t<T, RANK> o, In1Type i1, In2Type i2,
+                   matxConvCorrMode_t mode, const HostExecutor &exec)
+{
+  tensor_impl_t<T,RANK> &o_base = o;
+  typename base_type<In1Type>::type &in1_base = i1;
+  typename base_type<In2Type>::type &in2_base = i2;
+
+  if constexpr (In1Type::Rank() < In2Type::Rank()) {
+    matxDirectConv2DHostInternal(o_base, in2_base, in1_base, mode, exec);
+  }
+  else if constexpr (In1Type::Rank() == In2Type::Rank()) {
+    MATX_STATIC_ASSERT(RANK == 2, matxInvalidDim);
+    if (i1.Size(0) * i1.Size(1) < i2.Size(0) * i2.Size(1)) {
+      matxDirectConv2DHostInternal(o_base, in2_base, in1_base, mode, exec);
+    }
+    else {
+      matxDirectConv2DHostInternal(o_base, in1_base, in2_base, mode, exec);
+    }
+  }
+  else {
+    matxDirectConv2DHostInternal(o_base, in1_base, in2_base, mode, exec);
+  }
+}
+
+/**
+ * Intermediate buffers for the device separable 2D convolution
+ *
+ * Holds the row pass output and the transposed column pass output so that
+ * repeated calls with the same shapes don't allocate.
+ */
+template <typename T, int RANK> class matxSepConv2DPlan_t {
+public:
+  matxSepConv2DPlan_t(const tensorShape_t<RANK> &rows_shape,
+                      const tensorShape_t<RANK> &cols_shape)
+      : rows_shape_(rows_shape), cols_shape_(cols_shape)
+  {
+    matxAlloc(reinterpret_cast<void **>(&rows_ptr_),
+              sizeof(T) * rows_shape_.TotalSize(), MATX_DEVICE_MEMORY);
+    matxAlloc(reinterpret_cast<void **>(&cols_ptr_),
+              sizeof(T) * cols_shape_.TotalSize(), MATX_DEVICE_MEMORY);
+  }
+
+  matxSepConv2DPlan_t(const matxSepConv2DPlan_t &) = delete;
+  matxSepConv2DPlan_t &operator=(const matxSepConv2DPlan_t &) = delete;
+
+  ~matxSepConv2DPlan_t()
+  {
+    matxFree(cols_ptr_);
+    matxFree(rows_ptr_);
+  }
+
+  tensor_t<T, RANK> Rows() const
+  {
+    return tensor_t<T, RANK>(rows_ptr_, rows_shape_);
+  }
+
+  tensor_t<T, RANK> Cols() const
+  {
+    return tensor_t<T, RANK>(cols_ptr_, cols_shape_);
+  }
+
+private:
+  tensorShape_t<RANK> rows_shape_;
+  tensorShape_t<RANK> cols_shape_;
+  T *rows_ptr_ = nullptr;
+  T *cols_ptr_ = nullptr;
+};
+
+/**
+ * Parameters needed to cache separable 2D convolution buffers
+ */
+struct SepConv2DParams_t {
+  index_t in_size[4] = {0};
+  index_t fh;
+  index_t fw;
+  index_t ow;
+  int rank;
+  MatXDataType_t dtype;
+  cudaStream_t stream;
+};
+
+struct SepConv2DParamsKeyHash {
+  std::size_t operator()(const SepConv2DParams_t &k) const noexcept
+  {
+    return std::hash<uint64_t>()(k.in_size[k.rank - 1]) +
+           std::hash<uint64_t>()(k.in_size[k.rank - 2]) +
+           std::hash<uint64_t>()(k.fh) + std::hash<uint64_t>()(k.fw) +
+           std::hash<uint64_t>()((uint64_t)k.stream);
+  }
+};
+
+struct SepConv2DParamsKeyEq {
+  bool operator()(const SepConv2DParams_t &l, const SepConv2DParams_t &t) const
+      noexcept
+  {
+    return std::equal(l.in_size, l.in_size + 4, t.in_size) && l.fh == t.fh &&
+           l.fw == t.fw && l.ow == t.ow && l.rank == t.rank &&
+           l.dtype == t.dtype && l.stream == t.stream;
+  }
+};
+
+static matxCache_t<SepConv2DParams_t, SepConv2DParamsKeyHash,
+                   SepConv2DParamsKeyEq>
+    sep_conv2d_cache;
+
+/**
+ * Separable 2D convolution
+ *
+ * Convolves with the rank-1 filter f(y, x) = hcol(y) * hrow(x) using a pass
+ * along rows followed by a pass along columns, each with the direct 1D
+ * kernel. The intermediate buffers are cached per shape and stream.
+ *
+ * In every mode the result matches the host conv2d with the equivalent dense
+ * filter, at O(fh + fw) work per output instead of O(fh * fw). SAME and VALID
+ * use the conv1d offsets in each dimension. The dense device conv2d ignores
+ * the mode, so it agrees with this overload only in FULL mode.
+ *
+ * @param o
+ *   Output tensor
+ * @param i
+ *   Input operator. Dimensions above 2 are batches
+ * @param hcol
+ *   Column (vertical) filter
+ * @param hrow
+ *   Row (horizontal) filter
+ * @param mode
+ *   Convolution mode (FULL, SAME, or VALID)
+ * @param stream
+ *   CUDA stream
+ */
+template <typename T, int RANK, typename InType, typename ColFilterType,
+          typename RowFilterType>
+inline void conv2d(tensor_t<T, RANK> o, InType i, ColFilterType hcol,
+                   RowFilterType hrow, matxConvCorrMode_t mode,
+                   cudaStream_t stream)
+{
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4 && RANK == InType::Rank(),
+                     matxInvalidDim);
+  MATX_STATIC_ASSERT(ColFilterType::Rank() == 1 && RowFilterType::Rank() == 1,
+                     matxInvalidDim);
+
+  const index_t ih = i.Size(RANK - 2);
+  const index_t iw = i.Size(RANK - 1);
+  const index_t fh = hcol.Size(0);
+  const index_t fw = hrow.Size(0);
+  const index_t oh = o.Size(RANK - 2);
+  const index_t ow = o.Size(RANK - 1);
+  const index_t offy = matxConvModeOffset(mode, fh);
+  const index_t offx = matxConvModeOffset(mode, fw);
+
+  uint32_t perm[RANK];
+  for (int d = 0; d < RANK; d++) {
+    perm[d] = d;
+  }
+  std::swap(perm[RANK - 1], perm[RANK - 2]);
+
+  SepConv2DParams_t params;
+  for (int d = 0; d < RANK; d++) {
+    params.in_size[d] = i.Size(d);
+  }
+  params.fh = fh;
+  params.fw = fw;
+  params.ow = ow;
+  params.rank = RANK;
+  params.dtype = TypeToInt<T>();
+  params.stream = stream;
+
+  matxSepConv2DPlan_t<T, RANK> *plan;
+  auto ret = sep_conv2d_cache.Lookup(params);
+  if (ret == std::nullopt) {
+    // Row pass output keeps full-length rows. The column pass output holds
+    // the kept columns transposed, so the kernel writes contiguously.
+    auto rows_shape = i.Shape();
+    rows_shape.SetSize(RANK - 1, iw + fw - 1);
+    auto cols_shape = rows_shape;
+    cols_shape.SetSize(RANK - 2, ow);
+    cols_shape.SetSize(RANK - 1, ih + fh - 1);
+    plan = new matxSepConv2DPlan_t<T, RANK>(rows_shape, cols_shape);
+    sep_conv2d_cache.Insert(params, static_cast<void *>(plan));
+  }
+  else {
+    plan = static_cast<matxSepConv2DPlan_t<T, RANK> *>(ret.value());
+  }
+
+  // The dense kernel correlates, so reversed taps make the FULL 1D
+  // convolutions line up with it
+  auto hrow_r = reverseX(hrow);
+  auto hcol_r = reverseX(hcol);
+
+  auto rows = plan->Rows();
+  tensor_impl_t<T, RANK> &rows_base = rows;
+  typename base_type<InType>::type &i_base = i;
+  matxDirectConv1DInternal(rows_base, i_base, hrow_r, MATX_C_MODE_FULL, stream);
+
+  // Column pass on the transposed view of the columns this mode keeps
+  index_t starts[RANK] = {0};
+  index_t ends[RANK];
+  for (int d = 0; d < RANK; d++) {
+    ends[d] = matxEnd;
+  }
+  starts[RANK - 1] = offx;
+  ends[RANK - 1] = offx + ow;
+  auto rows_t = rows.Slice(starts, ends).Permute(perm);
+
+  auto cols = plan->Cols();
+  tensor_impl_t<T, RANK> &cols_base = cols;
+  matxDirectConv1DInternal(cols_base, rows_t, hcol_r, MATX_C_MODE_FULL,
+                           stream);
+
+  starts[RANK - 1] = offy;
+  ends[RANK - 1] = offy + oh;
+  (o = cols.Slice(starts, ends).Permute(perm)).run(stream);
+}
+
+/**
+ * Host separable 2D convolution
+ *
+ * Host version of the separable conv2d overload.
+ *
+ * @param o
+ *   Output tensor
+ * @param i
+ *   Input operator. Dimensions above 2 are batches
+ * @param hcol
+ *   Column (vertical) filter
+ * @param hrow
+ *   Row (horizontal) filter
+ * @param mode
+ *   Convolution mode (FULL, SAME, or VALID)
+ * @param exec
+ *   Host executor
+ */
+template <typename T, int RANK, typename InType, typename ColFilterType,
+          typename RowFilterType>
+inline void conv2d(tensor_t<T, RANK> o, InType i, ColFilterType hcol,
+                   RowFilterType hrow, matxConvCorrMode_t mode,
+                   const HostExecutor &exec)
+{
+  using filt_t = promote_matx_half_t<typename ColFilterType::scalar_type>;
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK == InType::Rank(), matxInvalidDim);
+  MATX_STATIC_ASSERT(ColFilterType::Rank() == 1 && RowFilterType::Rank() == 1,
+                     matxInvalidDim);
+
+  std::vector<filt_t> c(hcol.Size(0));
+  std::vector<filt_t> r(hrow.Size(0));
+  for (index_t y = 0; y < hcol.Size(0); y++) {
+    c[y] = static_cast<filt_t>(hcol(y));
+  }
+  for (index_t x = 0; x < hrow.Size(0); x++) {
+    r[x] = static_cast<filt_t>(hrow(x));
+  }
+
+  tensor_impl_t<T, RANK> &o_base = o;
+  typename base_type<InType>::type &i_base = i;
+  matxSepConv2DHostCore(o_base, i_base, c, r, mode, exec);
+}
+
+/**
+ * Streaming overlap-save 1D convolution
+ *
+ * Convolves an unbounded signal that arrives in fixed-size blocks with a
+ * fixed filter. The last filter length - 1 samples of every block are kept
+ * internally and prepended to the next block, so each call to Exec emits
+ * exactly one block of output samples with no gaps or ramp-up between
+ * blocks. The output is identical to the first samples of a FULL convolution
+ * over the concatenation of all blocks seen since construction or the last
+ * Reset().
+ *
+ * Short filters are applied with the direct convolution kernel. Long filters
+ * are transformed once at construction, and each block is then processed with
+ * one forward and one inverse FFT of the smallest power of two that holds the
+ * block plus the filter overlap.
+ *
+ * Rank 2 inputs are treated as independent channels along the first dimension,
+ * each with its own overlap state.
+ *
+ * @tparam T
+ *   Data type of input and output blocks
+ * @tparam RANK
+ *   Rank of input and output blocks (1 or 2)
+ * @tparam FilterType
+ *   Data type of filter
+ */
+template <typename T, int RANK, typename FilterType>
+class matxStreamingConv1D_t {
+public:
+  using complex_type =
+      std::conditional_t<is_complex_v<T>, T,
+                         cuda::std::complex<value_promote_t<T>>>;
+
+  // Filters at or below this length use direct convolution
+  static constexpr index_t DIRECT_FILTER_THRESH = 64;
+
+  /**
+   * Construct a streaming convolution object
+   *
+   * @param filter
+   *   Filter taps. The filter is copied (or transformed) internally, so the
+   * tensor may be reused after construction
+   * @param block_len
+   *   Number of samples per channel in each input block
+   * @param channels
+   *   Number of channels. Must be 1 for rank 1 inputs
+   * @param stream
+   *   CUDA stream used for the one-time filter setup
+   */
+  matxStreamingConv1D_t(const tensor_t<FilterType, 1> &filter,
+                        index_t block_len, index_t channels = 1,
+                        cudaStream_t stream = 0)
+      : block_len_(block_len), filt_len_(filter.Size(0)), channels_(channels)
+  {
+    MATX_STATIC_ASSERT(RANK == 1 || RANK == 2, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_complex_v<FilterType> || is_complex_v<T>,
+                           matxInvalidType,
+                           "Complex filters require complex input and output");
+    MATX_STATIC_ASSERT_STR(!is_matx_type_v<T> && !is_matx_type_v<FilterType>,
+                           matxInvalidType,
+                           "Half precision streaming convolution not supported");
+    MATX_ASSERT(block_len_ > 0 && filt_len_ > 0, matxInvalidSize);
+    MATX_ASSERT(RANK == 2 || channels_ == 1, matxInvalidSize);
+
+    use_fft_ = filt_len_ > DIRECT_FILTER_THRESH;
+    seg_len_ = block_len_ + filt_len_ - 1;
+
+    if (use_fft_) {
+      nfft_ = 1;
+      while (nfft_ < seg_len_) {
+        nfft_ <<= 1;
+      }
+
+      // Zero-padding past the segment is never written, so it only needs to be
+      // cleared once here
+      for (int b = 0; b < 2; b++) {
+        work_[b] = std::make_unique<tensor_t<complex_type, RANK>>(
+            MakeShape(nfft_));
+        (*work_[b] = zeros<complex_type>(work_[b]->Shape())).run(stream);
+      }
+      freq_ = std::make_unique<tensor_t<complex_type, RANK>>(MakeShape(nfft_));
+
+      tensor_t<complex_type, 1> filt_time({nfft_});
+      filt_freq_ = std::make_unique<tensor_t<complex_type, 1>>(
+          tensorShape_t<1>({nfft_}));
+      (filt_time = zeros<complex_type>({nfft_})).run(stream);
+      auto filt_taps = filt_time.Slice({0}, {filt_len_});
+      (filt_taps = filter).run(stream);
+      fft(*filt_freq_, filt_time, stream);
+      cudaStreamSynchronize(stream);
+    }
+    else {
+      for (int b = 0; b < 2; b++) {
+        seg_[b] = std::make_unique<tensor_t<T, RANK>>(MakeShape(seg_len_));
+        (*seg_[b] = zeros<T>(seg_[b]->Shape())).run(stream);
+      }
+      full_ = std::make_unique<tensor_t<T, RANK>>(
+          MakeShape(seg_len_ + filt_len_ - 1));
+      filt_ = std::make_unique<tensor_t<FilterType, 1>>(
+          tensorShape_t<1>({filt_len_}));
+      (*filt_ = filter).run(stream);
+    }
+  }
+
+  // The overlap state is unique to each stream, so the object can be moved
+  // but not copied
+  matxStreamingConv1D_t(const matxStreamingConv1D_t &) = delete;
+  matxStreamingConv1D_t &operator=(const matxStreamingConv1D_t &) = delete;
+  matxStreamingConv1D_t(matxStreamingConv1D_t &&) = default;
+  matxStreamingConv1D_t &operator=(matxStreamingConv1D_t &&) = default;
+
+  /**
+   * Filter the next block of the stream
+   *
+   * Consumes one block of input samples and writes the matching block of
+   * output samples. The overlap needed by the next call is retained
+   * internally.
+   *
+   * @param o
+   *   Output block. Same shape as the input block
+   * @param i
+   *   Input block of block_len samples per channel
+   * @param stream
+   *   CUDA stream
+   */
+  void Exec(tensor_t<T, RANK> &o, const tensor_t<T, RANK> &i,
+            cudaStream_t stream)
+  {
+    MATX_ASSERT(i.Size(RANK - 1) == block_len_, matxInvalidSize);
+    MATX_ASSERT(o.Size(RANK - 1) == block_len_, matxInvalidSize);
+    if constexpr (RANK == 2) {
+      MATX_ASSERT(i.Size(0) == channels_ && o.Size(0) == channels_,
+                  matxInvalidSize);
+    }
+
+    const int prev = cur_;
+    cur_ ^= 1;
+
+    if (use_fft_) {
+      auto &work = *work_[cur_];
+      CarryOverlap(work, *work_[prev], stream);
+      auto blk = SliceLast(work, filt_len_ - 1, seg_len_);
+      (blk = i).run(stream);
+
+      fft(*freq_, work, stream);
+      (*freq_ = *freq_ * *filt_freq_).run(stream);
+      ifft(*freq_, *freq_, stream);
+
+      // Everything before the overlap is corrupted by circular wrap-around
+      auto valid = SliceLast(*freq_, filt_len_ - 1, seg_len_);
+      if constexpr (is_complex_v<T>) {
+        (o = valid).run(stream);
+      }
+      else {
+        (o = valid.RealView()).run(stream);
+      }
+    }
+    else {
+      auto &seg = *seg_[cur_];
+      CarryOverlap(seg, *seg_[prev], stream);
+      auto blk = SliceLast(seg, filt_len_ - 1, seg_len_);
+      (blk = i).run(stream);
+
+      conv1d(*full_, seg, *filt_, MATX_C_MODE_FULL, stream);
+      auto valid = SliceLast(*full_, filt_len_ - 1, seg_len_);
+      (o = valid).run(stream);
+    }
+  }
+
+  /**
+   * Clear the overlap state so the next block starts a new stream
+   *
+   * @param stream
+   *   CUDA stream
+   */
+  void Reset(cudaStream_t stream = 0)
+  {
+    for (int b = 0; b < 2; b++) {
+      if (use_fft_) {
+        (*work_[b] = zeros<complex_type>(work_[b]->Shape())).run(stream);
+      }
+      else {
+        (*seg_[b] = zeros<T>(seg_[b]->Shape())).run(stream);
+      }
+    }
+  }
+
+  index_t BlockLen() const noexcept { return block_len_; }
+  index_t FilterLen() const noexcept { return filt_len_; }
+  index_t FFTSize() const noexcept { return use_fft_ ? nfft_ : 0; }
+  bool UsesFFT() const noexcept { return use_fft_; }
+
+private:
+  tensorShape_t<RANK> MakeShape(index_t len) const
+  {
+    if constexpr (RANK == 1) {
+      return tensorShape_t<1>({len});
+    }
+    else {
+      return tensorShape_t<2>({channels_, len});
+    }
+  }
+
+  template <typename U>
+  static auto SliceLast(tensor_t<U, RANK> &t, index_t start, index_t end)
+  {
+    if constexpr (RANK == 1) {
+      return t.Slice({start}, {end});
+    }
+    else {
+      return t.Slice({0, start}, {matxEnd, end});
+    }
+  }
+
+  // Copy the trailing filter_len - 1 samples of the previous segment to the
+  // start of the current one. Ping-ponging between two segments keeps the
+  // source and destination disjoint even when the block is shorter than the
+  // filter.
+  template <typename U>
+  void CarryOverlap(tensor_t<U, RANK> &dst, tensor_t<U, RANK> &src,
+                    cudaStream_t stream)
+  {
+    if (filt_len_ > 1) {
+      auto head = SliceLast(dst, 0, filt_len_ - 1);
+      auto tail = SliceLast(src, block_len_, seg_len_);
+      (head = tail).run(stream);
+    }
+  }
+
+  index_t block_len_;
+  index_t filt_len_;
+  index_t channels_;
+  index_t seg_len_;
+  index_t nfft_ = 0;
+  bool use_fft_;
+  int cur_ = 0;
+
+  std::unique_ptr<tensor_t<complex_type, RANK>> work_[2];
+  std::unique_ptr<tensor_t<complex_type, RANK>> freq_;
+  std::unique_ptr<tensor_t<complex_type, 1>> filt_freq_;
+  std::unique_ptr<tensor_t<T, RANK>> seg_[2];
+  std::unique_ptr<tensor_t<T, RANK>> full_;
+  std::unique_ptr<tensor_t<FilterType, 1>> filt_;
+};
+
+/**
+ * Streaming convolution object
+ *
+ * Convenience alias for matxStreamingConv1D_t
+ */
+template <typename T, int RANK, typename FilterType>
+using StreamingConv1D = matxStreamingConv1D_t<T, RANK, FilterType>;
+
 } // end namespace matx
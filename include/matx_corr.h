@@ -36,10 +36,13 @@
 #include <cstdint>
 #include <cstdio>
 #include <type_traits>
+#include <vector>
 
 #include "matx_conv.h"
 #include "matx_dim.h"
 #include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_fft.h"
 #include "matx_tensor.h"
 
 namespace matx {
@@ -61,4 +64,286 @@ void corr(tensor_t<T, RANK> &o, In1Type &i1, In2Type &i2,
   conv1d(o, i1, i2r, mode, stream);
 }
 
+typedef enum {
+  MATX_C_NORM_NONE,  // Raw correlation
+  MATX_C_NORM_COEFF, // Divide by sqrt(sum|i1|^2 * sum|i2|^2)
+} matxCorrNorm_t;
+
+// Lags handled by one block of the direct lag-limited kernel
+constexpr index_t CORR_LAG_TILE = 128;
+// Lags handled by one host task of the direct lag-limited path
+constexpr index_t CORR_LAG_HOST_CHUNK = 256;
+
+/**
+ * Pick the lag-limited correlation method for MATX_C_METHOD_AUTO
+ *
+ * Direct costs about (2 * max_lag + 1) MACs per sample, while the FFT path
+ * costs three transforms of nfft points, so direct wins until the lag count
+ * reaches a small multiple of log2(nfft).
+ */
+inline matxConvCorrMethod_t matxCorrLagMethod(index_t max_lag, index_t nfft)
+{
+  index_t log2n = 0;
+  while ((static_cast<index_t>(1) << log2n) < nfft) {
+    log2n++;
+  }
+
+  return (2 * max_lag + 1) <= 8 * log2n ? MATX_C_METHOD_DIRECT
+                                        : MATX_C_METHOD_FFT;
+}
+
+/**
+ * Lag-limited cross-correlation
+ *
+ * Computes only lags -max_lag through max_lag of the cross-correlation
+ * r[l] = sum_m i1[m + l] * conj(i2[m]), so o(..., max_lag) is the zero-lag
+ * term and matches element i2.Size() - 1 of the FULL correlation. The direct
+ * method stages tiles of both signals in shared memory and reuses them across
+ * a tile of lags. The FFT method only needs a transform long enough to keep
+ * the requested lags free of wrap-around, which is max(N1, N2) + max_lag
+ * instead of N1 + N2 - 1. Dimensions above 1 are batches and must match
+ * between all three tensors.
+ *
+ * @param o
+ *   Output tensor. Last dimension must be 2 * max_lag + 1
+ * @param i1
+ *   First input
+ * @param i2
+ *   Second input, conjugated in the product
+ * @param max_lag
+ *   Largest absolute lag to compute
+ * @param method
+ *   MATX_C_METHOD_DIRECT, MATX_C_METHOD_FFT, or MATX_C_METHOD_AUTO
+ * @param norm
+ *   MATX_C_NORM_COEFF to normalize by the signal energies
+ * @param stream
+ *   CUDA stream
+ */
+template <typename T, int RANK, typename In1Type, typename In2Type>
+void corr(tensor_t<T, RANK> &o, const tensor_t<In1Type, RANK> &i1,
+          const tensor_t<In2Type, RANK> &i2, index_t max_lag,
+          matxConvCorrMethod_t method, matxCorrNorm_t norm,
+          cudaStream_t stream)
+{
+  using scale_t = value_type_t<T>;
+  using complex_type =
+      std::conditional_t<is_complex_v<T>, T, cuda::std::complex<T>>;
+  MATX_STATIC_ASSERT(!is_matx_half_v<T> && !is_complex_half_v<T>,
+                     matxInvalidType);
+  MATX_ASSERT(max_lag >= 0, matxInvalidParameter);
+  MATX_ASSERT(o.Size(RANK - 1) == 2 * max_lag + 1, matxInvalidSize);
+  for (int d = 0; d < RANK - 1; d++) {
+    MATX_ASSERT(i1.Size(d) == o.Size(d) && i2.Size(d) == o.Size(d),
+                matxInvalidSize);
+  }
+
+  const index_t n1 = i1.Size(RANK - 1);
+  const index_t n2 = i2.Size(RANK - 1);
+  const index_t batches = batch_count(o, 1);
+  index_t nfft = 1;
+  while (nfft < std::max(n1, n2) + max_lag) {
+    nfft <<= 1;
+  }
+
+  if (method == MATX_C_METHOD_AUTO) {
+    method = matxCorrLagMethod(max_lag, nfft);
+  }
+
+  [[maybe_unused]] tensor_impl_t<T, RANK> &o_base = o;
+  [[maybe_unused]] const tensor_impl_t<In1Type, RANK> &i1_base = i1;
+  [[maybe_unused]] const tensor_impl_t<In2Type, RANK> &i2_base = i2;
+
+  scale_t *scale = nullptr;
+  if (norm == MATX_C_NORM_COEFF) {
+    matxAlloc(reinterpret_cast<void **>(&scale), sizeof(scale_t) * batches,
+              MATX_ASYNC_DEVICE_MEMORY, stream);
+#ifdef __CUDACC__
+    constexpr unsigned int threads = 256;
+    CorrLagEnergy<<<static_cast<unsigned int>(batches), threads,
+                    2 * threads * sizeof(scale_t), stream>>>(scale, i1_base,
+                                                             i2_base);
+#endif
+  }
+
+  if (method == MATX_C_METHOD_DIRECT) {
+#ifdef __CUDACC__
+    const size_t shm = CORR_LAG_TILE * sizeof(In2Type) + alignof(In1Type) +
+                       2 * CORR_LAG_TILE * sizeof(In1Type);
+    dim3 gsize(static_cast<unsigned int>((2 * max_lag + CORR_LAG_TILE) /
+                                         CORR_LAG_TILE),
+               static_cast<unsigned int>(batches));
+    CorrLag1D<<<gsize, CORR_LAG_TILE, shm, stream>>>(o_base, i1_base, i2_base,
+                                                     max_lag, scale);
+#endif
+  }
+  else {
+    MATX_ASSERT_STR(method == MATX_C_METHOD_FFT, matxInvalidParameter,
+                    "Lag-limited correlation supports DIRECT, FFT, or AUTO");
+
+    auto in_shape = o.Shape();
+    in_shape.SetSize(RANK - 1, nfft);
+    complex_type *a_ptr;
+    complex_type *b_ptr;
+    matxAlloc(reinterpret_cast<void **>(&a_ptr),
+              sizeof(complex_type) * in_shape.TotalSize(),
+              MATX_ASYNC_DEVICE_MEMORY, stream);
+    matxAlloc(reinterpret_cast<void **>(&b_ptr),
+              sizeof(complex_type) * in_shape.TotalSize(),
+              MATX_ASYNC_DEVICE_MEMORY, stream);
+    tensor_t<complex_type, RANK> a(a_ptr, in_shape);
+    tensor_t<complex_type, RANK> b(b_ptr, in_shape);
+
+    index_t starts[RANK] = {0};
+    index_t ends[RANK];
+    for (int d = 0; d < RANK; d++) {
+      ends[d] = matxEnd;
+    }
+
+    (a = zeros<complex_type>(in_shape)).run(stream);
+    (b = zeros<complex_type>(in_shape)).run(stream);
+    ends[RANK - 1] = n1;
+    auto a_sig = a.Slice(starts, ends);
+    (a_sig = i1).run(stream);
+    ends[RANK - 1] = n2;
+    auto b_sig = b.Slice(starts, ends);
+    (b_sig = i2).run(stream);
+
+    fft(a, a, stream);
+    fft(b, b, stream);
+    (a = a * conj(b)).run(stream);
+    ifft(a, a, stream);
+
+#ifdef __CUDACC__
+    constexpr unsigned int threads = 256;
+    dim3 gsize(static_cast<unsigned int>((2 * max_lag + threads) / threads),
+               static_cast<unsigned int>(batches));
+    if constexpr (is_complex_v<T>) {
+      tensor_impl_t<complex_type, RANK> &a_base = a;
+      CorrLagGather<<<gsize, threads, 0, stream>>>(o_base, a_base, max_lag,
+                                                   scale);
+    }
+    else {
+      auto ar = a.RealView();
+      tensor_impl_t<T, RANK> &ar_base = ar;
+      CorrLagGather<<<gsize, threads, 0, stream>>>(o_base, ar_base, max_lag,
+                                                   scale);
+    }
+#endif
+
+    matxFree(b_ptr);
+    matxFree(a_ptr);
+  }
+
+  if (scale != nullptr) {
+    matxFree(scale);
+  }
+}
+
+/**
+ * Host lag-limited cross-correlation
+ *
+ * Host version of the lag-limited corr. Always uses the direct method: each
+ * task zero-pads one row of i1 by max_lag on both sides and runs the blocked
+ * host convolution row kernel against conj(i2) for a chunk of lags.
+ *
+ * @param o
+ *   Output tensor. Last dimension must be 2 * max_lag + 1
+ * @param i1
+ *   First input
+ * @param i2
+ *   Second input, conjugated in the product
+ * @param max_lag
+ *   Largest absolute lag to compute
+ * @param norm
+ *   MATX_C_NORM_COEFF to normalize by the signal energies
+ * @param exec
+ *   Host executor
+ */
+template <typename T, int RANK, typename In1Type, typename In2Type>
+void corr(tensor_t<T, RANK> &o, const tensor_t<In1Type, RANK> &i1,
+          const tensor_t<In2Type, RANK> &i2, index_t max_lag,
+          matxCorrNorm_t norm, const HostExecutor &exec)
+{
+  using x1_t = promote_matx_half_t<In1Type>;
+  using x2_t = promote_matx_half_t<In2Type>;
+  using acc_t = decltype(std::declval<x1_t>() * std::declval<x2_t>());
+  using scale_t = value_type_t<acc_t>;
+  MATX_ASSERT(max_lag >= 0, matxInvalidParameter);
+  MATX_ASSERT(o.Size(RANK - 1) == 2 * max_lag + 1, matxInvalidSize);
+  for (int d = 0; d < RANK - 1; d++) {
+    MATX_ASSERT(i1.Size(d) == o.Size(d) && i2.Size(d) == o.Size(d),
+                matxInvalidSize);
+  }
+
+  const index_t n1 = i1.Size(RANK - 1);
+  const index_t n2 = i2.Size(RANK - 1);
+  const index_t nlags = 2 * max_lag + 1;
+  const index_t batches = batch_count(o, 1);
+  const index_t nchunks = (nlags + CORR_LAG_HOST_CHUNK - 1) / CORR_LAG_HOST_CHUNK;
+
+  // Energies depend only on the row, so they are summed once per row rather
+  // than once per chunk of lags
+  std::vector<scale_t> scales(batches, scale_t(1));
+  if (norm == MATX_C_NORM_COEFF) {
+    exec.ParallelFor(batches, [&](index_t b) {
+      scale_t e1 = 0;
+      scale_t e2 = 0;
+      for (index_t m = 0; m < n1; m++) {
+        const x1_t v = static_cast<x1_t>(batch_at(i1, b, m));
+        if constexpr (is_complex_v<x1_t>) {
+          e1 += static_cast<scale_t>(v.real() * v.real() + v.imag() * v.imag());
+        }
+        else {
+          e1 += static_cast<scale_t>(v * v);
+        }
+      }
+      for (index_t m = 0; m < n2; m++) {
+        const x2_t v = static_cast<x2_t>(batch_at(i2, b, m));
+        if constexpr (is_complex_v<x2_t>) {
+          e2 += static_cast<scale_t>(v.real() * v.real() + v.imag() * v.imag());
+        }
+        else {
+          e2 += static_cast<scale_t>(v * v);
+        }
+      }
+      const scale_t e = e1 * e2;
+      scales[b] = e > scale_t(0) ? scale_t(1) / std::sqrt(e) : scale_t(0);
+    });
+  }
+
+  exec.ParallelFor(batches * nchunks, [&](index_t item) {
+    const index_t b = item / nchunks;
+    const index_t j0 = (item - b * nchunks) * CORR_LAG_HOST_CHUNK;
+    const index_t len = std::min(CORR_LAG_HOST_CHUNK, nlags - j0);
+
+    // Only the part of i1 this chunk of lags touches is padded and copied
+    std::vector<x1_t> xp(len + n2 - 1, x1_t(0));
+    for (index_t t = 0; t < len + n2 - 1; t++) {
+      const index_t idx = j0 + t - max_lag;
+      if (idx >= 0 && idx < n1) {
+        xp[t] = static_cast<x1_t>(batch_at(i1, b, idx));
+      }
+    }
+
+    std::vector<x2_t> f(n2);
+    for (index_t m = 0; m < n2; m++) {
+      const x2_t v = static_cast<x2_t>(batch_at(i2, b, m));
+      if constexpr (is_complex_v<x2_t>) {
+        f[m] = conj(v);
+      }
+      else {
+        f[m] = v;
+      }
+    }
+
+    std::vector<acc_t> acc(len, acc_t(0));
+    matxConvRowHost(acc.data(), xp.data(), f.data(), len, n2);
+
+    const scale_t scale = scales[b];
+    for (index_t j = 0; j < len; j++) {
+      batch_at(o, b, j0 + j) = static_cast<T>(acc[j] * scale);
+    }
+  });
+}
+
 } // end namespace matx
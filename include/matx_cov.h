@@ -33,13 +33,16 @@
 
 #pragma once
 
+#include "kernels/matx_cov_kernels.cuh"
 #include "matx_dim.h"
 #include "matx_error.h"
 #include "matx_matmul.h"
 #include "matx_tensor.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <numeric>
+#include <vector>
 
 namespace matx {
 
@@ -80,39 +83,31 @@ public:
   matxCovHandle_t(tensor_t<T1, RANK> c, tensor_t<T1, RANK> a)
   {
 #endif
-    static_assert(RANK >= 2);
+    static_assert(RANK >= 2 && RANK <= 4);
     MATX_ASSERT(c.Size(RANK - 1) == c.Size(RANK - 2), matxInvalidSize);
     MATX_ASSERT(a.Size(RANK - 1) == c.Size(RANK - 1), matxInvalidSize);
+    MATX_ASSERT(c.Stride(RANK - 1) == 1, matxInvalidParameter);
 
     // Ensure batch dimensions are equal
-    for (int i = 2; i < RANK - 2; i++) {
+    for (int i = 0; i < RANK - 2; i++) {
       MATX_ASSERT(a.Size(i) == c.Size(i), matxInvalidSize);
     }
 
     // This must come before the things below to properly set class parameters
     params_ = GetCovParams(c, a);
 
-    onesM = new tensor_t<T1, 2>({a.Size(RANK - 2), a.Size(RANK - 2)});
-    means = new tensor_t<T1, RANK>(a.Shape());
     devs = new tensor_t<T1, RANK>(a.Shape());
 
-    // Transposed view of deviations
-    tensorShape_t<RANK> tmp;
-    for (int i = 0; i < RANK; i++) {
-      tmp.SetSize(i, a.Size(RANK - i - 1));
+    if constexpr (is_matx_half_v<T1> || is_complex_half_v<T1>) {
+      // cuBLAS has no half precision SYRK/HERK, so the product goes through
+      // cuBLASLt with the deviations read transposed in place
+      covMM = new matxMatMulHandle_t<T1, T1, T1, RANK, PROVIDER_TYPE_CUBLASLT>(
+          c, devs->PermuteMatrix(), *devs, is_complex_v<T1>, false);
+    }
+    else {
+      ret = cublasCreate(&handle);
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
     }
-
-    devsT = new tensor_t<T1, RANK>(tmp);
-
-    onesMM = new matxMatMulHandle_t<T1, T1, T1, RANK, PROVIDER_TYPE_CUBLASLT>(
-        *means, *onesM, a);
-    covMM = new matxMatMulHandle_t<T1, T1, T1, RANK, PROVIDER_TYPE_CUBLASLT>(
-        c, *devsT, *devs);
-
-    // Populate our ones matrix
-    exec(set(*onesM,
-             ones(tensorShape_t<2>({a.Size(RANK - 2), a.Size(RANK - 2)}))),
-         0);
   }
 
   static CovParams_t GetCovParams([[maybe_unused]] tensor_t<T1, RANK> &c,
@@ -134,11 +129,13 @@ public:
    */
   ~matxCovHandle_t()
   {
-    delete onesM;
-    delete means;
     delete devs;
-    delete onesMM;
-    delete covMM;
+    if constexpr (is_matx_half_v<T1> || is_complex_half_v<T1>) {
+      delete covMM;
+    }
+    else {
+      cublasDestroy(handle);
+    }
   }
 
 /**
@@ -149,6 +146,10 @@ public:
  * matrix where the diagonals are the variances, and off-diagonals are
  * covariances.
  *
+ * The column means are removed in a single pass, and the product of the
+ * deviations with themselves is done with SYRK/HERK so only the upper
+ * triangle is computed before being mirrored into the lower triangle.
+ *
  * Passing a tensor of rank > 2 acts as batching dimensions
  *
  *
@@ -170,38 +171,81 @@ public:
                    cudaStream_t stream)
   {
 #endif
-    // Calculate a matrix of means
-    onesMM->Exec(*means, *onesM, a, stream,
-                 1.0f / static_cast<float>(a.Size(RANK - 2)));
+    [[maybe_unused]] const index_t batches = batch_count(a, 2);
+    [[maybe_unused]] const index_t m = a.Size(RANK - 2);
+    [[maybe_unused]] const index_t n = a.Size(RANK - 1);
+    [[maybe_unused]] const float scale = 1.0f / static_cast<float>(m - 1);
+    [[maybe_unused]] tensor_impl_t<T1, RANK> &c_base = c;
+    [[maybe_unused]] tensor_impl_t<T1, RANK> &d_base = *devs;
+    [[maybe_unused]] const tensor_impl_t<T1, RANK> &a_base = a;
 
+#ifdef __CUDACC__
     // Subtract the means from the observations to get the deviations
-    exec(set(*devs, a - *means), stream);
-
-    if constexpr (is_complex_v<T1>) {
-      // This step is not really necessary since BLAS can do it for us, but
-      // until we have a way to detect a Hermitian property on a matrix, we need
-      // to have this in a temporary variable. Note that we use the Python
-      // convention of E[XX'] instead of MATLAB's E[X'X]. Both are "correct",
-      // but we need to match python output
-      exec(set(*devsT, hermitianT(*devs)), stream);
+    unsigned int blocks =
+        static_cast<unsigned int>((batches * n + COV_BLOCK - 1) / COV_BLOCK);
+    CovCenter<<<blocks, COV_BLOCK, 0, stream>>>(d_base, a_base, batches);
+#endif
+
+    if constexpr (is_matx_half_v<T1> || is_complex_half_v<T1>) {
+      // Note that we use the Python convention of E[XX'] instead of MATLAB's
+      // E[X'X]. Both are "correct", but we need to match python output
+      covMM->Exec(c, devs->PermuteMatrix(), *devs, stream, scale);
     }
     else {
-      transpose(*devsT, *devs, stream);
-    }
+      // A row-major M x N batch of deviations is a column-major N x M matrix,
+      // so a non-transposed SYRK/HERK gives devs^H * devs. Its column-major
+      // lower triangle is the row-major upper triangle of C.
+      ret = cublasSetStream(handle, stream);
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+      for (index_t b = 0; b < batches; b++) {
+        Syrk(&batch_at2(c, b, 0, 0), static_cast<int>(c.Stride(RANK - 2)),
+             &batch_at2(*devs, b, 0, 0),
+             static_cast<int>(devs->Stride(RANK - 2)), static_cast<int>(n),
+             static_cast<int>(m), scale);
+      }
 
-    // Multiply by itself and scale by N-1 for the final covariance
-    covMM->Exec(c, *devsT, *devs, stream,
-                1.0f / static_cast<float>(a.Size(RANK - 2) - 1));
-      }    
+#ifdef __CUDACC__
+      blocks = static_cast<unsigned int>((batches * n * n + COV_BLOCK - 1) /
+                                         COV_BLOCK);
+      CovMirrorUpper<<<blocks, COV_BLOCK, 0, stream>>>(c_base, batches);
+#endif
+    }
+  }
 
   private:
+    void Syrk(T1 *c, int ldc, T1 *a, int lda, int n, int k, float scale)
+    {
+      const value_type_t<T1> alpha = static_cast<value_type_t<T1>>(scale);
+      const value_type_t<T1> beta = 0;
+      if constexpr (std::is_same_v<T1, float>) {
+        ret = cublasSsyrk(handle, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, n, k,
+                          &alpha, a, lda, &beta, c, ldc);
+      }
+      else if constexpr (std::is_same_v<T1, double>) {
+        ret = cublasDsyrk(handle, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, n, k,
+                          &alpha, a, lda, &beta, c, ldc);
+      }
+      else if constexpr (std::is_same_v<T1, cuda::std::complex<float>>) {
+        ret = cublasCherk(handle, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, n, k,
+                          &alpha, reinterpret_cast<cuComplex *>(a), lda,
+                          &beta, reinterpret_cast<cuComplex *>(c), ldc);
+      }
+      else if constexpr (std::is_same_v<T1, cuda::std::complex<double>>) {
+        ret = cublasZherk(handle, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, n, k,
+                          &alpha, reinterpret_cast<cuDoubleComplex *>(a), lda,
+                          &beta, reinterpret_cast<cuDoubleComplex *>(c), ldc);
+      }
+
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+    }
+
     // Member variables
-    matxMatMulHandle_t<T1, T1, T1, RANK, PROVIDER_TYPE_CUBLASLT> *onesMM;
-    matxMatMulHandle_t<T1, T1, T1, RANK, PROVIDER_TYPE_CUBLASLT> *covMM;
-    tensor_t<T1, 2> *onesM;
-    tensor_t<T1, RANK> *means;
+    static constexpr unsigned int COV_BLOCK = 256;
+    matxMatMulHandle_t<T1, T1, T1, RANK, PROVIDER_TYPE_CUBLASLT> *covMM =
+        nullptr;
+    cublasHandle_t handle;
+    cublasStatus_t ret = CUBLAS_STATUS_SUCCESS;
     tensor_t<T1, RANK> *devs;
-    tensor_t<T1, RANK> *devsT;
     CovParams_t params_;
 };
 
@@ -275,4 +319,104 @@ void cov(tensor_t<T1, RANK> c, tensor_t<T1, RANK> a,
   }
 }
 
+/**
+ * Compute a covariance matrix on the host
+ *
+ * Same semantics as the stream version. The column means are computed once
+ * per batch and subtracted while the host GEMM packs its operands, so the
+ * deviations are never stored. Only the upper triangle is computed, as in
+ * SYRK/HERK, and it is then mirrored into the lower triangle. Ranks 3 and 4
+ * are treated as batches of matrices.
+ *
+ * @tparam T1
+ *    Data type of A matrix
+ * @tparam RANK
+ *    Rank of A matrix
+ *
+ * @param c
+ *   Covariance matrix output view
+ * @param a
+ *   Covariance matrix input view
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void cov(tensor_t<T1, RANK> c, const tensor_t<T1, RANK> &a,
+         const HostExecutor &exec)
+{
+  using acc_t = promote_matx_half_t<T1>;
+  using operand_t = matxHostGemmCenteredOperand_t<T1, acc_t>;
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(c.Size(RANK - 1) == c.Size(RANK - 2), matxInvalidSize);
+  MATX_ASSERT(a.Size(RANK - 1) == c.Size(RANK - 1), matxInvalidSize);
+  for (int i = 0; i < RANK - 2; i++) {
+    MATX_ASSERT(a.Size(i) == c.Size(i), matxInvalidSize);
+  }
+
+  const index_t batches = batch_count(a, 2);
+  const index_t m = a.Size(RANK - 2);
+  const index_t n = a.Size(RANK - 1);
+  const index_t ars = a.Stride(RANK - 2);
+  const index_t acs = a.Stride(RANK - 1);
+
+  // Column means, swept a row at a time over blocks of columns
+  constexpr index_t COLS = 64;
+  const index_t col_blocks = (n + COLS - 1) / COLS;
+  std::vector<acc_t> means(static_cast<size_t>(batches * n));
+  exec.ParallelFor(batches * col_blocks, [&](index_t task) {
+    const index_t bi = task / col_blocks;
+    const index_t j0 = (task % col_blocks) * COLS;
+    const index_t nc = std::min(COLS, n - j0);
+    const T1 *ab = a.Data() + matxHostGemmBatchOffset(a, bi);
+    acc_t *mu = means.data() + bi * n + j0;
+    for (index_t j = 0; j < nc; j++) {
+      mu[j] = 0;
+    }
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < nc; j++) {
+        mu[j] += matxHostGemmLoad<acc_t>(ab[i * ars + (j0 + j) * acs]);
+      }
+    }
+    for (index_t j = 0; j < nc; j++) {
+      mu[j] /= static_cast<value_type_t<acc_t>>(m);
+    }
+  });
+
+  // C = (A - mu)^H * (A - mu) / (M - 1), with A^H read in place
+  auto cget = [&](index_t bi) {
+    return matxHostGemmOperand_t<T1>{c.Data() + matxHostGemmBatchOffset(c, bi),
+                                     c.Stride(RANK - 2), c.Stride(RANK - 1)};
+  };
+  auto aget = [&](index_t bi) {
+    return operand_t{a.Data() + matxHostGemmBatchOffset(a, bi), acs, ars,
+                     true, means.data() + bi * n, true};
+  };
+  auto bget = [&](index_t bi) {
+    return operand_t{a.Data() + matxHostGemmBatchOffset(a, bi), ars, acs,
+                     false, means.data() + bi * n, false};
+  };
+
+  const auto scale = static_cast<value_type_t<acc_t>>(1) /
+                     static_cast<value_type_t<acc_t>>(m - 1);
+  matxHostGemm<T1>(cget, aget, bget, n, n, m, batches, scale,
+                   static_cast<value_type_t<acc_t>>(0), exec,
+                   matxNoEpilogue_t{}, true);
+
+  exec.ParallelFor(batches * n, [&](index_t task) {
+    const index_t bi = task / n;
+    const index_t i = task % n;
+    const auto cm = cget(bi);
+    for (index_t j = 0; j < i; j++) {
+      const acc_t v = matxHostGemmLoad<acc_t>(cm.data[j * cm.rs + i * cm.cs]);
+      if constexpr (is_complex_v<acc_t>) {
+        cm.data[i * cm.rs + j * cm.cs] =
+            static_cast<T1>(acc_t(v.real(), -v.imag()));
+      }
+      else {
+        cm.data[i * cm.rs + j * cm.cs] = static_cast<T1>(v);
+      }
+    }
+  });
+}
+
 } // end namespace matx
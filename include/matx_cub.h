@@ -33,8 +33,10 @@
 
 #pragma once
 
+#include "matx_cub_host.h"
 #include "matx_dim.h"
 #include "matx_error.h"
+#include "matx_exec_host.h"
 #include "matx_tensor.h"
 #include <any>
 #include <cstdio>
@@ -505,6 +507,195 @@ void sort(tensor_t<T1, RANK> &a_out, const tensor_t<T1, RANK> &a,
 #endif  
 }
 
+/**
+ * Sort rows of a tensor on the host
+ *
+ * Sorts each row of the last dimension with a multi-threaded LSD radix sort.
+ * Integral and floating point types are supported; negative floating point
+ * values are ordered by flipping their bits into unsigned keys, so -0.0 sorts
+ * before 0.0. Rows of a batch are divided among the threads, and a single
+ * long row is split into chunks sorted by all threads together. The sort is
+ * stable in both directions. a_out may be the same tensor as a.
+ *
+ * @tparam T1
+ *   Type of data to sort
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Sorted tensor
+ * @param a
+ *   Input tensor
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void sort(tensor_t<T1, RANK> &a_out, const tensor_t<T1, RANK> &a,
+          const SortDirection_t dir, const HostExecutor &exec)
+{
+  matxHostRadixSort<T1, RANK>(&a_out, nullptr, a, dir == SORT_DIR_DESC, exec);
+}
+
+/**
+ * Sort rows of a tensor on the host and return the permutation
+ *
+ * Same as the host sort(), but additionally writes to a_idx the position
+ * within its row that each sorted value came from, so other tensors can be
+ * gathered into the same order. Equal values keep their input order.
+ *
+ * @tparam T1
+ *   Type of data to sort
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Sorted tensor
+ * @param a_idx
+ *   Index within the row of each sorted value
+ * @param a
+ *   Input tensor
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void sort(tensor_t<T1, RANK> &a_out, tensor_t<index_t, RANK> &a_idx,
+          const tensor_t<T1, RANK> &a, const SortDirection_t dir,
+          const HostExecutor &exec)
+{
+  matxHostRadixSort<T1, RANK>(&a_out, &a_idx, a, dir == SORT_DIR_DESC, exec);
+}
+
+/**
+ * Indices that sort rows of a tensor on the host
+ *
+ * Writes to a_idx the positions of the elements of each row of a in sorted
+ * order without producing the sorted values. Equal values keep their input
+ * order.
+ *
+ * @tparam T1
+ *   Type of data to sort
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_idx
+ *   Index within the row of each sorted value
+ * @param a
+ *   Input tensor
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void argsort(tensor_t<index_t, RANK> &a_idx, const tensor_t<T1, RANK> &a,
+             const SortDirection_t dir, const HostExecutor &exec)
+{
+  matxHostRadixSort<T1, RANK>(nullptr, &a_idx, a, dir == SORT_DIR_DESC, exec);
+}
+
+/**
+ * Largest values of each row of a tensor on the host
+ *
+ * Writes the k largest values of every row of a to a_out in descending
+ * order, where k is the size of the last dimension of a_out. Only the
+ * selected values are sorted, so this is much cheaper than a full sort when k
+ * is small relative to the row length.
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Largest values of each row
+ * @param a
+ *   Input tensor
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void topk(tensor_t<T1, RANK> &a_out, const tensor_t<T1, RANK> &a,
+          const HostExecutor &exec)
+{
+  matxHostTopK<T1, RANK>(&a_out, nullptr, a, true, exec);
+}
+
+/**
+ * Largest values of each row of a tensor and their indices on the host
+ *
+ * Same as topk(), but also writes the position of each selected value within
+ * its row to a_idx. Equal values are reported in order of position.
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Largest values of each row
+ * @param a_idx
+ *   Index within the row of each value
+ * @param a
+ *   Input tensor
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void topk(tensor_t<T1, RANK> &a_out, tensor_t<index_t, RANK> &a_idx,
+          const tensor_t<T1, RANK> &a, const HostExecutor &exec)
+{
+  matxHostTopK<T1, RANK>(&a_out, &a_idx, a, true, exec);
+}
+
+/**
+ * Smallest values of each row of a tensor on the host
+ *
+ * Writes the k smallest values of every row of a to a_out in ascending
+ * order, where k is the size of the last dimension of a_out.
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Smallest values of each row
+ * @param a
+ *   Input tensor
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void bottomk(tensor_t<T1, RANK> &a_out, const tensor_t<T1, RANK> &a,
+             const HostExecutor &exec)
+{
+  matxHostTopK<T1, RANK>(&a_out, nullptr, a, false, exec);
+}
+
+/**
+ * Smallest values of each row of a tensor and their indices on the host
+ *
+ * Same as bottomk(), but also writes the position of each selected value
+ * within its row to a_idx. Equal values are reported in order of position.
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Smallest values of each row
+ * @param a_idx
+ *   Index within the row of each value
+ * @param a
+ *   Input tensor
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void bottomk(tensor_t<T1, RANK> &a_out, tensor_t<index_t, RANK> &a_idx,
+             const tensor_t<T1, RANK> &a, const HostExecutor &exec)
+{
+  matxHostTopK<T1, RANK>(&a_out, &a_idx, a, false, exec);
+}
+
 /**
  * Compute a cumulative sum (prefix sum) of rows of a tensor
  *
@@ -600,4 +791,144 @@ void hist(tensor_t<int, RANK> &a_out, const tensor_t<T1, RANK> &a,
   }
 #endif  
 }
-}; // namespace matx
\ No newline at end of file
+
+/**
+ * Compute a histogram of rows in a tensor on the host
+ *
+ * Same binning as the CUDA hist(): the size of the last dimension of a_out
+ * sets the number of evenly spaced bins between lower (inclusive) and upper
+ * (exclusive), and samples outside that range are not counted. Every row of
+ * the last dimension of a is counted separately. Threads count into private
+ * bins that are merged at the end, so heavily skewed data does not contend
+ * on shared counters.
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Histogram counts
+ * @param a
+ *   Input tensor
+ * @param lower
+ *   Lower limit
+ * @param upper
+ *   Upper limit
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void hist(tensor_t<int, RANK> &a_out, const tensor_t<T1, RANK> &a,
+          const T1 lower, const T1 upper, const HostExecutor &exec)
+{
+  const matxHostHistUniform_t<T1> binner{lower, upper, a_out.Size(RANK - 1)};
+  matxHostHist(a_out, a, binner, exec);
+}
+
+/**
+ * Compute a histogram of rows in a tensor with custom bin edges on the host
+ *
+ * Bin i counts the samples in [edges(i), edges(i + 1)), so edges holds one
+ * more element than the last dimension of a_out and must be non-decreasing.
+ * Samples below the first edge or at or above the last edge are not counted.
+ * Each sample is placed with a branchless binary search over the edges.
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of tensor
+ * @param a_out
+ *   Histogram counts
+ * @param a
+ *   Input tensor
+ * @param edges
+ *   Bin edges
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void hist(tensor_t<int, RANK> &a_out, const tensor_t<T1, RANK> &a,
+          const tensor_t<T1, 1> &edges, const HostExecutor &exec)
+{
+  const matxHostHistEdges_t<T1> binner{edges};
+  matxHostHist(a_out, a, binner, exec);
+}
+
+/**
+ * Compute a joint histogram of two tensors on the host
+ *
+ * Counts the pairs (x, y) taken from the same position of each row of x and
+ * y into a 2D histogram. The last two dimensions of a_out are the number of
+ * evenly spaced bins of x and of y, and any leading dimensions match the
+ * batch dimensions of the inputs. Pairs with either value outside its range
+ * are not counted.
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of input tensors
+ * @tparam ORANK
+ *   Rank of output tensor (RANK + 1)
+ * @param a_out
+ *   Histogram counts, indexed by the bin of x then the bin of y
+ * @param x
+ *   First input tensor
+ * @param y
+ *   Second input tensor
+ * @param xlower
+ *   Lower limit of x
+ * @param xupper
+ *   Upper limit of x
+ * @param ylower
+ *   Lower limit of y
+ * @param yupper
+ *   Upper limit of y
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK, int ORANK>
+void hist2d(tensor_t<int, ORANK> &a_out, const tensor_t<T1, RANK> &x,
+            const tensor_t<T1, RANK> &y, const T1 xlower, const T1 xupper,
+            const T1 ylower, const T1 yupper, const HostExecutor &exec)
+{
+  const matxHostHistUniform_t<T1> xbinner{xlower, xupper, a_out.Size(ORANK - 2)};
+  const matxHostHistUniform_t<T1> ybinner{ylower, yupper, a_out.Size(ORANK - 1)};
+  matxHostHist2D(a_out, x, y, xbinner, ybinner, exec);
+}
+
+/**
+ * Compute a joint histogram of two tensors with custom bin edges on the host
+ *
+ * Same as the evenly spaced hist2d(), with the bins of x and y given by
+ * non-decreasing edges as in hist().
+ *
+ * @tparam T1
+ *   Type of data
+ * @tparam RANK
+ *   Rank of input tensors
+ * @tparam ORANK
+ *   Rank of output tensor (RANK + 1)
+ * @param a_out
+ *   Histogram counts, indexed by the bin of x then the bin of y
+ * @param x
+ *   First input tensor
+ * @param y
+ *   Second input tensor
+ * @param xedges
+ *   Bin edges of x
+ * @param yedges
+ *   Bin edges of y
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK, int ORANK>
+void hist2d(tensor_t<int, ORANK> &a_out, const tensor_t<T1, RANK> &x,
+            const tensor_t<T1, RANK> &y, const tensor_t<T1, 1> &xedges,
+            const tensor_t<T1, 1> &yedges, const HostExecutor &exec)
+{
+  const matxHostHistEdges_t<T1> xbinner{xedges};
+  const matxHostHistEdges_t<T1> ybinner{yedges};
+  matxHostHist2D(a_out, x, y, xbinner, ybinner, exec);
+}
+
+}; // namespace matx
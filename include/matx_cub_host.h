@@ -0,0 +1,948 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_tensor.h"
+#include "matx_type_utils.h"
+
+namespace matx {
+
+/**
+ * Call func(r0, r1) on ranges of rows of a batch, one range per thread, so
+ * the scratch space a row needs is allocated once per thread rather than once
+ * per row
+ */
+template <typename Func>
+inline void matxHostRowGroups(index_t rows, const HostExecutor &exec,
+                              Func &&func)
+{
+  const index_t groups =
+      std::min(rows, static_cast<index_t>(exec.GetNumThreads()));
+  exec.ParallelFor(groups, [&](index_t g) {
+    func(g * rows / groups, (g + 1) * rows / groups);
+  });
+}
+
+/***************************************** RADIX SORT
+ * *********************************************/
+
+/**
+ * Number of key bits consumed by each pass of the host radix sort
+ */
+constexpr int HOST_RADIX_BITS = 8;
+constexpr index_t HOST_RADIX_BUCKETS = index_t{1} << HOST_RADIX_BITS;
+
+/**
+ * Rows at most this long are sorted by insertion, where clearing and scanning
+ * the digit histograms would cost more than the sort itself
+ */
+constexpr index_t HOST_RADIX_SMALL_ROW = 64;
+
+/**
+ * Fewest elements given to each thread when all threads sort a single row
+ */
+constexpr index_t HOST_RADIX_MIN_CHUNK = index_t{1} << 16;
+
+/**
+ * Maps values onto unsigned keys whose unsigned order matches the requested
+ * order of the values. Signed integers flip the sign bit, and floating point
+ * flips the sign bit of positive values and every bit of negative ones.
+ * Descending order inverts the whole key, so both directions are sorted by
+ * the same ascending passes with no reversal afterwards.
+ */
+template <typename T> struct matxHostRadixKey_t {
+  static_assert(std::is_arithmetic_v<T>,
+                "Host sort requires an integral or floating point type");
+
+  using key_t = std::conditional_t<
+      sizeof(T) == 1, uint8_t,
+      std::conditional_t<sizeof(T) == 2, uint16_t,
+                         std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+  static constexpr key_t sign = static_cast<key_t>(key_t{1} << (sizeof(T) * 8 - 1));
+
+  static key_t ToKey(T v, bool descending)
+  {
+    key_t k;
+    std::memcpy(&k, &v, sizeof(T));
+    if constexpr (std::is_floating_point_v<T>) {
+      k = (k & sign) ? static_cast<key_t>(~k) : static_cast<key_t>(k | sign);
+    }
+    else if constexpr (std::is_signed_v<T>) {
+      k = static_cast<key_t>(k ^ sign);
+    }
+
+    return descending ? static_cast<key_t>(~k) : k;
+  }
+
+  static T FromKey(key_t k, bool descending)
+  {
+    if (descending) {
+      k = static_cast<key_t>(~k);
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+      k = (k & sign) ? static_cast<key_t>(k ^ sign) : static_cast<key_t>(~k);
+    }
+    else if constexpr (std::is_signed_v<T>) {
+      k = static_cast<key_t>(k ^ sign);
+    }
+
+    T v;
+    std::memcpy(&v, &k, sizeof(T));
+    return v;
+  }
+};
+
+/**
+ * Stable LSD radix sort of n keys produced by load(i), with the source index
+ * of each key carried along when vals is not null
+ *
+ * The row is split into chunks that are counted and scattered in parallel.
+ * Each chunk keeps its own digit histogram, and the chunk's scatter offsets
+ * for a digit follow those of all lower digits and of the same digit in
+ * earlier chunks, so the threads never share a write position. The first
+ * read counts every pass at once; a pass whose keys all share one digit
+ * moves nothing and is skipped.
+ *
+ * @param load Callable returning the key of element i
+ * @param keys Two buffers of n keys
+ * @param vals Two buffers of n indices, or null for keys only
+ * @returns Index (0 or 1) of the buffers holding the sorted result
+ */
+template <typename K, typename Load>
+int matxHostRadixSortKeys(Load &&load, K *keys[2], index_t *vals[2], index_t n,
+                          index_t chunks, const HostExecutor &exec)
+{
+  constexpr int passes = static_cast<int>(sizeof(K)) * 8 / HOST_RADIX_BITS;
+  constexpr K mask = static_cast<K>(HOST_RADIX_BUCKETS - 1);
+  const bool with_vals = vals[0] != nullptr;
+
+  if (n <= HOST_RADIX_SMALL_ROW) {
+    for (index_t i = 0; i < n; i++) {
+      const K k = load(i);
+      index_t j = i;
+      for (; j > 0 && keys[0][j - 1] > k; j--) {
+        keys[0][j] = keys[0][j - 1];
+        if (with_vals) {
+          vals[0][j] = vals[0][j - 1];
+        }
+      }
+      keys[0][j] = k;
+      if (with_vals) {
+        vals[0][j] = i;
+      }
+    }
+    return 0;
+  }
+
+  const index_t chunk = (n + chunks - 1) / chunks;
+  std::vector<index_t> counts(chunks * passes * HOST_RADIX_BUCKETS, 0);
+  auto count = [&](index_t c, int p) {
+    return &counts[(c * passes + p) * HOST_RADIX_BUCKETS];
+  };
+
+  exec.ParallelFor(chunks, [&](index_t c) {
+    const index_t end = std::min(n, (c + 1) * chunk);
+    for (index_t i = c * chunk; i < end; i++) {
+      const K k = load(i);
+      keys[0][i] = k;
+      if (with_vals) {
+        vals[0][i] = i;
+      }
+      for (int p = 0; p < passes; p++) {
+        count(c, p)[(k >> (p * HOST_RADIX_BITS)) & mask]++;
+      }
+    }
+  });
+
+  std::vector<index_t> offsets(chunks * HOST_RADIX_BUCKETS);
+  int src = 0;
+  bool moved = false;
+  for (int p = 0; p < passes; p++) {
+    bool trivial = false;
+    for (index_t d = 0; d < HOST_RADIX_BUCKETS && !trivial; d++) {
+      index_t total = 0;
+      for (index_t c = 0; c < chunks; c++) {
+        total += count(c, p)[d];
+      }
+      trivial = total == n;
+    }
+    if (trivial) {
+      continue;
+    }
+
+    // Digit totals survive earlier passes, but once keys have moved the
+    // per-chunk counts of this digit have to be taken again
+    const K *ks = keys[src];
+    if (moved && chunks > 1) {
+      exec.ParallelFor(chunks, [&](index_t c) {
+        index_t *h = count(c, p);
+        std::fill(h, h + HOST_RADIX_BUCKETS, 0);
+        const index_t end = std::min(n, (c + 1) * chunk);
+        for (index_t i = c * chunk; i < end; i++) {
+          h[(ks[i] >> (p * HOST_RADIX_BITS)) & mask]++;
+        }
+      });
+    }
+
+    index_t sum = 0;
+    for (index_t d = 0; d < HOST_RADIX_BUCKETS; d++) {
+      for (index_t c = 0; c < chunks; c++) {
+        offsets[c * HOST_RADIX_BUCKETS + d] = sum;
+        sum += count(c, p)[d];
+      }
+    }
+
+    K *kd = keys[1 - src];
+    const index_t *vs = vals[src];
+    index_t *vd = vals[1 - src];
+    exec.ParallelFor(chunks, [&](index_t c) {
+      index_t *off = &offsets[c * HOST_RADIX_BUCKETS];
+      const index_t end = std::min(n, (c + 1) * chunk);
+      if (with_vals) {
+        for (index_t i = c * chunk; i < end; i++) {
+          const index_t pos = off[(ks[i] >> (p * HOST_RADIX_BITS)) & mask]++;
+          kd[pos] = ks[i];
+          vd[pos] = vs[i];
+        }
+      }
+      else {
+        for (index_t i = c * chunk; i < end; i++) {
+          kd[off[(ks[i] >> (p * HOST_RADIX_BITS)) & mask]++] = ks[i];
+        }
+      }
+    });
+
+    src = 1 - src;
+    moved = true;
+  }
+
+  return src;
+}
+
+/**
+ * Radix sort every row (last dimension) of a on the host, writing the sorted
+ * values to out and/or the source position of each value within its row to
+ * idx. Either output may be null. Equal values keep their input order in both
+ * directions, and out may alias a.
+ *
+ * Batches with at least as many rows as threads give each thread whole rows.
+ * Otherwise rows are sorted one at a time with every thread working on
+ * chunks of the row.
+ */
+template <typename T, int RANK>
+void matxHostRadixSort(tensor_t<T, RANK> *out, tensor_t<index_t, RANK> *idx,
+                       const tensor_t<T, RANK> &a, bool descending,
+                       const HostExecutor &exec)
+{
+  using key = matxHostRadixKey_t<T>;
+  using K = typename key::key_t;
+
+  for (int i = 0; i < RANK; i++) {
+    MATX_ASSERT(out == nullptr || out->Size(i) == a.Size(i), matxInvalidSize);
+    MATX_ASSERT(idx == nullptr || idx->Size(i) == a.Size(i), matxInvalidSize);
+  }
+
+  const index_t n = a.Size(RANK - 1);
+  const index_t rows = batch_count(a, 1);
+  const index_t nthreads = exec.GetNumThreads();
+  if (n == 0 || rows == 0) {
+    return;
+  }
+
+  auto sort_row = [&](index_t r, std::vector<K> &kbuf,
+                      std::vector<index_t> &vbuf, index_t chunks,
+                      const HostExecutor &ex) {
+    kbuf.resize(2 * n);
+    K *keys[2] = {kbuf.data(), kbuf.data() + n};
+    index_t *vals[2] = {nullptr, nullptr};
+    if (idx != nullptr) {
+      vbuf.resize(2 * n);
+      vals[0] = vbuf.data();
+      vals[1] = vbuf.data() + n;
+    }
+
+    const T *in = &batch_at(a, r, 0);
+    const index_t in_stride = a.Stride(RANK - 1);
+    const int res = matxHostRadixSortKeys<K>(
+        [&](index_t i) { return key::ToKey(in[i * in_stride], descending); },
+        keys, vals, n, chunks, ex);
+
+    const index_t chunk = (n + chunks - 1) / chunks;
+    ex.ParallelFor(chunks, [&](index_t c) {
+      const index_t end = std::min(n, (c + 1) * chunk);
+      if (out != nullptr) {
+        T *o = &batch_at(*out, r, 0);
+        const index_t os = out->Stride(RANK - 1);
+        for (index_t i = c * chunk; i < end; i++) {
+          o[i * os] = key::FromKey(keys[res][i], descending);
+        }
+      }
+      if (idx != nullptr) {
+        index_t *o = &batch_at(*idx, r, 0);
+        const index_t os = idx->Stride(RANK - 1);
+        for (index_t i = c * chunk; i < end; i++) {
+          o[i * os] = vals[res][i];
+        }
+      }
+    });
+  };
+
+  if (rows >= nthreads || n < 2 * HOST_RADIX_MIN_CHUNK) {
+    const HostExecutor single{SingleThreadHostExecutor{}};
+    matxHostRowGroups(rows, exec, [&](index_t r0, index_t r1) {
+      std::vector<K> kbuf;
+      std::vector<index_t> vbuf;
+      for (index_t r = r0; r < r1; r++) {
+        sort_row(r, kbuf, vbuf, 1, single);
+      }
+    });
+  }
+  else {
+    const index_t chunks = std::min(nthreads, n / HOST_RADIX_MIN_CHUNK);
+    std::vector<K> kbuf;
+    std::vector<index_t> vbuf;
+    for (index_t r = 0; r < rows; r++) {
+      sort_row(r, kbuf, vbuf, chunks, exec);
+    }
+  }
+}
+
+/***************************************** SELECTION
+ * *********************************************/
+
+/**
+ * Value at fractional position pos of the sorted order of v[0, n), linearly
+ * interpolated between the two neighbouring order statistics. v is reordered.
+ *
+ * One introselect places the upper neighbour, and since everything before it
+ * is then no larger, the lower neighbour is the maximum of that prefix. The
+ * work is O(n) with no sort.
+ */
+template <typename T> T matxHostSelectQuantile(T *v, index_t n, double pos)
+{
+  using compute_t =
+      std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+  const index_t lo = static_cast<index_t>(std::floor(pos));
+  const index_t hi = std::min(n - 1, static_cast<index_t>(std::ceil(pos)));
+  std::nth_element(v, v + hi, v + n);
+  if (lo == hi) {
+    return v[hi];
+  }
+
+  const compute_t vlo = static_cast<compute_t>(*std::max_element(v, v + hi));
+  const compute_t vhi = static_cast<compute_t>(v[hi]);
+  return static_cast<T>(
+      vlo + (vhi - vlo) * static_cast<compute_t>(pos - static_cast<double>(lo)));
+}
+
+/**
+ * Interpolated q-th percentile (0 to 100) of every row of in, written to the
+ * matching element of dest. Rows are copied once into per-thread scratch and
+ * reduced with matxHostSelectQuantile.
+ */
+template <typename T, int RANK, int RANK_IN>
+void matxHostPercentile(tensor_t<T, RANK> &dest, const tensor_t<T, RANK_IN> &in,
+                        double q, const HostExecutor &exec)
+{
+  static_assert(RANK_IN == RANK + 1, "Output rank must be one less than input");
+  static_assert(!is_complex_v<T>, "Percentiles require an ordered type");
+  MATX_ASSERT_STR(q >= 0.0 && q <= 100.0, matxInvalidParameter,
+                  "Percentile must be between 0 and 100");
+  for (int i = 0; i < RANK; i++) {
+    MATX_ASSERT(dest.Size(i) == in.Size(i), matxInvalidSize);
+  }
+
+  const index_t n = in.Size(RANK_IN - 1);
+  const index_t rows = batch_count(in, 1);
+  MATX_ASSERT(n > 0, matxInvalidSize);
+
+  const double pos = q / 100.0 * static_cast<double>(n - 1);
+  matxHostRowGroups(rows, exec, [&](index_t r0, index_t r1) {
+    std::vector<T> buf(n);
+    for (index_t r = r0; r < r1; r++) {
+      for (index_t i = 0; i < n; i++) {
+        buf[i] = batch_at(in, r, i);
+      }
+
+      const T v = matxHostSelectQuantile(buf.data(), n, pos);
+      if constexpr (RANK == 0) {
+        dest() = v;
+      }
+      else {
+        const index_t last = dest.Size(RANK - 1);
+        batch_at(dest, r / last, r % last) = v;
+      }
+    }
+  });
+}
+
+/**
+ * Largest (or smallest) k values of every row of in in sorted order, where k
+ * is the length of the last dimension of the outputs. Either output may be
+ * null; idx receives the position of each value within its row.
+ *
+ * The row is partitioned around its k-th element by introselect and only the
+ * k selected elements are sorted, so the cost is O(n + k log k). Ties are
+ * broken by position when indices are requested, making them deterministic.
+ */
+template <typename T, int RANK>
+void matxHostTopK(tensor_t<T, RANK> *out, tensor_t<index_t, RANK> *idx,
+                  const tensor_t<T, RANK> &in, bool largest,
+                  const HostExecutor &exec)
+{
+  static_assert(!is_complex_v<T>, "Top-k requires an ordered type");
+  MATX_ASSERT(out != nullptr || idx != nullptr, matxInvalidParameter);
+
+  const index_t n = in.Size(RANK - 1);
+  const index_t k = out != nullptr ? out->Size(RANK - 1) : idx->Size(RANK - 1);
+  MATX_ASSERT_STR(k <= n, matxInvalidSize,
+                  "k must not exceed the length of the input rows");
+  MATX_ASSERT(idx == nullptr || idx->Size(RANK - 1) == k, matxInvalidSize);
+  for (int i = 0; i < RANK - 1; i++) {
+    MATX_ASSERT(out == nullptr || out->Size(i) == in.Size(i), matxInvalidSize);
+    MATX_ASSERT(idx == nullptr || idx->Size(i) == in.Size(i), matxInvalidSize);
+  }
+
+  const index_t rows = batch_count(in, 1);
+  if (k == 0 || rows == 0) {
+    return;
+  }
+
+  auto select = [&](auto *first, auto before) {
+    if (k < n) {
+      std::nth_element(first, first + k - 1, first + n, before);
+    }
+    std::sort(first, first + k, before);
+  };
+
+  matxHostRowGroups(rows, exec, [&](index_t r0, index_t r1) {
+    if (idx != nullptr) {
+      std::vector<std::pair<T, index_t>> buf(n);
+      for (index_t r = r0; r < r1; r++) {
+        for (index_t i = 0; i < n; i++) {
+          buf[i] = {batch_at(in, r, i), i};
+        }
+
+        select(buf.data(), [largest](const auto &x, const auto &y) {
+          if (x.first == y.first) {
+            return x.second < y.second;
+          }
+          return largest ? x.first > y.first : x.first < y.first;
+        });
+
+        for (index_t i = 0; i < k; i++) {
+          if (out != nullptr) {
+            batch_at(*out, r, i) = buf[i].first;
+          }
+          batch_at(*idx, r, i) = buf[i].second;
+        }
+      }
+    }
+    else {
+      std::vector<T> buf(n);
+      for (index_t r = r0; r < r1; r++) {
+        for (index_t i = 0; i < n; i++) {
+          buf[i] = batch_at(in, r, i);
+        }
+
+        select(buf.data(), [largest](const T &x, const T &y) {
+          return largest ? x > y : x < y;
+        });
+
+        for (index_t i = 0; i < k; i++) {
+          batch_at(*out, r, i) = buf[i];
+        }
+      }
+    }
+  });
+}
+
+/***************************************** PREFIX SCAN
+ * *********************************************/
+
+/**
+ * Lines of inner elements scanned together by one work item of the host scan.
+ * Scanning along an outer dimension steps through the line one row at a time,
+ * so neighbouring inner elements are read together.
+ */
+constexpr index_t HOST_SCAN_INNER_CHUNK = 256;
+
+/**
+ * Fewest elements per work item before a scan dimension is split into blocks
+ */
+constexpr index_t HOST_SCAN_MIN_BLOCK = index_t{1} << 14;
+
+/**
+ * Offsets of every element of dimensions [d0, d1) of t in row-major order
+ */
+template <typename TensorType>
+std::vector<index_t> matxHostDimOffsets(const TensorType &t, int d0, int d1)
+{
+  std::vector<index_t> off{0};
+  for (int d = d0; d < d1; d++) {
+    std::vector<index_t> next;
+    next.reserve(off.size() * t.Size(d));
+    for (const index_t o : off) {
+      for (index_t i = 0; i < t.Size(d); i++) {
+        next.push_back(o + i * t.Stride(d));
+      }
+    }
+    off.swap(next);
+  }
+
+  return off;
+}
+
+/**
+ * Inclusive or exclusive scan of in along dimension dim with the associative
+ * operator op, which has the Reduce() and Init() interface of the reduction
+ * operators. out may alias in.
+ *
+ * The tensor is viewed as [outer, dim, inner] through precomputed offsets, so
+ * any dimension is scanned in place without a transpose. A work item scans a
+ * chunk of inner elements together. When there are too few work items to
+ * occupy the threads, the scanned dimension is also split into blocks in two
+ * passes: every block but the last is reduced, the block totals of each line
+ * are scanned into carries, and the blocks are then scanned in parallel
+ * starting from their carries.
+ */
+template <typename T, int RANK, typename ScanOp>
+void matxHostScan(tensor_t<T, RANK> &out, const tensor_t<T, RANK> &in,
+                  ScanOp op, int dim, bool exclusive, const HostExecutor &exec)
+{
+  MATX_ASSERT(dim >= 0 && dim < RANK, matxInvalidDim);
+  for (int i = 0; i < RANK; i++) {
+    MATX_ASSERT(out.Size(i) == in.Size(i), matxInvalidSize);
+  }
+
+  const auto in_outer = matxHostDimOffsets(in, 0, dim);
+  const auto in_inner = matxHostDimOffsets(in, dim + 1, RANK);
+  const auto out_outer = matxHostDimOffsets(out, 0, dim);
+  const auto out_inner = matxHostDimOffsets(out, dim + 1, RANK);
+  const index_t outer = static_cast<index_t>(in_outer.size());
+  const index_t inner = static_cast<index_t>(in_inner.size());
+  const index_t len = in.Size(dim);
+  const index_t is = in.Stride(dim);
+  const index_t os = out.Stride(dim);
+  if (len == 0 || outer == 0 || inner == 0) {
+    return;
+  }
+
+  bool contiguous = true;
+  for (index_t i = 0; i < inner && contiguous; i++) {
+    contiguous = in_inner[i] == i && out_inner[i] == i;
+  }
+
+  const index_t width = std::min(inner, HOST_SCAN_INNER_CHUNK);
+  const index_t chunks = (inner + width - 1) / width;
+  const index_t items = outer * chunks;
+  const index_t nthreads = exec.GetNumThreads();
+
+  index_t blocks = 1;
+  if (items < nthreads) {
+    blocks = std::min((nthreads + items - 1) / items,
+                      std::max(index_t{1}, len * width / HOST_SCAN_MIN_BLOCK));
+  }
+  const index_t blen = (len + blocks - 1) / blocks;
+  blocks = (len + blen - 1) / blen;
+
+  // Totals, then carries, of each block of each work item
+  std::vector<T> carry(blocks > 1 ? items * blocks * width : 0);
+
+  auto run = [&](index_t w, index_t b, bool reduce_only, auto contig) {
+    const index_t o = w / chunks;
+    const index_t i0 = (w % chunks) * width;
+    const index_t cnt = std::min(inner - i0, width);
+    const index_t j0 = b * blen;
+    const index_t j1 = std::min(len, j0 + blen);
+    T *slot = blocks > 1 ? &carry[(w * blocks + b) * width] : nullptr;
+
+    T acc[HOST_SCAN_INNER_CHUNK];
+    for (index_t i = 0; i < cnt; i++) {
+      acc[i] = (b > 0 && !reduce_only) ? slot[i] : op.Init();
+    }
+
+    for (index_t j = j0; j < j1; j++) {
+      const T *x = in.Data() + in_outer[o] + j * is;
+      T *y = out.Data() + out_outer[o] + j * os;
+      for (index_t i = 0; i < cnt; i++) {
+        const index_t ii = contig ? i0 + i : in_inner[i0 + i];
+        const index_t oi = contig ? i0 + i : out_inner[i0 + i];
+        const T v = x[ii];
+        if (reduce_only) {
+          acc[i] = op.Reduce(acc[i], v);
+        }
+        else if (exclusive) {
+          y[oi] = acc[i];
+          acc[i] = op.Reduce(acc[i], v);
+        }
+        else {
+          acc[i] = op.Reduce(acc[i], v);
+          y[oi] = acc[i];
+        }
+      }
+    }
+
+    if (reduce_only) {
+      std::copy(acc, acc + cnt, slot);
+    }
+  };
+
+  auto pass = [&](index_t count, index_t per, bool reduce_only) {
+    exec.ParallelFor(count, [&](index_t t) {
+      if (contiguous) {
+        run(t / per, t % per, reduce_only, std::true_type{});
+      }
+      else {
+        run(t / per, t % per, reduce_only, std::false_type{});
+      }
+    });
+  };
+
+  if (blocks > 1) {
+    pass(items * (blocks - 1), blocks - 1, true);
+
+    // Block totals become the carry into each block; block 0 starts from
+    // Init() and the last block's total is never needed
+    exec.ParallelFor(items, [&](index_t w) {
+      T *c = &carry[w * blocks * width];
+      for (index_t i = 0; i < width; i++) {
+        T total = op.Init();
+        for (index_t b = 0; b < blocks; b++) {
+          const T t = c[b * width + i];
+          c[b * width + i] = total;
+          total = op.Reduce(total, t);
+        }
+      }
+    });
+  }
+
+  pass(items * blocks, blocks, false);
+}
+
+/***************************************** HISTOGRAM
+ * *********************************************/
+
+/**
+ * Samples mapped to bins at a time by the host histogram. Each block of bin
+ * indices is computed by a vectorizable loop before any count is touched.
+ */
+constexpr index_t HOST_HIST_BLOCK = 256;
+
+/**
+ * Fewest samples per thread before a row is split across threads
+ */
+constexpr index_t HOST_HIST_MIN_CHUNK = index_t{1} << 15;
+
+/**
+ * Private copies of the counts kept by each thread. Consecutive samples go
+ * to different copies, so runs of samples in the same bin do not serialize
+ * on one counter.
+ */
+constexpr index_t HOST_HIST_COPIES = 4;
+
+/**
+ * Evenly spaced bins over [lower, upper). Samples outside the range, and
+ * NaNs, map to the overflow bin numbered bins.
+ */
+template <typename T> class matxHostHistUniform_t {
+public:
+  using compute_t = std::conditional_t<std::is_same_v<T, float> ||
+                                           (std::is_integral_v<T> && sizeof(T) < 4),
+                                       float, double>;
+
+  matxHostHistUniform_t(T lower, T upper, index_t bins)
+      : lower_(lower), upper_(upper), bins_(static_cast<int32_t>(bins)),
+        scale_(static_cast<compute_t>(bins) /
+               (static_cast<compute_t>(upper) - static_cast<compute_t>(lower)))
+  {
+    MATX_ASSERT_STR(lower < upper, matxInvalidParameter,
+                    "Histogram lower bound must be below the upper bound");
+  }
+
+  index_t Bins() const { return bins_; }
+
+  void operator()(const T *v, index_t cnt, int32_t *bin) const
+  {
+    const compute_t lo = static_cast<compute_t>(lower_);
+    for (index_t i = 0; i < cnt; i++) {
+      const T x = v[i];
+      const bool in = x >= lower_ && x < upper_;
+      const int32_t b = static_cast<int32_t>(
+          (static_cast<compute_t>(in ? x : lower_) - lo) * scale_);
+      bin[i] = in ? std::min(b, bins_ - 1) : bins_;
+    }
+  }
+
+private:
+  T lower_;
+  T upper_;
+  int32_t bins_;
+  compute_t scale_;
+};
+
+/**
+ * Bins between consecutive entries of a non-decreasing list of edges, each
+ * including its lower edge. Samples below the first edge or at or above the
+ * last map to the overflow bin, which is the number of bins.
+ *
+ * Every lookup is a branchless binary search of fixed depth, so the cost
+ * does not depend on the data.
+ */
+template <typename T> class matxHostHistEdges_t {
+public:
+  explicit matxHostHistEdges_t(const tensor_t<T, 1> &edges)
+      : edges_(edges.Size(0))
+  {
+    for (index_t i = 0; i < edges.Size(0); i++) {
+      edges_[i] = edges(i);
+    }
+
+    MATX_ASSERT_STR(edges_.size() >= 2, matxInvalidSize,
+                    "At least two bin edges are required");
+    for (size_t i = 1; i < edges_.size(); i++) {
+      MATX_ASSERT_STR(edges_[i - 1] <= edges_[i], matxInvalidParameter,
+                      "Histogram bin edges must be non-decreasing");
+    }
+  }
+
+  index_t Bins() const { return static_cast<index_t>(edges_.size()) - 1; }
+
+  void operator()(const T *v, index_t cnt, int32_t *bin) const
+  {
+    const T *edges = edges_.data();
+    const int32_t size = static_cast<int32_t>(edges_.size());
+
+    // The search depth only depends on the number of edges, so the block
+    // steps through it together and the loads of different samples overlap
+    std::fill(bin, bin + cnt, 0);
+    for (int32_t len = size; len > 1;) {
+      const int32_t half = len / 2;
+      for (index_t i = 0; i < cnt; i++) {
+        bin[i] = edges[bin[i] + half] <= v[i] ? bin[i] + half : bin[i];
+      }
+      len -= half;
+    }
+
+    // Above the last edge the search already lands on the overflow bin
+    for (index_t i = 0; i < cnt; i++) {
+      bin[i] = v[i] >= edges[0] ? bin[i] : size - 1;
+    }
+  }
+
+private:
+  std::vector<T> edges_;
+};
+
+/**
+ * Count the bins of rows samples of length n into nbins bins, where
+ * map(r, i, cnt, bin) writes the bins of samples [i, i + cnt) of row r,
+ * using nbins for samples that fall outside every bin, and store(r, b, count)
+ * receives the final counts.
+ *
+ * Counts are kept in thread-private arrays. Batches with enough rows give
+ * each thread whole rows, so the private counts are the result. Otherwise
+ * every row is split into chunks counted in parallel and the private counts of
+ * the chunks are summed at the end.
+ */
+template <typename Map, typename Store>
+void matxHostHistogram(index_t rows, index_t n, index_t nbins, Map &&map,
+                       Store &&store, const HostExecutor &exec)
+{
+  const index_t nthreads = exec.GetNumThreads();
+  const index_t stride = nbins + 1;
+  if (rows == 0 || nbins == 0) {
+    return;
+  }
+
+  index_t chunks = 1;
+  if (rows < nthreads) {
+    chunks = std::max(index_t{1}, std::min((nthreads + rows - 1) / rows,
+                                           n / HOST_HIST_MIN_CHUNK));
+  }
+  const index_t clen = (n + chunks - 1) / chunks;
+
+  auto count = [&](index_t r, index_t i0, index_t i1, int *counts) {
+    std::fill(counts, counts + HOST_HIST_COPIES * stride, 0);
+    int32_t bin[HOST_HIST_BLOCK];
+    for (index_t i = i0; i < i1; i += HOST_HIST_BLOCK) {
+      const index_t cnt = std::min(HOST_HIST_BLOCK, i1 - i);
+      map(r, i, cnt, bin);
+
+      index_t k = 0;
+      for (; k + HOST_HIST_COPIES <= cnt; k += HOST_HIST_COPIES) {
+        for (index_t q = 0; q < HOST_HIST_COPIES; q++) {
+          counts[q * stride + bin[k + q]]++;
+        }
+      }
+      for (; k < cnt; k++) {
+        counts[bin[k]]++;
+      }
+    }
+
+    for (index_t b = 0; b < nbins; b++) {
+      for (index_t q = 1; q < HOST_HIST_COPIES; q++) {
+        counts[b] += counts[q * stride + b];
+      }
+    }
+  };
+
+  if (chunks == 1) {
+    matxHostRowGroups(rows, exec, [&](index_t r0, index_t r1) {
+      std::vector<int> counts(HOST_HIST_COPIES * stride);
+      for (index_t r = r0; r < r1; r++) {
+        count(r, 0, n, counts.data());
+        for (index_t b = 0; b < nbins; b++) {
+          store(r, b, counts[b]);
+        }
+      }
+    });
+    return;
+  }
+
+  std::vector<int> partial(rows * chunks * nbins);
+  exec.ParallelFor(rows * chunks, [&](index_t t) {
+    const index_t c = t % chunks;
+    std::vector<int> counts(HOST_HIST_COPIES * stride);
+    count(t / chunks, c * clen, std::min(n, (c + 1) * clen), counts.data());
+    std::copy(counts.begin(), counts.begin() + nbins, &partial[t * nbins]);
+  });
+
+  exec.ParallelFor(rows, [&](index_t r) {
+    for (index_t b = 0; b < nbins; b++) {
+      int total = 0;
+      for (index_t c = 0; c < chunks; c++) {
+        total += partial[(r * chunks + c) * nbins + b];
+      }
+      store(r, b, total);
+    }
+  });
+}
+
+/**
+ * Returns map(r, i, cnt, bin) for matxHostHistogram that bins row r of a
+ * with binner, copying strided rows into a contiguous block first
+ */
+template <typename T, int RANK, typename Binner>
+auto matxHostHistMap(const tensor_t<T, RANK> &a, const Binner &binner)
+{
+  return [&a, &binner](index_t r, index_t i, index_t cnt, int32_t *bin) {
+    const T *row = &batch_at(a, r, 0);
+    const index_t s = a.Stride(RANK - 1);
+    if (s == 1) {
+      binner(row + i, cnt, bin);
+    }
+    else {
+      T buf[HOST_HIST_BLOCK];
+      for (index_t k = 0; k < cnt; k++) {
+        buf[k] = row[(i + k) * s];
+      }
+      binner(buf, cnt, bin);
+    }
+  };
+}
+
+/**
+ * Histogram of every row of a into the last dimension of out
+ */
+template <typename T, int RANK, typename Binner>
+void matxHostHist(tensor_t<int, RANK> &out, const tensor_t<T, RANK> &a,
+                  const Binner &binner, const HostExecutor &exec)
+{
+  MATX_ASSERT(out.Size(RANK - 1) == binner.Bins(), matxInvalidSize);
+  for (int i = 0; i < RANK - 1; i++) {
+    MATX_ASSERT(out.Size(i) == a.Size(i), matxInvalidSize);
+  }
+
+  matxHostHistogram(
+      batch_count(a, 1), a.Size(RANK - 1), binner.Bins(),
+      matxHostHistMap(a, binner),
+      [&](index_t r, index_t b, int v) { batch_at(out, r, b) = v; }, exec);
+}
+
+/**
+ * Joint histogram of the pairs (x, y) of every row of x and y into the last
+ * two dimensions of out, with x selecting the row of the bin and y the column
+ */
+template <typename T, int RANK, int ORANK, typename XBinner, typename YBinner>
+void matxHostHist2D(tensor_t<int, ORANK> &out, const tensor_t<T, RANK> &x,
+                    const tensor_t<T, RANK> &y, const XBinner &xbinner,
+                    const YBinner &ybinner, const HostExecutor &exec)
+{
+  static_assert(ORANK == RANK + 1,
+                "Joint histogram output must have one more dimension than the inputs");
+  const index_t xbins = xbinner.Bins();
+  const index_t ybins = ybinner.Bins();
+  const index_t nbins = xbins * ybins;
+  MATX_ASSERT(out.Size(ORANK - 2) == xbins, matxInvalidSize);
+  MATX_ASSERT(out.Size(ORANK - 1) == ybins, matxInvalidSize);
+  for (int i = 0; i < RANK; i++) {
+    MATX_ASSERT(x.Size(i) == y.Size(i), matxInvalidSize);
+  }
+  for (int i = 0; i < RANK - 1; i++) {
+    MATX_ASSERT(out.Size(i) == x.Size(i), matxInvalidSize);
+  }
+
+  auto xmap = matxHostHistMap(x, xbinner);
+  auto ymap = matxHostHistMap(y, ybinner);
+  matxHostHistogram(
+      batch_count(x, 1), x.Size(RANK - 1), nbins,
+      [&](index_t r, index_t i, index_t cnt, int32_t *bin) {
+        int32_t ybin[HOST_HIST_BLOCK];
+        xmap(r, i, cnt, bin);
+        ymap(r, i, cnt, ybin);
+        for (index_t k = 0; k < cnt; k++) {
+          const bool in = bin[k] < xbins && ybin[k] < ybins;
+          bin[k] = in ? static_cast<int32_t>(bin[k] * ybins + ybin[k])
+                      : static_cast<int32_t>(nbins);
+        }
+      },
+      [&](index_t r, index_t b, int v) {
+        batch_at2(out, r, b / ybins, b % ybins) = v;
+      },
+      exec);
+}
+
+}; // namespace matx
@@ -31,7 +31,17 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "matx_error.h"
 #include "matx_get_grid_dims.h"
@@ -44,7 +54,7 @@ class SingleThreadHostExecutor {
     using matx_executor = bool;
     
     template <typename Op>
-    void Exec(Op &op) const noexcept {
+    void Exec(Op &op) const {
       if constexpr (op.Rank() == 0) {
         op();
       }
@@ -96,5 +106,263 @@ class SingleThreadHostExecutor {
     }
 };
 
+/**
+ * @brief Process-wide pool of host worker threads
+ *
+ * Host executors are cheap values created per call, so the threads behind
+ * them live here instead and are reused by every HostExecutor::ParallelFor.
+ * Threads are started on first use and the pool only grows, up to the
+ * largest number of helpers any executor has asked for.
+ */
+class matxHostThreadPool_t {
+  public:
+    static matxHostThreadPool_t &Get()
+    {
+      static matxHostThreadPool_t pool;
+      return pool;
+    }
+
+    matxHostThreadPool_t(const matxHostThreadPool_t &) = delete;
+    matxHostThreadPool_t &operator=(const matxHostThreadPool_t &) = delete;
+
+    ~matxHostThreadPool_t()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_all();
+      for (auto &t : threads_) {
+        t.join();
+      }
+    }
+
+    /**
+     * @brief Queue copies of a task for up to count idle threads
+     *
+     * @param task Task to run
+     * @param count Number of copies to queue
+     */
+    void Submit(const std::function<void()> &task, index_t count)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (static_cast<index_t>(threads_.size()) < count) {
+          threads_.emplace_back([this]() { Worker(); });
+        }
+        for (index_t i = 0; i < count; i++) {
+          tasks_.push_back(task);
+        }
+      }
+      if (count == 1) {
+        cv_.notify_one();
+      }
+      else {
+        cv_.notify_all();
+      }
+    }
+
+  private:
+    matxHostThreadPool_t() = default;
+
+    void Worker()
+    {
+      for (;;) {
+        std::function<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+          if (tasks_.empty()) {
+            return;
+          }
+          task = std::move(tasks_.front());
+          tasks_.pop_front();
+        }
+        task();
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    bool stop_ = false;
+};
+
+/**
+ * @brief Executes operators and host transforms on a set of host threads
+ *
+ * Work is split along the outermost dimension and handed out dynamically to
+ * the worker threads. Transforms with a host implementation take this
+ * executor in place of a CUDA stream. Passing a SingleThreadHostExecutor
+ * where a HostExecutor is expected runs the same code on the calling thread
+ * only.
+ */
+class HostExecutor {
+  public:
+    using matx_executor = bool;
+
+    /**
+     * @brief Construct an executor using all hardware threads
+     */
+    HostExecutor() : HostExecutor(0) {}
+
+    /**
+     * @brief Construct an executor with a fixed number of threads
+     *
+     * @param num_threads Number of threads. 0 uses all hardware threads
+     */
+    explicit HostExecutor(int num_threads)
+        : num_threads_(num_threads > 0
+                           ? num_threads
+                           : std::max(1, static_cast<int>(
+                                             std::thread::hardware_concurrency())))
+    {
+    }
+
+    HostExecutor([[maybe_unused]] const SingleThreadHostExecutor &ex)
+        : num_threads_(1)
+    {
+    }
+
+    int GetNumThreads() const noexcept { return num_threads_; }
+
+    /**
+     * @brief Call func(idx) for every idx in [0, count) across the threads
+     *
+     * Items are claimed one at a time from a shared counter, so each item
+     * should carry enough work (a row, a matrix, a block) to amortize that.
+     * The calling thread participates as one of the workers, and the others
+     * come from the shared matxHostThreadPool_t. Helpers that have not
+     * started by the time the caller runs out of items are cancelled rather
+     * than waited for, so nested calls from inside func cannot deadlock the
+     * pool.
+     *
+     * If func throws, no further items are started and the first exception
+     * is rethrown on the calling thread once every running item has
+     * finished.
+     *
+     * @param count Number of work items
+     * @param func Callable taking an index_t work item
+     */
+    template <typename Func>
+    void ParallelFor(index_t count, Func &&func) const
+    {
+      const index_t nthreads =
+          std::min(static_cast<index_t>(num_threads_), count);
+
+      if (nthreads <= 1) {
+        for (index_t idx = 0; idx < count; idx++) {
+          func(idx);
+        }
+        return;
+      }
+
+      // Shared with the queued helpers, which may outlive this call if they
+      // are cancelled before they start
+      struct state_t {
+        std::atomic<index_t> next{0};
+        std::atomic<index_t> unclaimed{0};
+        index_t finished = 0;
+        std::exception_ptr err;
+        std::mutex mutex;
+        std::condition_variable cv;
+      };
+      auto st = std::make_shared<state_t>();
+      st->unclaimed = nthreads - 1;
+
+      auto work = [count, &func](state_t &s) {
+        try {
+          for (index_t idx = s.next++; idx < count; idx = s.next++) {
+            func(idx);
+          }
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> lock(s.mutex);
+          if (!s.err) {
+            s.err = std::current_exception();
+          }
+          s.next = count;
+        }
+      };
+
+      matxHostThreadPool_t::Get().Submit(
+          [st, work]() {
+            index_t u = st->unclaimed.load();
+            while (u > 0 && !st->unclaimed.compare_exchange_weak(u, u - 1)) {
+            }
+            if (u == 0) {
+              return;
+            }
+            work(*st);
+            std::lock_guard<std::mutex> lock(st->mutex);
+            st->finished++;
+            st->cv.notify_one();
+          },
+          nthreads - 1);
+
+      work(*st);
+
+      const index_t started = nthreads - 1 - st->unclaimed.exchange(0);
+      std::unique_lock<std::mutex> lock(st->mutex);
+      st->cv.wait(lock, [&]() { return st->finished == started; });
+      if (st->err) {
+        std::rethrow_exception(st->err);
+      }
+    }
+
+    template <typename Op>
+    void Exec(Op &op) const {
+      if constexpr (op.Rank() == 0) {
+        op();
+      }
+      else if constexpr (op.Rank() == 1) {
+        constexpr index_t chunk = 4096;
+        index_t size0 = op.Size(0);
+        ParallelFor((size0 + chunk - 1) / chunk, [&](index_t c) {
+          index_t end = std::min(size0, (c + 1) * chunk);
+          for (index_t idx = c * chunk; idx < end; idx++) {
+            op(idx);
+          }
+        });
+      }
+      else if constexpr (op.Rank() == 2) {
+        index_t size1 = op.Size(1);
+        ParallelFor(op.Size(0), [&](index_t idx) {
+          for (index_t idy = 0; idy < size1; idy++) {
+            op(idx, idy);
+          }
+        });
+      }
+      else if constexpr (op.Rank() == 3) {
+        index_t size1 = op.Size(1);
+        index_t size2 = op.Size(2);
+        ParallelFor(op.Size(0) * size1, [&](index_t outer) {
+          index_t idx = outer / size1;
+          index_t idy = outer - idx * size1;
+          for (index_t idz = 0; idz < size2; idz++) {
+            op(idx, idy, idz);
+          }
+        });
+      }
+      else {
+        index_t size1 = op.Size(1);
+        index_t size2 = op.Size(2);
+        index_t size3 = op.Size(3);
+        ParallelFor(op.Size(0) * size1, [&](index_t outer) {
+          index_t idx = outer / size1;
+          index_t idy = outer - idx * size1;
+          for (index_t idz = 0; idz < size2; idz++) {
+            for (index_t idw = 0; idw < size3; idw++) {
+              op(idx, idy, idz, idw);
+            }
+          }
+        });
+      }
+    }
+
+  private:
+    int num_threads_;
+};
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matx_error.h"
+#include "matx_type_utils.h"
+
+namespace matx {
+
+/**
+ * Host complex FFT plan of a fixed length
+ *
+ * Works in place on interleaved real/imaginary data. Power-of-two lengths use
+ * an iterative radix-2 transform whose twiddles are stored stage by stage, so
+ * every butterfly pass reads them with unit stride. Other lengths use
+ * Bluestein's algorithm on a power-of-two transform, with the chirp and the
+ * transform of its conjugate precomputed. All tables are built once by the
+ * constructor; Exec only reads the plan, so one plan can be shared by any
+ * number of threads, each with its own scratch space.
+ *
+ * Neither direction is normalized.
+ *
+ * @tparam T
+ *   float or double
+ */
+template <typename T> class matxHostFftPlan_t {
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "Host FFTs must be float or double");
+
+public:
+  /**
+   * Construct a plan
+   *
+   * @param n
+   *   Transform length
+   */
+  explicit matxHostFftPlan_t(index_t n) : n_(n)
+  {
+    MATX_ASSERT_STR(n > 0, matxInvalidSize, "FFT length must be positive");
+
+    if ((n & (n - 1)) == 0) {
+      rev_.resize(n);
+      rev_[0] = 0;
+      for (index_t i = 1; i < n; i++) {
+        rev_[i] = (rev_[i >> 1] >> 1) | ((i & 1) ? n >> 1 : 0);
+      }
+
+      // Stage with half-length h keeps exp(-i pi j / h) at h - 1 + j
+      twr_.resize(std::max(n - 1, index_t{1}));
+      twi_.resize(std::max(n - 1, index_t{1}));
+      for (index_t h = 1; h < n; h *= 2) {
+        for (index_t j = 0; j < h; j++) {
+          const double a = M_PI * static_cast<double>(j) / static_cast<double>(h);
+          twr_[h - 1 + j] = static_cast<T>(std::cos(a));
+          twi_[h - 1 + j] = static_cast<T>(-std::sin(a));
+        }
+      }
+      return;
+    }
+
+    index_t m = 1;
+    while (m < 2 * n - 1) {
+      m *= 2;
+    }
+    sub_ = std::make_unique<matxHostFftPlan_t>(m);
+
+    // exp(-i pi k^2 / n), with k^2 reduced mod 2n to keep the angle exact
+    chr_.resize(n);
+    chi_.resize(n);
+    for (index_t k = 0; k < n; k++) {
+      const double a = M_PI * static_cast<double>((k * k) % (2 * n)) /
+                       static_cast<double>(n);
+      chr_[k] = static_cast<T>(std::cos(a));
+      chi_[k] = static_cast<T>(-std::sin(a));
+    }
+
+    // Transform of the conjugate chirp wrapped around m, with the 1 / m of
+    // the inverse transform folded in
+    kern_.assign(2 * m, 0);
+    for (index_t k = 0; k < n; k++) {
+      kern_[2 * k] = chr_[k];
+      kern_[2 * k + 1] = -chi_[k];
+      if (k > 0) {
+        kern_[2 * (m - k)] = chr_[k];
+        kern_[2 * (m - k) + 1] = -chi_[k];
+      }
+    }
+    std::vector<T> scratch(sub_->ScratchSize());
+    sub_->Exec(kern_.data(), false, scratch.data());
+    for (auto &v : kern_) {
+      v /= static_cast<T>(m);
+    }
+  }
+
+  /**
+   * Transform length
+   */
+  index_t Size() const noexcept { return n_; }
+
+  /**
+   * Number of T values of scratch space Exec needs
+   */
+  index_t ScratchSize() const noexcept
+  {
+    return sub_ ? 2 * sub_->Size() + sub_->ScratchSize() : 0;
+  }
+
+  /**
+   * Transform n complex values in place
+   *
+   * @param x
+   *   2n values, real and imaginary parts interleaved
+   * @param inverse
+   *   Use exp(+i ...) instead of exp(-i ...)
+   * @param scratch
+   *   ScratchSize() values not aliasing x
+   */
+  void Exec(T *x, bool inverse, T *scratch) const
+  {
+    if (!sub_) {
+      Radix2(x, inverse ? T(-1) : T(1));
+      return;
+    }
+
+    // The inverse is the conjugate of the forward transform of the conjugate
+    const index_t m = sub_->Size();
+    const T sgn = inverse ? T(-1) : T(1);
+    T *y = scratch;
+    for (index_t k = 0; k < n_; k++) {
+      const T xr = x[2 * k];
+      const T xi = sgn * x[2 * k + 1];
+      y[2 * k] = xr * chr_[k] - xi * chi_[k];
+      y[2 * k + 1] = xr * chi_[k] + xi * chr_[k];
+    }
+    std::fill(y + 2 * n_, y + 2 * m, T(0));
+
+    sub_->Exec(y, false, scratch + 2 * m);
+    for (index_t k = 0; k < m; k++) {
+      const T yr = y[2 * k];
+      const T yi = y[2 * k + 1];
+      y[2 * k] = yr * kern_[2 * k] - yi * kern_[2 * k + 1];
+      y[2 * k + 1] = yr * kern_[2 * k + 1] + yi * kern_[2 * k];
+    }
+    sub_->Exec(y, true, scratch + 2 * m);
+
+    for (index_t k = 0; k < n_; k++) {
+      const T yr = y[2 * k];
+      const T yi = y[2 * k + 1];
+      x[2 * k] = yr * chr_[k] - yi * chi_[k];
+      x[2 * k + 1] = sgn * (yr * chi_[k] + yi * chr_[k]);
+    }
+  }
+
+private:
+  void Radix2(T *x, T sgn) const
+  {
+    for (index_t i = 0; i < n_; i++) {
+      const index_t j = rev_[i];
+      if (i < j) {
+        std::swap(x[2 * i], x[2 * j]);
+        std::swap(x[2 * i + 1], x[2 * j + 1]);
+      }
+    }
+
+    for (index_t h = 1; h < n_; h *= 2) {
+      const T *wr = &twr_[h - 1];
+      const T *wi = &twi_[h - 1];
+      for (index_t s = 0; s < n_; s += 2 * h) {
+        T *a = x + 2 * s;
+        T *b = a + 2 * h;
+        for (index_t j = 0; j < h; j++) {
+          const T w_i = sgn * wi[j];
+          const T tr = wr[j] * b[2 * j] - w_i * b[2 * j + 1];
+          const T ti = wr[j] * b[2 * j + 1] + w_i * b[2 * j];
+          b[2 * j] = a[2 * j] - tr;
+          b[2 * j + 1] = a[2 * j + 1] - ti;
+          a[2 * j] += tr;
+          a[2 * j + 1] += ti;
+        }
+      }
+    }
+  }
+
+  index_t n_;
+  std::vector<index_t> rev_;
+  std::vector<T> twr_, twi_;
+  std::vector<T> chr_, chi_, kern_;
+  std::unique_ptr<matxHostFftPlan_t> sub_;
+};
+
+}; // namespace matx
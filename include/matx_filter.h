@@ -35,6 +35,8 @@
 #include "matx_conv.h"
 #include "matx_dim.h"
 #include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_filter_host.h"
 #include "matx_filter_kernels.cuh"
 #include "matx_tensor.h"
 #include <any>
@@ -42,6 +44,7 @@
 #include <cstdio>
 #include <stdint.h>
 #include <type_traits>
+#include <vector>
 
 namespace matx {
 
@@ -149,6 +152,7 @@ public:
   void Exec(tensor_t<OutType, RANK> &o, InType &i, cudaStream_t stream)
   {
     if (num_recursive > 0) {
+#ifdef __CUDACC__
       auto grid =
           dim3(static_cast<int>(
                    (sig_len +
@@ -160,6 +164,7 @@ public:
           <<<grid, BLOCK_SIZE_RECURSIVE, 0, stream>>>(
               o, i, d_nrec, d_corr, d_full_carries, d_part_carries, sig_len,
               d_status, d_last_carries);
+#endif
     }
     else {
       // Just call the convolution kernel directly if they
@@ -189,77 +194,37 @@ private:
 
   void ComputeCorrectionFactors(const FilterType *coeffs)
   {
-    FilterType *out = reinterpret_cast<FilterType *>(
-        malloc(sizeof(FilterType) * num_recursive * CORR_COLS));
-    FilterType *last = reinterpret_cast<FilterType *>(
-        malloc(sizeof(*d_last_carries) * num_recursive));
-    if (out == nullptr || last == nullptr) {
-
-      if (last != nullptr)
-        free(last);
-      if (out != nullptr)
-        free(out);
-
-      MATX_THROW(matxCudaError, "allocation error");
+    using coeff_t = filter_host_coeff_t<FilterType>;
+    static_assert(sizeof(coeff_t) == sizeof(FilterType));
+
+    // The kernel keeps the first CORR_COLS columns in shared memory and needs
+    // the last column of a full chunk for the carries
+    std::array<coeff_t, num_recursive> rec;
+    for (size_t k = 0; k < num_recursive; k++) {
+      rec[k] = matxFilterHostCoeff(coeffs[k]);
     }
 
-    for (uint32_t row = 0; row < num_recursive; row++) {
-      for (uint32_t col = 0; col < CORR_COLS * RECURSIVE_VALS_PER_THREAD;
-           col++) {
-        // There are an implicit num_recursive columns prior to
-        // the actual coefficients beginning that are needed for computation
-        FilterType res;
-        if constexpr (std::is_same_v<FilterType, COMPLEX_TYPE>) {
-          res.x = 0;
-          res.y = 0;
-        }
-        else {
-          res = 0;
-        }
-
-        for (uint32_t k = 0; k < num_recursive; k++) {
-          int offs = col - k - 1;
-          if (offs < 0) {
-            // We're in the implicit coefficients
-            if constexpr (std::is_same_v<FilterType, COMPLEX_TYPE>) {
-              res = (static_cast<int>(row) + 1 == -offs)
-                        ? cuCaddf(res, coeffs[k])
-                        : res;
-            }
-            else {
-              res += (static_cast<int>(row) + 1 == -offs) ? coeffs[k] : 0;
-            }
-          }
-          else {
-            if constexpr (std::is_same_v<FilterType, COMPLEX_TYPE>) {
-              res = cuCaddf(
-                  res, cuCmulf(coeffs[k], out[row * CORR_COLS + col - k - 1]));
-            }
-            else {
-              res += coeffs[k] * out[row * CORR_COLS + col - k - 1];
-            }
-          }
-        }
-
-        if (col < CORR_COLS) {
-          out[row * CORR_COLS + col] = res;
-        }
-        else if (col == CORR_COLS * RECURSIVE_VALS_PER_THREAD - 1) {
-          last[row] = res;
-        }
-      }
+    // Unlike the host filter, the kernel keeps factors that underflow
+    std::vector<coeff_t> full(num_recursive * RECURSIVE_CHUNK_SIZE);
+    matxFilterCorrectionFactors(rec, RECURSIVE_CHUNK_SIZE, full.data(),
+                                false);
+
+    std::vector<coeff_t> out(num_recursive * CORR_COLS);
+    std::vector<coeff_t> last(num_recursive);
+    for (size_t row = 0; row < num_recursive; row++) {
+      std::copy(full.begin() + row * RECURSIVE_CHUNK_SIZE,
+                full.begin() + row * RECURSIVE_CHUNK_SIZE + CORR_COLS,
+                out.begin() + row * CORR_COLS);
+      last[row] = full[(row + 1) * RECURSIVE_CHUNK_SIZE - 1];
     }
 
     // Copy to device
-    MATX_CUDA_CHECK(cudaMemcpy(d_corr, out,
-                               sizeof(*out) * num_recursive * CORR_COLS,
+    MATX_CUDA_CHECK(cudaMemcpy(d_corr, out.data(),
+                               sizeof(coeff_t) * num_recursive * CORR_COLS,
                                cudaMemcpyHostToDevice));
-    MATX_CUDA_CHECK(cudaMemcpy(d_last_carries, last,
-                               sizeof(*last) * num_recursive,
+    MATX_CUDA_CHECK(cudaMemcpy(d_last_carries, last.data(),
+                               sizeof(coeff_t) * num_recursive,
                                cudaMemcpyHostToDevice));
-
-    free(out);
-    free(last);
   }
 
   // Keep copy if we take the fast path and don't need pointer transformations
@@ -274,6 +239,150 @@ private:
   index_t sig_len;
 };
 
+/**
+ * Filter state of every signal in a batch between blocks of samples
+ *
+ * Both histories hold the most recent sample first, one row per signal.
+ */
+template <typename T> struct FilterState_t {
+  std::vector<T> nonrec; // batches x (NNR - 1) last inputs
+  std::vector<T> rec;    // batches x NR last outputs
+};
+
+/**
+ * Host plan for FIR and IIR filtering
+ *
+ * Holds the coefficients and the correction factors for a full
+ * RECURSIVE_CHUNK_SIZE chunk so that repeated calls only filter. Batches are
+ * filtered HOST_FILTER_LANES signals at a time across SIMD lanes, and when
+ * there are too few of them to occupy every thread, long signals are split
+ * into chunks that are filtered in parallel and then corrected as in the
+ * device kernel.
+ *
+ * The plan is stateful: each Exec continues every signal from where the
+ * previous one left off, so an unbounded stream can be filtered one block at
+ * a time with the same result as filtering it whole. Blocks may have any
+ * length, but the number of signals is fixed by the plan. ClearState restarts
+ * from zero and GetState/SetState checkpoint and restore the histories.
+ */
+template <size_t num_recursive, size_t num_non_recursive, int RANK,
+          typename OutType, typename InType, typename FilterType>
+class matxFilterHost_t {
+public:
+  using coeff_t = filter_host_coeff_t<FilterType>;
+  using compute_t = decltype(
+      std::declval<promote_matx_half_t<typename InType::scalar_type>>() *
+      std::declval<coeff_t>());
+  using state_t = FilterState_t<compute_t>;
+
+  matxFilterHost_t(tensor_t<OutType, RANK> &o, InType &i,
+                   const std::array<FilterType, num_recursive> &h_rec,
+                   const std::array<FilterType, num_non_recursive> &h_nonrec)
+  {
+    for (int d = 0; d < RANK; d++) {
+      MATX_ASSERT(o.Size(d) == i.Size(d), matxInvalidSize);
+    }
+
+    batches = batch_count(i, 1);
+
+    for (size_t k = 0; k < num_recursive; k++) {
+      rec[k] = matxFilterHostCoeff(h_rec[k]);
+    }
+    for (size_t k = 0; k < num_non_recursive; k++) {
+      nonrec[k] = matxFilterHostCoeff(h_nonrec[k]);
+    }
+
+    corr.resize(num_recursive * RECURSIVE_CHUNK_SIZE);
+    matxFilterCorrectionFactors(rec, RECURSIVE_CHUNK_SIZE, corr.data(), true);
+
+    ClearState();
+  }
+
+  matxFilterHost_t(tensor_t<OutType, RANK> &o, InType &i,
+                   tensor_t<FilterType, 1> &h_rec,
+                   tensor_t<FilterType, 1> &h_nonrec)
+      : matxFilterHost_t(o, i, ToArray<num_recursive>(h_rec),
+                         ToArray<num_non_recursive>(h_nonrec))
+  {
+  }
+
+  /**
+   * Filter the next block of every signal
+   *
+   * @param o
+   *   Output tensor. May alias the input
+   * @param i
+   *   Input tensor
+   * @param exec
+   *   Host executor
+   */
+  void Exec(tensor_t<OutType, RANK> &o, InType &i, const HostExecutor &exec)
+  {
+    for (int d = 0; d < RANK; d++) {
+      MATX_ASSERT(o.Size(d) == i.Size(d), matxInvalidSize);
+    }
+    MATX_ASSERT(batch_count(i, 1) == batches, matxInvalidSize);
+
+    matxHostFilter<num_recursive, num_non_recursive>(
+        rec, nonrec, corr.data(), o, i, state.nonrec.data(), state.rec.data(),
+        exec);
+  }
+
+  /**
+   * Reset every signal to zero history, as if no samples had been filtered
+   */
+  void ClearState()
+  {
+    state.nonrec.assign(batches * NonRecHistory(), compute_t(0));
+    state.rec.assign(batches * num_recursive, compute_t(0));
+  }
+
+  /**
+   * Get the histories needed to continue filtering after the last block
+   */
+  const state_t &GetState() const { return state; }
+
+  /**
+   * Continue filtering from a state returned by GetState
+   *
+   * @param s
+   *   State of a plan with the same number of signals and coefficients
+   */
+  void SetState(const state_t &s)
+  {
+    MATX_ASSERT_STR(s.nonrec.size() ==
+                            static_cast<size_t>(batches * NonRecHistory()) &&
+                        s.rec.size() ==
+                            static_cast<size_t>(batches * num_recursive),
+                    matxInvalidSize,
+                    "Filter state does not match the shape of the plan");
+    state = s;
+  }
+
+private:
+  static constexpr index_t NonRecHistory()
+  {
+    return num_non_recursive > 0 ? num_non_recursive - 1 : 0;
+  }
+
+  template <size_t N>
+  static std::array<FilterType, N> ToArray(tensor_t<FilterType, 1> &h)
+  {
+    MATX_ASSERT(h.Size(0) == static_cast<index_t>(N), matxInvalidSize);
+    std::array<FilterType, N> a;
+    for (size_t k = 0; k < N; k++) {
+      a[k] = h(static_cast<index_t>(k));
+    }
+    return a;
+  }
+
+  std::array<coeff_t, num_recursive> rec;
+  std::array<coeff_t, num_non_recursive> nonrec;
+  std::vector<coeff_t> corr;
+  state_t state;
+  index_t batches;
+};
+
 /**
  * FIR and IIR filtering
  *
@@ -381,6 +490,48 @@ static auto matxMakeFilter(tensor_t<OutType, RANK> &o, InType &i,
       o, i, rec_v, nonrec_v};
 }
 
+/**
+ * Stateful FIR and IIR filtering on the host
+ *
+ * Creates a host plan whose Exec(o, i, exec) filters one block of a stream
+ * at a time, continuing each signal from the final state of the previous
+ * block. Memory use and latency per block are independent of how many
+ * blocks came before, and the output is the same as filtering the
+ * concatenated blocks at once. Use GetState and SetState to checkpoint and
+ * resume a stream, and ClearState to start a new one.
+ *
+ * @tparam NR
+ *   Number of recursive coefficients
+ * @tparam NNR
+ *   Number of non-recursive coefficients
+ * @tparam RANK
+ *   Rank of input and output signal
+ * @tparam OutType
+ *   Ouput type
+ * @tparam InType
+ *   Input type
+ * @tparam FilterType
+ *   Filter type
+ *
+ * @param o
+ *   Output tensor of the shape of a block
+ * @param i
+ *   Input tensor of the shape of a block
+ * @param h_rec
+ *   Vector of recursive coefficients
+ * @param h_nonrec
+ *   Vector of non-recursive coefficients
+ **/
+template <size_t NR, size_t NNR, int RANK, typename OutType, typename InType,
+          typename FilterType>
+auto matxMakeFilterHost(tensor_t<OutType, RANK> &o, InType &i,
+                        const std::array<FilterType, NR> &h_rec,
+                        const std::array<FilterType, NNR> &h_nonrec)
+{
+  return matxFilterHost_t<NR, NNR, RANK, OutType, InType, FilterType>{
+      o, i, h_rec, h_nonrec};
+}
+
 /**
  * Parameters needed to execute a recursive filter.
  */
@@ -515,4 +666,50 @@ void filter(tensor_t<OutType, RANK> o, InType i,
   }
 }
 
+/**
+ * FIR and IIR filtering on the host
+ *
+ * Host counterpart of filter() using matxFilterHost_t. Signals of a batch are
+ * filtered several at a time across SIMD lanes, and long signals that cannot
+ * fill the threads of the executor are split into RECURSIVE_CHUNK_SIZE chunks
+ * that are filtered in parallel and stitched together with the same
+ * correction factors as the device kernel. The output may alias the input.
+ *
+ * @tparam NR
+ *   Number of recursive coefficients
+ * @tparam NNR
+ *   Number of non-recursive coefficients
+ * @tparam RANK
+ *   Rank of input and output signal
+ * @tparam OutType
+ *   Ouput type
+ * @tparam InType
+ *   Input type
+ * @tparam FilterType
+ *   Filter type
+ *
+ * @param o
+ *   Output tensor
+ * @param i
+ *   Input tensor
+ * @param h_rec
+ *   Vector of recursive coefficients
+ * @param h_nonrec
+ *   Vector of non-recursive coefficients
+ * @param exec
+ *   Host executor
+ *
+ **/
+template <size_t NR, size_t NNR, int RANK, typename OutType, typename InType,
+          typename FilterType>
+void filter(tensor_t<OutType, RANK> o, InType i,
+            const std::array<FilterType, NR> h_rec,
+            const std::array<FilterType, NNR> h_nonrec,
+            const HostExecutor &exec)
+{
+  matxFilterHost_t<NR, NNR, RANK, OutType, InType, FilterType> plan{
+      o, i, h_rec, h_nonrec};
+  plan.Exec(o, i, exec);
+}
+
 } // end namespace matx
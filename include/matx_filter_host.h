@@ -0,0 +1,456 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_filter_kernels.cuh"
+#include "matx_tensor.h"
+#include "matx_type_utils.h"
+
+namespace matx {
+
+/**
+ * Signals interleaved per SIMD group by the host recursive filter
+ */
+constexpr index_t HOST_FILTER_LANES = 8;
+
+/**
+ * Samples per lane staged in the interleaved buffers at a time
+ */
+constexpr index_t HOST_FILTER_BLOCK = 128;
+
+/**
+ * Host arithmetic type for filter coefficients. cuComplex coefficients used
+ * by the device kernels have no operators, so they are computed as the
+ * layout-compatible cuda::std::complex<float>
+ */
+template <typename T>
+using filter_host_coeff_t =
+    std::conditional_t<std::is_same_v<T, COMPLEX_TYPE>,
+                       cuda::std::complex<float>, T>;
+
+template <typename T>
+inline filter_host_coeff_t<T> matxFilterHostCoeff(const T &c)
+{
+  if constexpr (std::is_same_v<T, COMPLEX_TYPE>) {
+    return {c.x, c.y};
+  }
+  else {
+    return c;
+  }
+}
+
+/**
+ * True if a coefficient is below the smallest normal number of its type
+ */
+template <typename T> inline bool matxFilterUnderflows(const T &c)
+{
+  using value_t = value_type_t<T>;
+  if constexpr (is_complex_v<T>) {
+    return cuda::std::abs(c) < std::numeric_limits<value_t>::min();
+  }
+  else {
+    return std::abs(c) < std::numeric_limits<value_t>::min();
+  }
+}
+
+/**
+ * Impulse responses of the recursive part of a filter
+ *
+ * Row r of out holds the first cols outputs of the all-pole recursion
+ * y[n] = sum_k a[k] * y[n-k-1] with no input, started from a history where
+ * only y[-r-1] is one. Adding sum_r out[r][n] * y[-r-1] to a chunk filtered
+ * from zero state therefore gives the output filtered from the true state,
+ * which is what lets chunks of a signal be filtered independently.
+ *
+ * @param a
+ *   Recursive coefficients
+ * @param cols
+ *   Number of outputs per row
+ * @param out
+ *   num_recursive x cols output, row-major
+ * @param flush
+ *   Replace factors that underflow with zero. The device filter keeps them,
+ *   so its output does not depend on this helper
+ */
+template <size_t NR, typename T>
+inline void matxFilterCorrectionFactors(const std::array<T, NR> &a,
+                                        index_t cols, T *out, bool flush)
+{
+  for (index_t r = 0; r < static_cast<index_t>(NR); r++) {
+    T *row = out + r * cols;
+    for (index_t col = 0; col < cols; col++) {
+      T res = 0;
+      for (index_t k = 0; k < static_cast<index_t>(NR); k++) {
+        const index_t offs = col - k - 1;
+        if (offs >= 0) {
+          res += a[k] * row[offs];
+        }
+        else if (r + 1 == -offs) {
+          // Implicit history before the first output
+          res += a[k];
+        }
+      }
+      // A stable recursion decays into denormals, which are slow to carry
+      // on and contribute nothing to the corrections
+      row[col] = flush && matxFilterUnderflows(res) ? T(0) : res;
+    }
+  }
+}
+
+/**
+ * Filter up to HOST_FILTER_LANES signals of the same length at once
+ *
+ * Computes y[n] = sum_k b[k] * x[n-k] + sum_r a[r] * y[n-r-1] for each lane.
+ * Samples are staged HOST_FILTER_BLOCK at a time into buffers interleaved by
+ * lane so the recursion, which is serial in n, is vectorized across lanes.
+ * Each block is read completely before it is written, so a lane may filter in
+ * place.
+ *
+ * @param a
+ *   Recursive coefficients
+ * @param b
+ *   Non-recursive coefficients
+ * @param out
+ *   Output pointer of each lane
+ * @param in
+ *   Input pointer of each lane
+ * @param ostride
+ *   Output stride in elements
+ * @param istride
+ *   Input stride in elements
+ * @param n
+ *   Samples per lane
+ * @param lanes
+ *   Number of lanes in use
+ * @param xh
+ *   Input history of each lane, lanes x (NNR - 1) with the most recent sample
+ *   first. Updated to the history after the last sample
+ * @param yh
+ *   Output history of each lane, lanes x NR with the most recent sample
+ *   first. Updated to the history after the last sample
+ */
+template <size_t NR, size_t NNR, typename T, typename C, typename OutT,
+          typename InT>
+inline void matxHostFilterLanes(const std::array<C, NR> &a,
+                                const std::array<C, NNR> &b,
+                                OutT *const *out, const InT *const *in,
+                                index_t ostride, index_t istride, index_t n,
+                                index_t lanes, T *xh, T *yh)
+{
+  constexpr index_t W = HOST_FILTER_LANES;
+  constexpr index_t B = HOST_FILTER_BLOCK;
+  constexpr index_t XH = NNR > 0 ? static_cast<index_t>(NNR) - 1 : 0;
+  constexpr index_t YH = static_cast<index_t>(NR);
+
+  // The output history of every lane stays in registers across samples
+  T x[(XH + B) * W];
+  T y[B * W];
+  T yv[YH + 1][W];
+  for (index_t w = 0; w < W; w++) {
+    for (index_t k = 0; k < XH; k++) {
+      x[(XH - 1 - k) * W + w] = w < lanes ? xh[w * XH + k] : T(0);
+    }
+    for (index_t r = 0; r < YH; r++) {
+      yv[r][w] = w < lanes ? yh[w * YH + r] : T(0);
+    }
+  }
+
+  for (index_t blk = 0; blk < n; blk += B) {
+    const index_t cnt = std::min(B, n - blk);
+    for (index_t w = 0; w < W; w++) {
+      T *xr = x + XH * W + w;
+      if (w < lanes) {
+        const InT *src = in[w] + blk * istride;
+        for (index_t j = 0; j < cnt; j++) {
+          xr[j * W] = static_cast<T>(src[j * istride]);
+        }
+      }
+      else {
+        for (index_t j = 0; j < cnt; j++) {
+          xr[j * W] = T(0);
+        }
+      }
+    }
+
+    // Non-recursive part has no dependency between samples
+    for (index_t j = 0; j < cnt * W; j++) {
+      T acc = 0;
+      for (index_t k = 0; k < static_cast<index_t>(NNR); k++) {
+        acc += b[k] * x[XH * W + j - k * W];
+      }
+      y[j] = acc;
+    }
+
+    if constexpr (YH > 0) {
+      for (index_t j = 0; j < cnt; j++) {
+        for (index_t w = 0; w < W; w++) {
+          // Most recent output last so only one multiply-add per sample is
+          // on the serial dependency chain
+          T acc = y[j * W + w];
+          for (index_t r = YH - 1; r >= 0; r--) {
+            acc += a[r] * yv[r][w];
+          }
+          for (index_t r = YH - 1; r > 0; r--) {
+            yv[r][w] = yv[r - 1][w];
+          }
+          yv[0][w] = acc;
+          y[j * W + w] = acc;
+        }
+      }
+    }
+
+    for (index_t w = 0; w < lanes; w++) {
+      const T *yr = y + w;
+      OutT *dst = out[w] + blk * ostride;
+      for (index_t j = 0; j < cnt; j++) {
+        dst[j * ostride] = static_cast<OutT>(yr[j * W]);
+      }
+    }
+
+    std::copy(x + cnt * W, x + (cnt + XH) * W, x);
+  }
+
+  for (index_t w = 0; w < lanes; w++) {
+    for (index_t k = 0; k < XH; k++) {
+      xh[w * XH + k] = x[(XH - 1 - k) * W + w];
+    }
+    for (index_t r = 0; r < YH; r++) {
+      yh[w * YH + r] = yv[r][w];
+    }
+  }
+}
+
+/**
+ * Host recursive filter over every row of a batch
+ *
+ * Rows are filtered HOST_FILTER_LANES at a time with one group of rows per
+ * task. When there are too few rows to fill the lanes of every thread, each
+ * row is instead split into RECURSIVE_CHUNK_SIZE chunks like the device
+ * kernel: the first chunk starts from the row's history and the others from
+ * zero state, lanes holding neighbouring chunks, then the last outputs of
+ * each chunk are carried serially through the correction factors and the
+ * correction is added to every chunk after the first.
+ *
+ * @param a
+ *   Recursive coefficients
+ * @param b
+ *   Non-recursive coefficients
+ * @param corr
+ *   Correction factors from matxFilterCorrectionFactors with
+ *   RECURSIVE_CHUNK_SIZE columns
+ * @param o
+ *   Output tensor
+ * @param i
+ *   Input tensor
+ * @param xs
+ *   Input history of each row, rows x (NNR - 1) with the most recent sample
+ *   first. Updated to the history after the last sample
+ * @param ys
+ *   Output history of each row, rows x NR, laid out like xs
+ * @param exec
+ *   Host executor
+ */
+template <size_t NR, size_t NNR, typename T, typename C, typename OutTensor,
+          typename InTensor>
+void matxHostFilter(const std::array<C, NR> &a, const std::array<C, NNR> &b,
+                    const C *corr, OutTensor &o, const InTensor &i, T *xs,
+                    T *ys, const HostExecutor &exec)
+{
+  using out_t = typename OutTensor::scalar_type;
+  using in_t = typename InTensor::scalar_type;
+  constexpr int RANK = OutTensor::Rank();
+  constexpr index_t W = HOST_FILTER_LANES;
+  constexpr index_t L = RECURSIVE_CHUNK_SIZE;
+  constexpr index_t XH = NNR > 0 ? static_cast<index_t>(NNR) - 1 : 0;
+  constexpr index_t YH = static_cast<index_t>(NR);
+
+  const index_t rows = batch_count(o, 1);
+  const index_t n = o.Size(RANK - 1);
+  const index_t os = o.Stride(RANK - 1);
+  const index_t is = i.Stride(RANK - 1);
+  const index_t nthreads = exec.GetNumThreads();
+  if (rows == 0 || n == 0) {
+    return;
+  }
+
+  if (n < 2 * L || rows >= W * nthreads) {
+    exec.ParallelFor((rows + W - 1) / W, [&](index_t g) {
+      const index_t r0 = g * W;
+      const index_t lanes = std::min(W, rows - r0);
+      out_t *optr[W] = {};
+      const in_t *iptr[W] = {};
+      T xh[W * XH + 1] = {};
+      T yh[W * YH + 1] = {};
+      for (index_t w = 0; w < lanes; w++) {
+        optr[w] = &batch_at(o, r0 + w, 0);
+        iptr[w] = &batch_at(i, r0 + w, 0);
+        std::copy(xs + (r0 + w) * XH, xs + (r0 + w + 1) * XH, xh + w * XH);
+        std::copy(ys + (r0 + w) * YH, ys + (r0 + w + 1) * YH, yh + w * YH);
+      }
+      matxHostFilterLanes<NR, NNR>(a, b, optr, iptr, os, is, n, lanes, xh,
+                                   yh);
+      for (index_t w = 0; w < lanes; w++) {
+        std::copy(xh + w * XH, xh + (w + 1) * XH, xs + (r0 + w) * XH);
+        std::copy(yh + w * YH, yh + (w + 1) * YH, ys + (r0 + w) * YH);
+      }
+    });
+    return;
+  }
+
+  // Correction factors of a stable filter decay to zero, so chunks are only
+  // corrected up to the last nonzero factor
+  index_t corr_len = 0;
+  for (index_t k = 0; k < YH; k++) {
+    for (index_t j = corr_len; j < L; j++) {
+      if (corr[k * L + j] != C(0)) {
+        corr_len = j + 1;
+      }
+    }
+  }
+
+  // Per chunk input halo and last local outputs. The halos are gathered
+  // before anything is written so the filter may run in place
+  const index_t chunks = (n + L - 1) / L;
+  const index_t groups = (chunks + W - 1) / W;
+  std::vector<T> xh(rows * chunks * XH + 1);
+  std::vector<T> yh(rows * chunks * YH + 1, T(0));
+  for (index_t r = 0; r < rows; r++) {
+    const in_t *src = &batch_at(i, r, 0);
+    for (index_t c = 0; c < chunks; c++) {
+      T *h = xh.data() + (r * chunks + c) * XH;
+      for (index_t k = 0; k < XH; k++) {
+        if (c > 0) {
+          h[k] = static_cast<T>(src[(c * L - 1 - k) * is]);
+        }
+        else {
+          h[k] = xs[r * XH + k];
+        }
+      }
+    }
+    std::copy(ys + r * YH, ys + (r + 1) * YH, yh.data() + r * chunks * YH);
+  }
+
+  exec.ParallelFor(rows * groups, [&](index_t t) {
+    const index_t r = t / groups;
+    const index_t c0 = (t % groups) * W;
+    const index_t c1 = std::min(chunks, c0 + W);
+    // The last chunk may be short and is filtered on its own
+    const index_t full = (c1 == chunks && n % L != 0) ? c1 - 1 : c1;
+    out_t *optr[W] = {};
+    const in_t *iptr[W] = {};
+    for (index_t c = c0; c < c1; c++) {
+      optr[c - c0] = &batch_at(o, r, 0) + c * L * os;
+      iptr[c - c0] = &batch_at(i, r, 0) + c * L * is;
+    }
+    T *xr = xh.data() + r * chunks * XH;
+    T *yr = yh.data() + r * chunks * YH;
+    if (full > c0) {
+      matxHostFilterLanes<NR, NNR>(a, b, optr, iptr, os, is, L, full - c0,
+                                   xr + c0 * XH, yr + c0 * YH);
+    }
+    if (full < c1) {
+      matxHostFilterLanes<NR, NNR>(a, b, optr + (full - c0),
+                                   iptr + (full - c0), os, is, n - full * L,
+                                   1, xr + full * XH, yr + full * YH);
+    }
+  });
+
+  // Carry the true final outputs of each chunk into the next. yh now holds
+  // the local final outputs, which become the true ones in place. A last
+  // chunk shorter than the history reaches back into the previous chunk,
+  // where the correction factors are the implicit identity
+  for (index_t r = 0; r < rows; r++) {
+    T *yr = yh.data() + r * chunks * YH;
+    for (index_t c = 1; c < chunks; c++) {
+      const index_t last = std::min(L, n - c * L) - 1;
+      for (index_t j = 0; j < YH; j++) {
+        const index_t col = last - j;
+        T acc = yr[c * YH + j];
+        for (index_t k = 0; k < YH; k++) {
+          if (col >= 0) {
+            acc += corr[k * L + col] * yr[(c - 1) * YH + k];
+          }
+          else if (k == -col - 1) {
+            acc += yr[(c - 1) * YH + k];
+          }
+        }
+        yr[c * YH + j] = acc;
+      }
+    }
+  }
+
+  if constexpr (NR > 0) {
+    exec.ParallelFor(rows * (chunks - 1), [&](index_t t) {
+      const index_t r = t / (chunks - 1);
+      const index_t c = t % (chunks - 1) + 1;
+      const index_t len = std::min(corr_len, n - c * L);
+      T carry[YH] = {};
+      std::copy(yh.data() + (r * chunks + c - 1) * YH,
+                yh.data() + (r * chunks + c) * YH, carry);
+      out_t *dst = &batch_at(o, r, 0) + c * L * os;
+      for (index_t j0 = 0; j0 < len; j0 += HOST_FILTER_BLOCK) {
+        const index_t cnt = std::min(HOST_FILTER_BLOCK, len - j0);
+        T acc[HOST_FILTER_BLOCK];
+        for (index_t j = 0; j < cnt; j++) {
+          acc[j] = static_cast<T>(dst[(j0 + j) * os]);
+        }
+        for (index_t k = 0; k < YH; k++) {
+          const C *cr = corr + k * L + j0;
+          for (index_t j = 0; j < cnt; j++) {
+            acc[j] += cr[j] * carry[k];
+          }
+        }
+        for (index_t j = 0; j < cnt; j++) {
+          dst[(j0 + j) * os] = static_cast<out_t>(acc[j]);
+        }
+      }
+    });
+  }
+
+  for (index_t r = 0; r < rows; r++) {
+    std::copy(xh.data() + (r * chunks + chunks - 1) * XH,
+              xh.data() + (r * chunks + chunks) * XH, xs + r * XH);
+    std::copy(yh.data() + (r * chunks + chunks - 1) * YH,
+              yh.data() + (r * chunks + chunks) * YH, ys + r * YH);
+  }
+}
+
+}; // namespace matx
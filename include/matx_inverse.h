@@ -35,6 +35,8 @@
 #include "cublas_v2.h"
 #include "matx_dim.h"
 #include "matx_error.h"
+#include "matx_small_matrix.h"
+#include "matx_solver_host.h"
 #include "matx_tensor.h"
 #include <cstdio>
 #include <numeric>
@@ -329,6 +331,27 @@ struct InverseParamsKeyEq {
 static matxCache_t<InverseParams_t, InverseParamsKeyHash, InverseParamsKeyEq>
     inv_cache;
 
+/**
+ * Perform a matrix inverse on the device
+ *
+ * Batches of matrices from 2 x 2 to 8 x 8 are inverted by inv_small with one
+ * matrix per thread. Everything else goes through a cached cuBLAS plan.
+ * Singular inputs raise matxLUError on either path.
+ *
+ * @tparam T1
+ *   Data type of matrix A
+ * @tparam RANK
+ *   Rank of matrix A
+ * @tparam ALGO
+ *   Inverse algorithm to use
+ *
+ * @param a_inv
+ *   Inverse of A (if it exists)
+ * @param a
+ *   Input matrix A
+ * @param stream
+ *   CUDA stream
+ */
 #ifdef DOXYGEN_ONLY
 void inv(tensor_t a_inv, tensor_t a, cudaStream_t stream = 0)
 #else
@@ -337,6 +360,16 @@ void inv(tensor_t<T1, RANK> a_inv, tensor_t<T1, RANK> a,
          cudaStream_t stream = 0)
 #endif
 {
+  // Batches of tiny matrices are inverted one per thread in registers
+  if constexpr (RANK >= 3) {
+    if (a.Size(RANK - 1) == a.Size(RANK - 2) &&
+        matxSmallDispatch(a.Size(RANK - 1), [&](auto ic) {
+          inv_small<decltype(ic)::value>(a_inv, a, stream);
+        })) {
+      return;
+    }
+  }
+
   // Get parameters required by these tensors
   auto params = matxInversePlan_t<T1, RANK, ALGO>::GetInverseParams(a_inv, a);
   params.stream = stream;
@@ -355,4 +388,103 @@ void inv(tensor_t<T1, RANK> a_inv, tensor_t<T1, RANK> a,
   }
 }
 
+/**
+ * Host matrix inverse plan
+ *
+ * Batches of matrices up to 8 x 8, and single matrices up to 4 x 4, go
+ * through the interleaved small-matrix engine, which uses the closed-form
+ * adjugate up to 4 x 4. Larger matrices that are exactly Hermitian with a
+ * positive diagonal are inverted through a blocked Cholesky factorization,
+ * falling back to blocked LU with partial pivoting if that fails or the
+ * matrix is not Hermitian. Independent batches are spread across threads.
+ * The plan holds no state beyond the checks done at construction, so it is
+ * built on every call rather than cached.
+ *
+ * @tparam T1
+ *    Data type of A matrix
+ * @tparam RANK
+ *    Rank of A matrix
+ * @tparam ALGO
+ *    Inverse algorithm to use
+ */
+template <typename T1, int RANK, MatInverseAlgo_t ALGO = MAT_INVERSE_ALGO_LU>
+class matxInverseHostPlan_t {
+public:
+  /**
+   * Construct a host matrix inverse plan
+   *
+   * @param a_inv
+   *   Inverse of A (if it exists)
+   * @param a
+   *   Input tensor view
+   */
+  matxInverseHostPlan_t([[maybe_unused]] tensor_t<T1, RANK> a_inv,
+                        [[maybe_unused]] tensor_t<T1, RANK> a)
+  {
+    MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_matx_half_v<T1> && !is_complex_half_v<T1>,
+                           matxInvalidType,
+                           "Host inverse does not support half types");
+  }
+
+  /**
+   * Execute a matrix inverse on the host
+   *
+   * @param a_inv
+   *   Inverse of A
+   * @param a
+   *   Input tensor view. May be the same tensor as a_inv
+   * @param exec
+   *   Host executor
+   */
+  void Exec(tensor_t<T1, RANK> a_inv, tensor_t<T1, RANK> a,
+            const HostExecutor &exec)
+  {
+    MATX_ASSERT(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize);
+    for (int i = 0; i < RANK; i++) {
+      MATX_ASSERT(a.Size(i) == a_inv.Size(i), matxInvalidSize);
+    }
+
+    MATX_ASSERT(matxHostInv(a_inv, a, exec), matxLUError);
+  }
+};
+
+/**
+ * Perform a matrix inverse on the host
+ *
+ * See matxInverseHostPlan_t for how the method is chosen. Singular inputs
+ * raise matxLUError.
+ *
+ * @tparam T1
+ *   Data type of matrix A
+ * @tparam RANK
+ *   Rank of matrix A
+ * @tparam ALGO
+ *   Inverse algorithm to use
+ *
+ * @param a_inv
+ *   Inverse of A
+ * @param a
+ *   Input matrix A
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK, MatInverseAlgo_t ALGO = MAT_INVERSE_ALGO_LU>
+void inv(tensor_t<T1, RANK> a_inv, tensor_t<T1, RANK> a,
+         const HostExecutor &exec)
+{
+  // Batches use the small-matrix engine up to 8 x 8. A single matrix only
+  // goes there up to 4 x 4, where the closed-form adjugate beats LU
+  const index_t n = a.Size(RANK - 1);
+  if ((RANK >= 3 || n <= 4) && n == a.Size(RANK - 2) &&
+      matxSmallDispatch(n, [&](auto ic) {
+        inv_small<decltype(ic)::value>(a_inv, a, exec);
+      })) {
+    return;
+  }
+
+  matxInverseHostPlan_t<T1, RANK, ALGO> plan{a_inv, a};
+  plan.Exec(a_inv, a, exec);
+}
+
 } // end namespace matx
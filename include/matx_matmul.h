@@ -35,6 +35,8 @@
 #include "cublas_v2.h"
 #include "matx_dim.h"
 #include "matx_error.h"
+#include "matx_matmul_host.h"
+#include "matx_small_matrix.h"
 #include "matx_tensor.h"
 #include <cublasLt.h>
 
@@ -56,6 +58,7 @@ namespace matx {
 typedef enum {
   PROVIDER_TYPE_CUTLASS = 0,  ///< CUTLASS library
   PROVIDER_TYPE_CUBLASLT = 1, ///< cuBLASLt library
+  PROVIDER_TYPE_HOST = 2,     ///< Packed, cache-blocked host GEMM
   PROVIDER_TYPE_AUTO,         ///< Automatically select
 
   PROVIDER_TYPE_SENTINEL ///< Sentinel value. Do not use
@@ -96,6 +99,8 @@ struct MatMulParams_t {
   MatXDataType_t dtype;
   cublasOperation_t opA;
   cublasOperation_t opB;
+  bool conj_a = false;
+  bool conj_b = false;
 };
 
 template <typename T1, typename T2, typename T3, int RANK,
@@ -131,14 +136,21 @@ public:
    *   A matrix view
    * @param b
    *   B matrix view
+   * @param conj_a
+   *   Conjugate A while reading it. cuBLASLt requires A to be a transposed
+   *   (column-major) view so this maps to CUBLAS_OP_C
+   * @param conj_b
+   *   Conjugate B while reading it, with the same restrictions as conj_a
    *
    */
 #ifdef DOXYGEN_ONLY
-  matxMatMulHandle_t(tensor_t c, tensor_t a, tensor_t b)
+  matxMatMulHandle_t(tensor_t c, tensor_t a, tensor_t b, bool conj_a = false,
+                     bool conj_b = false)
   {
 #else
   matxMatMulHandle_t(tensor_t<T1, RANK> c, tensor_t<T2, RANK> a,
-                     tensor_t<T3, RANK> b)
+                     tensor_t<T3, RANK> b, bool conj_a = false,
+                     bool conj_b = false)
   {
 #endif
 
@@ -157,10 +169,13 @@ public:
     }
 
     // This must come before the things below to properly set class parameters
-    params_ = GetGemmParams(c, a, b);
+    params_ = GetGemmParams(c, a, b, conj_a, conj_b);
 
-    // // Workspace buffer
-    matxAlloc((void **)&workspace, workspaceSize, MATX_DEVICE_MEMORY);
+    // The host provider has no device state
+    if constexpr (PROV != PROVIDER_TYPE_HOST) {
+      // // Workspace buffer
+      matxAlloc((void **)&workspace, workspaceSize, MATX_DEVICE_MEMORY);
+    }
 
     if constexpr (PROV == PROVIDER_TYPE_CUBLASLT) {
       ConfigureCublasLt();
@@ -207,11 +222,14 @@ public:
 
   static MatMulParams_t GetGemmParams(tensor_t<T1, RANK> &c,
                                       const tensor_t<T2, RANK> &a,
-                                      const tensor_t<T3, RANK> &b)
+                                      const tensor_t<T3, RANK> &b,
+                                      bool conj_a = false, bool conj_b = false)
   {
     MatMulParams_t params;
     params.dtype = TypeToInt<T1>();
     params.prov = PROV;
+    params.conj_a = conj_a;
+    params.conj_b = conj_b;
 
     // Batches
     params.batch = 1;
@@ -268,8 +286,40 @@ public:
       params.c_rows = params.a_rows;
       params.c_cols = params.b_cols;
       params.ldc = c_comp.Stride(RANK - 2);
+
+      // cuBLAS can only conjugate while transposing, so conjugated inputs
+      // must be transposed views of row-major data
+      if (conj_a || conj_b) {
+        MATX_ASSERT_STR(c.Stride(RANK - 2) != 1 || c.Size(RANK - 1) == 1,
+                        matxNotSupported,
+                        "Conjugated GEMM inputs require a row-major C");
+      }
+      if (conj_a) {
+        MATX_ASSERT_STR(params.opA == CUBLAS_OP_T, matxNotSupported,
+                        "Conjugated A must be a transposed view");
+        params.opA = CUBLAS_OP_C;
+      }
+      if (conj_b) {
+        MATX_ASSERT_STR(params.opB == CUBLAS_OP_T, matxNotSupported,
+                        "Conjugated B must be a transposed view");
+        params.opB = CUBLAS_OP_C;
+      }
+    }
+    else if constexpr (PROV == PROVIDER_TYPE_HOST) {
+      // The host GEMM packs from arbitrary strides, so these only need to
+      // distinguish layouts in the cache key
+      params.opA = a_comp.Stride(RANK - 1) == 1 ? CUBLAS_OP_N : CUBLAS_OP_T;
+      params.opB = b_comp.Stride(RANK - 1) == 1 ? CUBLAS_OP_N : CUBLAS_OP_T;
+      params.m = a_comp.Size(RANK - 2);
+      params.n = b_comp.Size(RANK - 1);
+      params.k = a_comp.Size(RANK - 1);
+      params.lda = a_comp.Stride(RANK - 2);
+      params.ldb = b_comp.Stride(RANK - 2);
+      params.ldc = c_comp.Stride(RANK - 2);
     }
     else if constexpr (PROV == PROVIDER_TYPE_CUTLASS) {
+      MATX_ASSERT_STR(!conj_a && !conj_b, matxNotSupported,
+                      "CUTLASS does not support conjugated inputs");
       params.opA = CUBLAS_OP_N;
       params.opB = CUBLAS_OP_N;
       params.m = static_cast<int>(a_comp.Size(RANK - 2));
@@ -293,7 +343,9 @@ public:
    */
   ~matxMatMulHandle_t()
   {
-    matxFree(workspace);
+    if constexpr (PROV != PROVIDER_TYPE_HOST) {
+      matxFree(workspace);
+    }
 
     if constexpr (PROV == PROVIDER_TYPE_CUBLASLT) {
       cublasLtMatmulPreferenceDestroy(preference);
@@ -356,8 +408,122 @@ public:
   {
 #endif
 
-    // Reorder C/A to match cutlass API
-    MatMulDispatchA(a, b, c, stream, alpha, beta);
+    if constexpr (PROV == PROVIDER_TYPE_HOST) {
+      matxMatMulHost(c, a, b, alpha, beta, HostExecutor{}, matxNoEpilogue_t{},
+                     params_.conj_a, params_.conj_b);
+    }
+    else {
+      // Reorder C/A to match cutlass API
+      MatMulDispatchA(a, b, c, stream, alpha, beta);
+    }
+  }
+
+  /**
+   * Execute a matrix multiply on the host
+   *
+   * Same semantics as the stream version, but runs the packed host GEMM on
+   * the executor's threads. Only valid for PROVIDER_TYPE_HOST handles.
+   *
+   * @param c
+   *   Output tensor C
+   * @param a
+   *   Input tensor A
+   * @param b
+   *   Input tensor B
+   * @param exec
+   *   Host executor
+   * @param alpha
+   *   Alpha value
+   * @param beta
+   *   Beta value
+   */
+  inline void Exec(tensor_t<T1, RANK> &c, const tensor_t<T2, RANK> &a,
+                   const tensor_t<T3, RANK> &b, const HostExecutor &exec,
+                   float alpha = 1.0f, float beta = 0.0f)
+  {
+    MATX_STATIC_ASSERT_STR(PROV == PROVIDER_TYPE_HOST, matxInvalidParameter,
+                           "Host execution requires PROVIDER_TYPE_HOST");
+    matxMatMulHost(c, a, b, alpha, beta, exec, matxNoEpilogue_t{},
+                   params_.conj_a, params_.conj_b);
+  }
+
+  /**
+   * Execute a matrix multiply followed by an elementwise add
+   *
+   * Computes C = alpha * A * B + beta * C + epi, where epi is any operator
+   * with the shape of C or broadcastable to it. The host provider fuses epi
+   * into the GEMM by adding it to each output tile while the tile is still in
+   * cache. cuBLASLt and CUTLASS cannot evaluate arbitrary operators, so the
+   * device providers write beta * C + epi into C first and run the GEMM with
+   * beta = 1, letting the library epilogue do the add. C is not read back
+   * after the GEMM, but epi still costs one elementwise pass that writes C.
+   *
+   * @param c
+   *   Output tensor C
+   * @param a
+   *   Input tensor A
+   * @param b
+   *   Input tensor B
+   * @param epi
+   *   Operator added to the output
+   * @param stream
+   *   CUDA stream
+   * @param alpha
+   *   Alpha value
+   * @param beta
+   *   Beta value
+   */
+  template <typename Epi,
+            std::enable_if_t<is_matx_op<Epi>(), bool> = true>
+  inline void Exec(tensor_t<T1, RANK> &c, const tensor_t<T2, RANK> &a,
+                   const tensor_t<T3, RANK> &b, const Epi &epi,
+                   cudaStream_t stream, float alpha = 1.0f, float beta = 0.0f)
+  {
+    if constexpr (PROV == PROVIDER_TYPE_HOST) {
+      matxMatMulHost(c, a, b, alpha, beta, HostExecutor{}, epi, params_.conj_a,
+                     params_.conj_b);
+    }
+    else {
+      // Stage epi in C so the GEMM's beta term adds it on the way out
+      if (beta == 0.0f) {
+        (c = zeros<T1>(c.Shape()) + epi).run(stream);
+      }
+      else {
+        (c = static_cast<T1>(beta) * c + epi).run(stream);
+      }
+      MatMulDispatchA(a, b, c, stream, alpha, 1.0f);
+    }
+  }
+
+  /**
+   * Execute a matrix multiply with a fused elementwise epilogue on the host
+   *
+   * @param c
+   *   Output tensor C
+   * @param a
+   *   Input tensor A
+   * @param b
+   *   Input tensor B
+   * @param epi
+   *   Operator added to the output
+   * @param exec
+   *   Host executor
+   * @param alpha
+   *   Alpha value
+   * @param beta
+   *   Beta value
+   */
+  template <typename Epi,
+            std::enable_if_t<is_matx_op<Epi>(), bool> = true>
+  inline void Exec(tensor_t<T1, RANK> &c, const tensor_t<T2, RANK> &a,
+                   const tensor_t<T3, RANK> &b, const Epi &epi,
+                   const HostExecutor &exec, float alpha = 1.0f,
+                   float beta = 0.0f)
+  {
+    MATX_STATIC_ASSERT_STR(PROV == PROVIDER_TYPE_HOST, matxInvalidParameter,
+                           "Host execution requires PROVIDER_TYPE_HOST");
+    matxMatMulHost(c, a, b, alpha, beta, exec, epi, params_.conj_a,
+                   params_.conj_b);
   }
 
 private:
@@ -879,7 +1045,7 @@ struct MatMulParamsKeyEq {
            l.c_cols == t.c_cols && l.stream == t.stream && l.lda == t.lda &&
            l.ldb == t.ldb && l.ldc == t.ldc && l.batch == t.batch &&
            l.prov == t.prov && l.dtype == t.dtype && l.opA == t.opA &&
-           l.opB == t.opB;
+           l.opB == t.opB && l.conj_a == t.conj_a && l.conj_b == t.conj_b;
   }
 };
 
@@ -926,6 +1092,13 @@ void matmul(tensor_t<T1, RANK> c, const tensor_t<T2, RANK> &a,
             const tensor_t<T3, RANK> &b, cudaStream_t stream = 0,
             float alpha = 1.0, float beta = 0.0)
 {
+  // Batches of tiny matrices are faster one per thread than through a plan
+  if constexpr (PROV != PROVIDER_TYPE_HOST) {
+    if (matxMatMulSmallTry(c, a, b, stream, alpha, beta)) {
+      return;
+    }
+  }
+
   // Get parameters required by these tensors
   auto params =
       matxMatMulHandle_t<T1, T2, T3, RANK, PROV>::GetGemmParams(c, a, b);
@@ -947,4 +1120,358 @@ void matmul(tensor_t<T1, RANK> c, const tensor_t<T2, RANK> &a,
   }
 }
 
+/**
+ * Run a GEMM on the host
+ *
+ * Host version of matmul using the packed, cache-blocked host GEMM. The
+ * host GEMM keeps no plan state, so no cache lookup is done. Rank 3 and 4
+ * tensors are batched, with the batch and the blocks of C spread across the
+ * executor's threads.
+ *
+ * @tparam T1
+ *    Data type of C matrix
+ * @tparam T2
+ *    Data type of A matrix
+ * @tparam T3
+ *    Data type of B matrix
+ * @tparam RANK
+ *    Rank of A/B/C matrices
+ *
+ * @param c
+ *   C matrix view
+ * @param a
+ *   A matrix view
+ * @param b
+ *   B matrix view
+ * @param exec
+ *   Host executor
+ * @param alpha
+ *   Scalar multiplier to apply to matrix A
+ * @param beta
+ *   Scalar multiplier to apply to matrix C on input
+ */
+template <typename T1, typename T2, typename T3, int RANK>
+void matmul(tensor_t<T1, RANK> c, const tensor_t<T2, RANK> &a,
+            const tensor_t<T3, RANK> &b, const HostExecutor &exec,
+            float alpha = 1.0, float beta = 0.0)
+{
+  // Batch dimensions must match exactly
+  for (int i = 0; i < RANK - 2; i++) {
+    MATX_ASSERT(a.Size(i) == b.Size(i), matxInvalidSize);
+    MATX_ASSERT(a.Size(i) == c.Size(i), matxInvalidSize);
+  }
+
+  if (matxMatMulSmallTry(c, a, b, exec, alpha, beta)) {
+    return;
+  }
+
+  matxMatMulHost(c, a, b, alpha, beta, exec);
+}
+
+/**
+ * Run a GEMM followed by an elementwise add
+ *
+ * Computes C = alpha * A * B + beta * C + epi, where epi is any operator with
+ * the shape of C or broadcastable to it, such as a bias or a scaled identity.
+ * For batches of small matrices epi is fused into the small-matrix kernel.
+ * Otherwise the library GEMMs cannot evaluate arbitrary operators, so epi is
+ * written into C ahead of the GEMM and picked up through its beta term. That
+ * avoids a read-modify-write of C after the GEMM, but the prefill is still a
+ * separate elementwise pass rather than a fused epilogue.
+ *
+ * @tparam T1
+ *    Data type of C matrix
+ * @tparam T2
+ *    Data type of A matrix
+ * @tparam T3
+ *    Data type of B matrix
+ * @tparam RANK
+ *    Rank of A/B/C matrices
+ * @tparam Epi
+ *    Post-op operator type
+ * @tparam PROV
+ *    Provider type chosen from MatXMatMulProvider_t type
+ *
+ * @param c
+ *   C matrix view
+ * @param a
+ *   A matrix view
+ * @param b
+ *   B matrix view
+ * @param epi
+ *   Operator added to the output
+ * @param stream
+ *   CUDA stream
+ * @param alpha
+ *   Scalar multiplier to apply to matrix A
+ * @param beta
+ *   Scalar multiplier to apply to matrix C on input
+ */
+template <typename T1, typename T2, typename T3, int RANK, typename Epi,
+          MatXMatMulProvider_t PROV = PROVIDER_TYPE_CUBLASLT,
+          std::enable_if_t<is_matx_op<Epi>(), bool> = true>
+void matmul(tensor_t<T1, RANK> c, const tensor_t<T2, RANK> &a,
+            const tensor_t<T3, RANK> &b, const Epi &epi,
+            cudaStream_t stream = 0, float alpha = 1.0, float beta = 0.0)
+{
+  if constexpr (PROV != PROVIDER_TYPE_HOST) {
+    if (matxMatMulSmallTry(c, a, b, stream, alpha, beta, epi)) {
+      return;
+    }
+  }
+
+  auto params =
+      matxMatMulHandle_t<T1, T2, T3, RANK, PROV>::GetGemmParams(c, a, b);
+  params.stream = stream;
+
+  auto ret = gemm_cache.Lookup(params);
+  if (ret == std::nullopt) {
+    auto tmp = new matxMatMulHandle_t<T1, T2, T3, RANK, PROV>{c, a, b};
+    gemm_cache.Insert(params, static_cast<void *>(tmp));
+    tmp->Exec(c, a, b, epi, stream, alpha, beta);
+  }
+  else {
+    auto gemm_type =
+        static_cast<matxMatMulHandle_t<T1, T2, T3, RANK, PROV> *>(ret.value());
+    gemm_type->Exec(c, a, b, epi, stream, alpha, beta);
+  }
+}
+
+/**
+ * Run a GEMM with a fused elementwise epilogue on the host
+ *
+ * The epilogue is added to each output tile of the host GEMM while the tile
+ * is still in cache, so no extra pass over C is made.
+ *
+ * @param c
+ *   C matrix view
+ * @param a
+ *   A matrix view
+ * @param b
+ *   B matrix view
+ * @param epi
+ *   Operator added to the output
+ * @param exec
+ *   Host executor
+ * @param alpha
+ *   Scalar multiplier to apply to matrix A
+ * @param beta
+ *   Scalar multiplier to apply to matrix C on input
+ */
+template <typename T1, typename T2, typename T3, int RANK, typename Epi,
+          std::enable_if_t<is_matx_op<Epi>(), bool> = true>
+void matmul(tensor_t<T1, RANK> c, const tensor_t<T2, RANK> &a,
+            const tensor_t<T3, RANK> &b, const Epi &epi,
+            const HostExecutor &exec, float alpha = 1.0, float beta = 0.0)
+{
+  for (int i = 0; i < RANK - 2; i++) {
+    MATX_ASSERT(a.Size(i) == b.Size(i), matxInvalidSize);
+    MATX_ASSERT(a.Size(i) == c.Size(i), matxInvalidSize);
+  }
+
+  if (matxMatMulSmallTry(c, a, b, exec, alpha, beta, epi)) {
+    return;
+  }
+
+  matxMatMulHost(c, a, b, alpha, beta, exec, epi);
+}
+
+/**
+ * Describes how a matmul input operator maps onto a GEMM operand. Tensors,
+ * conj() of a tensor, and hermitianT() of a rank-2 tensor are read in place
+ * through strides and a conjugate flag. Any other operator is materialized.
+ */
+template <typename Op> struct MatMulOperand_t {
+  static constexpr bool direct = false;
+  static constexpr bool conj = false;
+};
+
+template <typename T, int RANK> struct MatMulOperand_t<tensor_t<T, RANK>> {
+  static constexpr bool direct = true;
+  static constexpr bool conj = false;
+  static auto View(const tensor_t<T, RANK> &op) { return op; }
+};
+
+template <typename T>
+struct MatMulOperand_t<HermitianTransOp<tensor_t<T, 2>, 2>> {
+  static constexpr bool direct = true;
+  static constexpr bool conj = is_complex_v<T>;
+  static auto View(const HermitianTransOp<tensor_t<T, 2>, 2> &op)
+  {
+    const auto &t = op.Operand();
+    return tensor_t<T, 2>(t.Data(), t.Shape(), {t.Stride(0), t.Stride(1)})
+        .Permute({1, 0});
+  }
+};
+
+template <typename T, int RANK>
+struct MatMulOperand_t<matxUnaryOp<tensor_t<T, RANK>, ConjOp<T>>> {
+  static constexpr bool direct = true;
+  static constexpr bool conj = is_complex_v<T>;
+  static auto View(const matxUnaryOp<tensor_t<T, RANK>, ConjOp<T>> &op)
+  {
+    const auto &t = op.Operand();
+    index_t strides[RANK];
+    for (int i = 0; i < RANK; i++) {
+      strides[i] = t.Stride(i);
+    }
+    return tensor_t<T, RANK>(t.Data(), t.Shape(), strides);
+  }
+};
+
+/**
+ * Resolve a matmul input into a tensor and conjugate flag
+ *
+ * in_place(view) reports whether the provider can read a conjugated view
+ * directly. If it cannot, or the operator has no tensor form, the operator is
+ * evaluated into a temporary tensor on ex.
+ */
+template <typename Op, typename InPlace, typename Executor>
+auto MatMulResolveOperand(const Op &op, InPlace &&in_place, Executor &&ex)
+{
+  using traits = MatMulOperand_t<Op>;
+  using T = typename Op::scalar_type;
+  constexpr int RANK = Op::Rank();
+
+  if constexpr (traits::direct) {
+    auto view = traits::View(op);
+    if (!traits::conj || in_place(view)) {
+      return std::make_pair(view, traits::conj);
+    }
+  }
+
+  tensorShape_t<RANK> s;
+  for (int i = 0; i < RANK; i++) {
+    s.SetSize(i, op.Size(i));
+  }
+
+  tensor_t<T, RANK> tmp{s};
+  (tmp = op).run(ex);
+  return std::make_pair(tmp, false);
+}
+
+/**
+ * Run a GEMM on transposed, conjugated or other operator inputs
+ *
+ * Permuted views, conj() of a tensor and hermitianT() of a rank-2 tensor are
+ * mapped onto the provider's transpose and conjugate flags so no temporary is
+ * made. cuBLASLt can only conjugate while transposing, so conj() of a
+ * row-major tensor and any other operator are materialized before the GEMM.
+ *
+ * @tparam T1
+ *    Data type of C matrix
+ * @tparam RANK
+ *    Rank of A/B/C matrices
+ * @tparam OpA
+ *    Type of A operator
+ * @tparam OpB
+ *    Type of B operator
+ * @tparam PROV
+ *    Provider type chosen from MatXMatMulProvider_t type
+ *
+ * @param c
+ *   C matrix view
+ * @param a
+ *   A operator
+ * @param b
+ *   B operator
+ * @param stream
+ *   CUDA stream
+ * @param alpha
+ *   Scalar multiplier to apply to matrix A
+ * @param beta
+ *   Scalar multiplier to apply to matrix C on input
+ */
+template <typename T1, int RANK, typename OpA, typename OpB,
+          MatXMatMulProvider_t PROV = PROVIDER_TYPE_CUBLASLT,
+          std::enable_if_t<is_matx_op<OpA>() && is_matx_op<OpB>() &&
+                               !(is_tensor_view_t<OpA>() && is_tensor_view_t<OpB>()),
+                           bool> = true>
+void matmul(tensor_t<T1, RANK> c, const OpA &a, const OpB &b,
+            cudaStream_t stream = 0, float alpha = 1.0, float beta = 0.0)
+{
+  auto in_place = [&](const auto &v) {
+    if constexpr (PROV == PROVIDER_TYPE_HOST) {
+      return true;
+    }
+    else if constexpr (PROV == PROVIDER_TYPE_CUBLASLT) {
+      return (c.Stride(RANK - 2) != 1 || c.Size(RANK - 1) == 1) &&
+             v.Stride(RANK - 1) != 1 && v.Stride(RANK - 2) == 1;
+    }
+    else {
+      return false;
+    }
+  };
+
+  auto [av, conj_a] = MatMulResolveOperand(a, in_place, stream);
+  auto [bv, conj_b] = MatMulResolveOperand(b, in_place, stream);
+  using T2 = typename decltype(av)::scalar_type;
+  using T3 = typename decltype(bv)::scalar_type;
+
+  if (!conj_a && !conj_b) {
+    matmul<T1, T2, T3, RANK, PROV>(c, av, bv, stream, alpha, beta);
+    return;
+  }
+
+  auto params = matxMatMulHandle_t<T1, T2, T3, RANK, PROV>::GetGemmParams(
+      c, av, bv, conj_a, conj_b);
+  params.stream = stream;
+
+  auto ret = gemm_cache.Lookup(params);
+  if (ret == std::nullopt) {
+    auto tmp = new matxMatMulHandle_t<T1, T2, T3, RANK, PROV>{c, av, bv,
+                                                             conj_a, conj_b};
+    gemm_cache.Insert(params, static_cast<void *>(tmp));
+    tmp->Exec(c, av, bv, stream, alpha, beta);
+  }
+  else {
+    auto gemm_type =
+        static_cast<matxMatMulHandle_t<T1, T2, T3, RANK, PROV> *>(ret.value());
+    gemm_type->Exec(c, av, bv, stream, alpha, beta);
+  }
+}
+
+/**
+ * Run a GEMM on transposed, conjugated or other operator inputs on the host
+ *
+ * The host GEMM conjugates while packing and reads any strides, so tensors,
+ * conj() of a tensor and hermitianT() of a rank-2 tensor are never copied.
+ *
+ * @param c
+ *   C matrix view
+ * @param a
+ *   A operator
+ * @param b
+ *   B operator
+ * @param exec
+ *   Host executor
+ * @param alpha
+ *   Scalar multiplier to apply to matrix A
+ * @param beta
+ *   Scalar multiplier to apply to matrix C on input
+ */
+template <typename T1, int RANK, typename OpA, typename OpB,
+          std::enable_if_t<is_matx_op<OpA>() && is_matx_op<OpB>() &&
+                               !(is_tensor_view_t<OpA>() && is_tensor_view_t<OpB>()),
+                           bool> = true>
+void matmul(tensor_t<T1, RANK> c, const OpA &a, const OpB &b,
+            const HostExecutor &exec, float alpha = 1.0, float beta = 0.0)
+{
+  auto in_place = [](const auto &) { return true; };
+  auto [av, conj_a] = MatMulResolveOperand(a, in_place, exec);
+  auto [bv, conj_b] = MatMulResolveOperand(b, in_place, exec);
+
+  for (int i = 0; i < RANK - 2; i++) {
+    MATX_ASSERT(av.Size(i) == bv.Size(i), matxInvalidSize);
+    MATX_ASSERT(av.Size(i) == c.Size(i), matxInvalidSize);
+  }
+
+  if (!conj_a && !conj_b && matxMatMulSmallTry(c, av, bv, exec, alpha, beta)) {
+    return;
+  }
+
+  matxMatMulHost(c, av, bv, alpha, beta, exec, matxNoEpilogue_t{}, conj_a,
+                 conj_b);
+}
+
 } // end namespace matx
@@ -0,0 +1,566 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_tensor.h"
+#include "matx_type_utils.h"
+
+namespace matx {
+
+/**
+ * Blocking parameters for the host GEMM
+ *
+ * The MR x NR register tile is sized so the accumulators plus one broadcast
+ * A value and one B vector fit the vector register file; NR spans 64 bytes of
+ * the real value type so the inner loop maps onto whole SIMD registers.
+ * Complex types keep separate real and imaginary accumulators, so their NR is
+ * halved. The cache blocks keep an MC x KC block of packed A and a KC x NC
+ * panel of packed B resident in L2 while the micro-kernel streams over them.
+ */
+template <typename T> struct matxHostGemmBlocking_t {
+  using value_type = value_type_t<T>;
+#if defined(__AVX512F__)
+  // 32 vector registers leave room for twice the rows
+  static constexpr index_t MR = 8;
+#else
+  static constexpr index_t MR = 4;
+#endif
+  static constexpr index_t NR = static_cast<index_t>(
+      64 / sizeof(value_type) / (is_complex_v<T> ? 2 : 1));
+  static constexpr index_t MC = 128;
+  static constexpr index_t KC = 256;
+  static constexpr index_t NC = 256;
+};
+
+/**
+ * Strided view of one matrix in a (possibly batched) GEMM operand
+ */
+template <typename T> struct matxHostGemmOperand_t {
+  T *data;
+  index_t rs; // Row stride
+  index_t cs; // Column stride
+  bool conj = false;
+
+  T operator()(index_t r, index_t c) const { return data[r * rs + c * cs]; }
+};
+
+/**
+ * Widen an fp16 or bf16 value to float on the host
+ *
+ * fp16 uses the F16C conversion instruction when it is available and bf16 is
+ * widened by shifting its bits into the upper half of a float, avoiding the
+ * generic software conversion on the packing path.
+ */
+template <typename H> inline float matxHostHalfToFloat(const H &h)
+{
+  uint16_t bits;
+  static_assert(sizeof(H) == sizeof(bits));
+  std::memcpy(&bits, &h, sizeof(bits));
+  if constexpr (std::is_same_v<H, matxBf16>) {
+    const uint32_t u = static_cast<uint32_t>(bits) << 16;
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+  }
+  else {
+#if defined(__F16C__)
+    return _cvtsh_ss(bits);
+#else
+    return static_cast<float>(h);
+#endif
+  }
+}
+
+/**
+ * Convert a GEMM input element to the accumulation type
+ */
+template <typename TAcc, typename T> inline TAcc matxHostGemmLoad(const T &v)
+{
+  if constexpr (is_matx_half_v<T>) {
+    return static_cast<TAcc>(matxHostHalfToFloat(v));
+  }
+  else if constexpr (is_complex_half_v<T>) {
+    return TAcc(matxHostHalfToFloat(v.x), matxHostHalfToFloat(v.y));
+  }
+  else {
+    return static_cast<TAcc>(v);
+  }
+}
+
+/**
+ * Strided GEMM operand with a per-row or per-column mean subtracted on read
+ *
+ * Lets covariance-style products center their input while it is packed
+ * instead of materializing the deviations.
+ */
+template <typename T, typename TAcc> struct matxHostGemmCenteredOperand_t {
+  const T *data;
+  index_t rs;        // Row stride
+  index_t cs;        // Column stride
+  bool conj;         // Conjugate after centering
+  const TAcc *mean;  // Mean for each row or column
+  bool mean_on_row;  // Index mean by row instead of column
+
+  TAcc operator()(index_t r, index_t c) const
+  {
+    return matxHostGemmLoad<TAcc>(data[r * rs + c * cs]) -
+           mean[mean_on_row ? r : c];
+  }
+};
+
+/**
+ * Pack an mc x kc block of A into MR-row slivers
+ *
+ * Each sliver stores MR consecutive rows column by column, zero padded past
+ * the edge of the matrix, so the micro-kernel reads A with unit stride.
+ * Complex data is split into a real plane followed by an imaginary plane per
+ * sliver.
+ */
+template <typename TC, typename OpA>
+void matxHostGemmPackA(value_type_t<TC> *dst, const OpA &a, index_t i0,
+                       index_t p0, index_t mc, index_t kc)
+{
+  using blk = matxHostGemmBlocking_t<TC>;
+  using value_type = value_type_t<TC>;
+  constexpr index_t MR = blk::MR;
+  constexpr index_t planes = is_complex_v<TC> ? 2 : 1;
+
+  for (index_t ir = 0; ir < mc; ir += MR) {
+    value_type *s = dst + (ir / MR) * (MR * kc * planes);
+    const index_t mr = std::min(MR, mc - ir);
+    for (index_t p = 0; p < kc; p++) {
+      for (index_t ii = 0; ii < MR; ii++) {
+        if (ii < mr) {
+          const TC v = matxHostGemmLoad<TC>(a(i0 + ir + ii, p0 + p));
+          if constexpr (is_complex_v<TC>) {
+            s[p * MR + ii] = v.real();
+            s[MR * kc + p * MR + ii] = a.conj ? -v.imag() : v.imag();
+          }
+          else {
+            s[p * MR + ii] = v;
+          }
+        }
+        else {
+          s[p * MR + ii] = 0;
+          if constexpr (is_complex_v<TC>) {
+            s[MR * kc + p * MR + ii] = 0;
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Pack a kc x nc panel of B into NR-column slivers. Layout mirrors
+ * matxHostGemmPackA with rows and columns exchanged.
+ */
+template <typename TC, typename OpB>
+void matxHostGemmPackB(value_type_t<TC> *dst, const OpB &b, index_t p0,
+                       index_t j0, index_t kc, index_t nc)
+{
+  using blk = matxHostGemmBlocking_t<TC>;
+  using value_type = value_type_t<TC>;
+  constexpr index_t NR = blk::NR;
+  constexpr index_t planes = is_complex_v<TC> ? 2 : 1;
+
+  for (index_t jr = 0; jr < nc; jr += NR) {
+    value_type *s = dst + (jr / NR) * (NR * kc * planes);
+    const index_t nr = std::min(NR, nc - jr);
+    for (index_t p = 0; p < kc; p++) {
+      for (index_t jj = 0; jj < NR; jj++) {
+        if (jj < nr) {
+          const TC v = matxHostGemmLoad<TC>(b(p0 + p, j0 + jr + jj));
+          if constexpr (is_complex_v<TC>) {
+            s[p * NR + jj] = v.real();
+            s[NR * kc + p * NR + jj] = b.conj ? -v.imag() : v.imag();
+          }
+          else {
+            s[p * NR + jj] = v;
+          }
+        }
+        else {
+          s[p * NR + jj] = 0;
+          if constexpr (is_complex_v<TC>) {
+            s[NR * kc + p * NR + jj] = 0;
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Register-tiled micro-kernel: acc = A_sliver * B_sliver over kc
+ *
+ * The accumulators live in a fixed-size local array indexed [MR][NR]. Each
+ * step of the outer K loop is a rank-1 update: every element of the B row
+ * is broadcast against the contiguous MR-long A column, with the MR loop
+ * innermost, so compilers vectorize across MR and keep the whole tile in
+ * registers. With the rows outermost, GCC at -O3 vectorizes the K loop with
+ * shuffles instead, which is several times slower. For complex types the
+ * planes are combined with four real FMAs per element.
+ */
+template <typename TC>
+inline void matxHostGemmMicroKernel(index_t kc, const value_type_t<TC> *a,
+                                    const value_type_t<TC> *b,
+                                    value_type_t<TC> *acc)
+{
+  using blk = matxHostGemmBlocking_t<TC>;
+  using value_type = value_type_t<TC>;
+  constexpr index_t MR = blk::MR;
+  constexpr index_t NR = blk::NR;
+
+  if constexpr (is_complex_v<TC>) {
+    value_type cr[MR][NR] = {};
+    value_type ci[MR][NR] = {};
+    const value_type *ai = a + MR * kc;
+    const value_type *bi = b + NR * kc;
+    for (index_t p = 0; p < kc; p++) {
+      const value_type *apr = a + p * MR;
+      const value_type *api = ai + p * MR;
+      const value_type *bpr = b + p * NR;
+      const value_type *bpi = bi + p * NR;
+      for (index_t jj = 0; jj < NR; jj++) {
+        const value_type br = bpr[jj];
+        const value_type bim = bpi[jj];
+        for (index_t ii = 0; ii < MR; ii++) {
+          cr[ii][jj] += apr[ii] * br - api[ii] * bim;
+          ci[ii][jj] += apr[ii] * bim + api[ii] * br;
+        }
+      }
+    }
+
+    for (index_t ii = 0; ii < MR; ii++) {
+      for (index_t jj = 0; jj < NR; jj++) {
+        acc[ii * NR + jj] = cr[ii][jj];
+        acc[MR * NR + ii * NR + jj] = ci[ii][jj];
+      }
+    }
+  }
+  else {
+    value_type c[MR][NR] = {};
+    for (index_t p = 0; p < kc; p++) {
+      const value_type *ap = a + p * MR;
+      const value_type *bp = b + p * NR;
+      for (index_t jj = 0; jj < NR; jj++) {
+        const value_type bv = bp[jj];
+        for (index_t ii = 0; ii < MR; ii++) {
+          c[ii][jj] += ap[ii] * bv;
+        }
+      }
+    }
+
+    for (index_t ii = 0; ii < MR; ii++) {
+      for (index_t jj = 0; jj < NR; jj++) {
+        acc[ii * NR + jj] = c[ii][jj];
+      }
+    }
+  }
+}
+
+/**
+ * Host GEMM over strided operands: C = alpha * A * B + beta * C + E
+ *
+ * Work is split into tasks of one MC x NC block of C per batch so that no
+ * synchronization is needed between threads. Each task walks K in KC steps,
+ * packing its A block and B panel into thread-local buffers, and runs the
+ * micro-kernel over every MR x NR tile. beta is applied on the first K step
+ * only, and C is never read when beta is zero. The epilogue E is added on the
+ * last K step while the tile is still in cache.
+ *
+ * Accumulation is done in promote_matx_half_t<TC>, and fp16/bf16 inputs are
+ * widened while they are packed. When C itself is fp16/bf16 the block of C is
+ * accumulated in a thread-local float buffer and rounded once at the end, so
+ * partial sums are never stored at half precision.
+ *
+ * @param c
+ *   Output operand getter for batch b
+ * @param a
+ *   A operand getter for batch b
+ * @param b
+ *   B operand getter for batch b
+ * @param m
+ *   Rows of C
+ * @param n
+ *   Columns of C
+ * @param k
+ *   Inner dimension
+ * @param batches
+ *   Number of independent GEMMs
+ * @param alpha
+ *   Scale on A * B
+ * @param beta
+ *   Scale on C
+ * @param exec
+ *   Host executor
+ * @param epi
+ *   Epilogue called as epi(b, i, j), or matxNoEpilogue_t
+ * @param upper
+ *   Only compute the upper triangle of C, as in SYRK/HERK. Register tiles
+ *   wholly below the diagonal are skipped and their contents are undefined
+ */
+template <typename TC, typename CGet, typename AGet, typename BGet,
+          typename Epi = matxNoEpilogue_t>
+void matxHostGemm(CGet c, AGet a, BGet b, index_t m, index_t n, index_t k,
+                  index_t batches, value_type_t<promote_matx_half_t<TC>> alpha,
+                  value_type_t<promote_matx_half_t<TC>> beta,
+                  const HostExecutor &exec, Epi epi = {}, bool upper = false)
+{
+  using TAcc = promote_matx_half_t<TC>;
+  using blk = matxHostGemmBlocking_t<TAcc>;
+  using value_type = value_type_t<TAcc>;
+  constexpr bool has_epi = !std::is_same_v<Epi, matxNoEpilogue_t>;
+  constexpr bool widen_c = !std::is_same_v<TC, TAcc>;
+  constexpr index_t MR = blk::MR;
+  constexpr index_t NR = blk::NR;
+  constexpr index_t MC = blk::MC;
+  constexpr index_t KC = blk::KC;
+  constexpr index_t NC = blk::NC;
+  constexpr index_t planes = is_complex_v<TAcc> ? 2 : 1;
+
+  const index_t mb = (m + MC - 1) / MC;
+  const index_t nb = (n + NC - 1) / NC;
+
+  exec.ParallelFor(batches * mb * nb, [&](index_t item) {
+    const index_t bidx = item / (mb * nb);
+    const index_t rem = item - bidx * mb * nb;
+    const index_t i0 = (rem / nb) * MC;
+    const index_t j0 = (rem % nb) * NC;
+    const index_t mc = std::min(MC, m - i0);
+    const index_t nc = std::min(NC, n - j0);
+    if (upper && i0 >= j0 + nc) {
+      return;
+    }
+
+    const auto cm = c(bidx);
+    const auto am = a(bidx);
+    const auto bm = b(bidx);
+
+    // Accumulate into a float copy of the block when C is half precision
+    thread_local std::vector<TAcc> cbuf;
+    TAcc *cacc = nullptr;
+    index_t crs = 0;
+    index_t ccs = 0;
+    value_type b_first = beta;
+    if constexpr (widen_c) {
+      cbuf.resize(MC * NC);
+      cacc = cbuf.data();
+      crs = NC;
+      ccs = 1;
+      b_first = value_type(1);
+      for (index_t i = 0; i < mc; i++) {
+        for (index_t j = 0; j < nc; j++) {
+          cacc[i * NC + j] =
+              beta == value_type(0)
+                  ? TAcc(0)
+                  : matxHostGemmLoad<TAcc>(
+                        cm.data[(i0 + i) * cm.rs + (j0 + j) * cm.cs]) *
+                        beta;
+        }
+      }
+    }
+    else {
+      cacc = cm.data + i0 * cm.rs + j0 * cm.cs;
+      crs = cm.rs;
+      ccs = cm.cs;
+    }
+
+    if (k == 0) {
+      for (index_t i = 0; i < mc; i++) {
+        for (index_t j = 0; j < nc; j++) {
+          TAcc &cv = cacc[i * crs + j * ccs];
+          if constexpr (!widen_c) {
+            cv = beta == value_type(0) ? TAcc(0) : static_cast<TAcc>(cv * beta);
+          }
+          if constexpr (has_epi) {
+            cv += static_cast<TAcc>(epi(bidx, i0 + i, j0 + j));
+          }
+        }
+      }
+    }
+
+    thread_local std::vector<value_type> apack;
+    thread_local std::vector<value_type> bpack;
+    apack.resize(((MC + MR - 1) / MR) * MR * KC * planes);
+    bpack.resize(((NC + NR - 1) / NR) * NR * KC * planes);
+    value_type acc[MR * NR * planes];
+
+    for (index_t p0 = 0; p0 < k; p0 += KC) {
+      const index_t kc = std::min(KC, k - p0);
+      const value_type b_eff = p0 == 0 ? b_first : value_type(1);
+      [[maybe_unused]] const bool last = p0 + kc == k;
+      matxHostGemmPackB<TAcc>(bpack.data(), bm, p0, j0, kc, nc);
+      matxHostGemmPackA<TAcc>(apack.data(), am, i0, p0, mc, kc);
+
+      for (index_t jr = 0; jr < nc; jr += NR) {
+        const value_type *bs = bpack.data() + (jr / NR) * (NR * kc * planes);
+        const index_t nr = std::min(NR, nc - jr);
+        for (index_t ir = 0; ir < mc; ir += MR) {
+          const value_type *as =
+              apack.data() + (ir / MR) * (MR * kc * planes);
+          const index_t mr = std::min(MR, mc - ir);
+          if (upper && i0 + ir >= j0 + jr + nr) {
+            continue;
+          }
+
+          matxHostGemmMicroKernel<TAcc>(kc, as, bs, acc);
+
+          for (index_t ii = 0; ii < mr; ii++) {
+            TAcc *crow = cacc + (ir + ii) * crs + jr * ccs;
+            for (index_t jj = 0; jj < nr; jj++) {
+              TAcc v;
+              if constexpr (is_complex_v<TAcc>) {
+                v = TAcc(acc[ii * NR + jj], acc[MR * NR + ii * NR + jj]);
+              }
+              else {
+                v = acc[ii * NR + jj];
+              }
+
+              TAcc &cv = crow[jj * ccs];
+              if (b_eff == value_type(0)) {
+                cv = v * alpha;
+              }
+              else {
+                cv = v * alpha + cv * b_eff;
+              }
+              if constexpr (has_epi) {
+                if (last) {
+                  cv += static_cast<TAcc>(
+                      epi(bidx, i0 + ir + ii, j0 + jr + jj));
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+
+    if constexpr (widen_c) {
+      for (index_t i = 0; i < mc; i++) {
+        for (index_t j = 0; j < nc; j++) {
+          cm.data[(i0 + i) * cm.rs + (j0 + j) * cm.cs] =
+              static_cast<TC>(cacc[i * NC + j]);
+        }
+      }
+    }
+  });
+}
+
+/**
+ * Offset of batch b in a tensor whose dimensions above the last two are
+ * batch dimensions
+ */
+template <typename TensorType>
+inline index_t matxHostGemmBatchOffset(const TensorType &t, index_t b)
+{
+  constexpr int RANK = TensorType::Rank();
+  if constexpr (RANK == 2) {
+    return 0;
+  }
+  else if constexpr (RANK == 3) {
+    return b * t.Stride(0);
+  }
+  else {
+    MATX_STATIC_ASSERT(RANK == 4, matxInvalidDim);
+    return (b / t.Size(1)) * t.Stride(0) + (b % t.Size(1)) * t.Stride(1);
+  }
+}
+
+/**
+ * Host matrix multiply on tensors of rank 2 through 4
+ *
+ * Operands may have any row and column strides, so transposed (permuted)
+ * views are packed directly without a copy. An optional operator epilogue
+ * with the shape of C (or broadcastable to it) is added to the output, and
+ * either input may be conjugated while it is packed. fp16 and bf16 operands
+ * are read directly and accumulated in float.
+ */
+template <typename T1, typename T2, typename T3, int RANK,
+          typename Epi = matxNoEpilogue_t>
+void matxMatMulHost(tensor_t<T1, RANK> &c, const tensor_t<T2, RANK> &a,
+                    const tensor_t<T3, RANK> &b, float alpha, float beta,
+                    const HostExecutor &exec, const Epi &epi = {},
+                    bool conj_a = false, bool conj_b = false)
+{
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(a.Size(RANK - 1) == b.Size(RANK - 2), matxInvalidSize);
+  MATX_ASSERT(c.Size(RANK - 1) == b.Size(RANK - 1), matxInvalidSize);
+  MATX_ASSERT(c.Size(RANK - 2) == a.Size(RANK - 2), matxInvalidSize);
+
+  const index_t batches = batch_count(c, 2);
+  auto cget = [&](index_t bi) {
+    return matxHostGemmOperand_t<T1>{c.Data() + matxHostGemmBatchOffset(c, bi),
+                                     c.Stride(RANK - 2), c.Stride(RANK - 1)};
+  };
+  auto aget = [&](index_t bi) {
+    return matxHostGemmOperand_t<T2>{a.Data() + matxHostGemmBatchOffset(a, bi),
+                                     a.Stride(RANK - 2), a.Stride(RANK - 1),
+                                     conj_a};
+  };
+  auto bget = [&](index_t bi) {
+    return matxHostGemmOperand_t<T3>{b.Data() + matxHostGemmBatchOffset(b, bi),
+                                     b.Stride(RANK - 2), b.Stride(RANK - 1),
+                                     conj_b};
+  };
+
+  const auto m = c.Size(RANK - 2);
+  const auto n = c.Size(RANK - 1);
+  const auto k = a.Size(RANK - 1);
+  const auto salpha =
+      static_cast<value_type_t<promote_matx_half_t<T1>>>(alpha);
+  const auto sbeta = static_cast<value_type_t<promote_matx_half_t<T1>>>(beta);
+  if constexpr (std::is_same_v<Epi, matxNoEpilogue_t>) {
+    matxHostGemm<T1>(cget, aget, bget, m, n, k, batches, salpha, sbeta, exec);
+  }
+  else {
+    auto eget = [&](index_t bi, index_t i, index_t j) {
+      return batch_get_value2(epi, c, bi, i, j);
+    };
+    matxHostGemm<T1>(cget, aget, bget, m, n, k, batches, salpha, sbeta, exec,
+                     eget);
+  }
+}
+
+} // end namespace matx
@@ -33,9 +33,13 @@
 #pragma once
 
 #include "matx_error.h"
+#include "matx_exec_host.h"
 #include "matx_shape.h"
 #include "matx_tensor_ops.h"
 #include <cuda/std/complex>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <curand_kernel.h>
 #include <type_traits>
 
@@ -351,9 +355,561 @@ public:
   }
 };
 
+/**
+ * Output block of one Philox4x32-10 evaluation
+ */
+struct matxPhiloxBlock_t {
+  uint32_t v[4];
+};
+
+constexpr int MATX_PHILOX_ROUNDS = 10;
+constexpr uint32_t MATX_PHILOX_W0 = 0x9E3779B9u;
+constexpr uint32_t MATX_PHILOX_W1 = 0xBB67AE85u;
+
+/**
+ * One Philox4x32 round of a counter under the round key k0, k1
+ */
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void
+matxPhiloxRound(uint32_t &c0, uint32_t &c1, uint32_t &c2, uint32_t &c3,
+                uint32_t k0, uint32_t k1)
+{
+  const uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * c0;
+  const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * c2;
+  const uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+  const uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+  c1 = static_cast<uint32_t>(p1);
+  c3 = static_cast<uint32_t>(p0);
+  c0 = n0;
+  c2 = n2;
+}
+
+/**
+ * Philox4x32-10 counter-based generator
+ *
+ * Bijectively scrambles a 128-bit counter under a 64-bit key with ten rounds
+ * of the Philox mixing function from Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3", SC 2011. There is no state: any element of
+ * the sequence is computed directly from the key and its position, using
+ * only integer arithmetic, so host and device produce identical bits.
+ *
+ * @param counter
+ *   Position in the sequence
+ * @param key
+ *   Key, usually the seed
+ * @returns
+ *   Four independent 32-bit values
+ */
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ matxPhiloxBlock_t
+matxPhilox4x32_10(uint64_t counter, uint64_t key)
+{
+  uint32_t c0 = static_cast<uint32_t>(counter);
+  uint32_t c1 = static_cast<uint32_t>(counter >> 32);
+  uint32_t c2 = 0;
+  uint32_t c3 = 0;
+  uint32_t k0 = static_cast<uint32_t>(key);
+  uint32_t k1 = static_cast<uint32_t>(key >> 32);
+
+#pragma unroll
+  for (int round = 0; round < MATX_PHILOX_ROUNDS; round++) {
+    matxPhiloxRound(c0, c1, c2, c3, k0, k1);
+    k0 += MATX_PHILOX_W0;
+    k1 += MATX_PHILOX_W1;
+  }
+
+  return {{c0, c1, c2, c3}};
+}
+
+/**
+ * Uniform float in (0, 1] from the top 24 bits of a Philox output
+ */
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float
+matxPhiloxUniformFloat(uint32_t x)
+{
+  return static_cast<float>((x >> 8) + 1) * (1.0f / 16777216.0f);
+}
+
+/**
+ * Uniform double in (0, 1] from 53 bits of two Philox outputs
+ */
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ double
+matxPhiloxUniformDouble(uint32_t hi, uint32_t lo)
+{
+  const uint64_t v =
+      (static_cast<uint64_t>(hi) << 21) ^ static_cast<uint64_t>(lo >> 11);
+  return static_cast<double>(v + 1) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * Natural log of a positive normal number
+ *
+ * Splits x into m * 2^e with m in [sqrt(1/2), sqrt(2)) and evaluates log(m)
+ * with the atanh series. There are no branches or table lookups, so the
+ * host compiler can vectorize it, and host and device evaluate the same
+ * arithmetic rather than their own math libraries.
+ */
+template <typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T matxRandLog(T x)
+{
+  using bits_t = std::conditional_t<std::is_same_v<T, float>, uint32_t, uint64_t>;
+  constexpr int MANT = std::is_same_v<T, float> ? 23 : 52;
+  constexpr bits_t BIAS = std::is_same_v<T, float> ? 127 : 1023;
+  constexpr bits_t MANT_MASK = (bits_t{1} << MANT) - 1;
+
+  bits_t bits;
+  memcpy(&bits, &x, sizeof(x));
+  T e = static_cast<T>(static_cast<int>(bits >> MANT) - static_cast<int>(BIAS));
+  bits = (bits & MANT_MASK) | (BIAS << MANT);
+  T m;
+  memcpy(&m, &bits, sizeof(m));
+  const bool big = m > static_cast<T>(1.4142135623730950488);
+  m = big ? m * static_cast<T>(0.5) : m;
+  e = big ? e + 1 : e;
+
+  // log(m) = 2 * atanh(s) = 2 * (s + s^3 / 3 + s^5 / 5 + ...), |s| < 0.172
+  const T s = (m - 1) / (m + 1);
+  const T z = s * s;
+  T p;
+  if constexpr (std::is_same_v<T, float>) {
+    p = 2.0f / 11;
+    p = p * z + 2.0f / 9;
+    p = p * z + 2.0f / 7;
+    p = p * z + 2.0f / 5;
+    p = p * z + 2.0f / 3;
+    p = p * z + 2.0f;
+  }
+  else {
+    p = 2.0 / 25;
+#pragma unroll
+    for (int k = 11; k >= 0; k--) {
+      p = p * z + 2.0 / (2 * k + 1);
+    }
+  }
+
+  // ln(2) split so e * LN2_HI is exact
+  const T LN2_HI = static_cast<T>(0.693145751953125);
+  const T LN2_LO = static_cast<T>(1.42860682030941723212e-6);
+  return e * LN2_HI + (s * p + e * LN2_LO);
+}
+
+/**
+ * sin(2 pi u) and cos(2 pi u) for u in [0, 1]
+ *
+ * u is reduced exactly to the nearest quarter turn and the remaining angle,
+ * at most pi / 4, goes through Taylor polynomials. Branch free for the same
+ * reason as matxRandLog.
+ */
+template <typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void
+matxRandSinCos2Pi(T u, T &sin_out, T &cos_out)
+{
+  const int q = static_cast<int>(u * 4 + static_cast<T>(0.5));
+  const T x = (u - static_cast<T>(q) * static_cast<T>(0.25)) *
+              static_cast<T>(6.283185307179586477);
+  const T z = x * x;
+
+  T sp, cp;
+  if constexpr (std::is_same_v<T, float>) {
+    sp = -1.0f / 39916800;
+    sp = sp * z + 1.0f / 362880;
+    sp = sp * z - 1.0f / 5040;
+    sp = sp * z + 1.0f / 120;
+    sp = sp * z - 1.0f / 6;
+    cp = 1.0f / 479001600;
+    cp = cp * z - 1.0f / 3628800;
+    cp = cp * z + 1.0f / 40320;
+    cp = cp * z - 1.0f / 720;
+    cp = cp * z + 1.0f / 24;
+    cp = cp * z - 1.0f / 2;
+  }
+  else {
+    sp = 1.0 / 121645100408832000.0;
+    sp = sp * z - 1.0 / 355687428096000.0;
+    sp = sp * z + 1.0 / 1307674368000.0;
+    sp = sp * z - 1.0 / 6227020800.0;
+    sp = sp * z + 1.0 / 39916800.0;
+    sp = sp * z - 1.0 / 362880.0;
+    sp = sp * z + 1.0 / 5040.0;
+    sp = sp * z - 1.0 / 120.0;
+    sp = sp * z + 1.0 / 6.0;
+    sp = -sp;
+    cp = 1.0 / 6402373705728000.0;
+    cp = cp * z - 1.0 / 20922789888000.0;
+    cp = cp * z + 1.0 / 87178291200.0;
+    cp = cp * z - 1.0 / 479001600.0;
+    cp = cp * z + 1.0 / 3628800.0;
+    cp = cp * z - 1.0 / 40320.0;
+    cp = cp * z + 1.0 / 720.0;
+    cp = cp * z - 1.0 / 24.0;
+    cp = cp * z + 1.0 / 2.0;
+    cp = -cp;
+  }
+  const T sn = x + x * z * sp;
+  const T cs = 1 + z * cp;
+
+  // Rotate by the quarter turns
+  const int quad = q & 3;
+  const T s1 = (quad & 1) ? cs : sn;
+  const T c1 = (quad & 1) ? sn : cs;
+  sin_out = (quad & 2) ? -s1 : s1;
+  cos_out = ((quad + 1) & 2) ? -c1 : c1;
+}
+
+/**
+ * Box-Muller transform of two uniforms in (0, 1] into two normals
+ */
+template <typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void
+matxRandBoxMuller(T u0, T u1, T &n0, T &n1)
+{
+  T rad;
+  if constexpr (std::is_same_v<T, float>) {
+    rad = ::sqrtf(-2.0f * matxRandLog(u0));
+  }
+  else {
+    rad = ::sqrt(-2.0 * matxRandLog(u0));
+  }
+  T sn, cs;
+  matxRandSinCos2Pi(u1, sn, cs);
+  n0 = rad * cs;
+  n1 = rad * sn;
+}
+
+/**
+ * Number of random values of type T drawn from one Philox block
+ *
+ * A float takes one 32-bit word, a double or complex float two and a
+ * complex double all four.
+ */
+template <typename T> constexpr int matxPhiloxValuesPerBlock()
+{
+  return static_cast<int>(16 / sizeof(T));
+}
+
+/**
+ * Element idx of the stateless random sequence for a seed
+ *
+ * Values are packed into Philox blocks in order: element idx comes from
+ * block idx / matxPhiloxValuesPerBlock<T>(), and real normals are drawn in
+ * Box-Muller pairs from adjacent words. Each element can still be evaluated
+ * on its own, in any order, on any thread, on host or device. Uniform values
+ * are bit-identical everywhere; normal values use the portable matxRandLog
+ * and matxRandSinCos2Pi and agree to within multiply-add contraction.
+ *
+ * @tparam T
+ *   float, double, or a complex of either
+ * @param seed
+ *   Seed of the sequence
+ * @param idx
+ *   Element index
+ * @param dist
+ *   Distribution of the values
+ */
+template <typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T
+matxPhiloxRandom(uint64_t seed, uint64_t idx, Distribution_t dist)
+{
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                    std::is_same_v<T, cuda::std::complex<float>> ||
+                    std::is_same_v<T, cuda::std::complex<double>>,
+                "Random values must be float, double or complex");
+
+  constexpr int per = matxPhiloxValuesPerBlock<T>();
+  const matxPhiloxBlock_t r = matxPhilox4x32_10(idx / per, seed);
+  const int h = static_cast<int>(idx % per);
+  if constexpr (std::is_same_v<T, float>) {
+    if (dist == UNIFORM) {
+      return matxPhiloxUniformFloat(r.v[h]);
+    }
+    const int w = h & 2;
+    float n0, n1;
+    matxRandBoxMuller(matxPhiloxUniformFloat(r.v[w]),
+                      matxPhiloxUniformFloat(r.v[w + 1]), n0, n1);
+    return (h & 1) ? n1 : n0;
+  }
+  else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+    const float u0 = matxPhiloxUniformFloat(r.v[2 * h]);
+    const float u1 = matxPhiloxUniformFloat(r.v[2 * h + 1]);
+    if (dist == UNIFORM) {
+      return {u0, u1};
+    }
+    float n0, n1;
+    matxRandBoxMuller(u0, u1, n0, n1);
+    return {n0, n1};
+  }
+  else if constexpr (std::is_same_v<T, double>) {
+    if (dist == UNIFORM) {
+      return matxPhiloxUniformDouble(r.v[2 * h], r.v[2 * h + 1]);
+    }
+    double n0, n1;
+    matxRandBoxMuller(matxPhiloxUniformDouble(r.v[0], r.v[1]),
+                      matxPhiloxUniformDouble(r.v[2], r.v[3]), n0, n1);
+    return h ? n1 : n0;
+  }
+  else {
+    const double u0 = matxPhiloxUniformDouble(r.v[0], r.v[1]);
+    const double u1 = matxPhiloxUniformDouble(r.v[2], r.v[3]);
+    if (dist == UNIFORM) {
+      return {u0, u1};
+    }
+    double n0, n1;
+    matxRandBoxMuller(u0, u1, n0, n1);
+    return {n0, n1};
+  }
+}
+
+/**
+ * Stateless random number operator
+ *
+ * Lazily evaluates element (i, j, ...) of a Philox4x32-10 sequence keyed by a
+ * seed. The element with row-major index idx is drawn from the Philox block
+ * with counter idx / matxPhiloxValuesPerBlock<T>(), as in matxPhiloxRandom.
+ * Unlike randomTensorView_t, nothing is allocated and there is no setup
+ * kernel, so it costs no memory however large the shape, and it can be used
+ * in any expression on host or device. The same seed and shape give the same
+ * values everywhere.
+ *
+ * @tparam T
+ *   Type of random number
+ * @tparam RANK
+ *   Rank of the operator
+ */
+template <typename T, int RANK> class randomOp_t {
+private:
+  tensorShape_t<RANK> shape_;
+  uint64_t seed_;
+  Distribution_t dist_;
+  T alpha_, beta_;
+
+public:
+  using type = T;
+  using scalar_type = T;
+  // dummy type to signal this is a matxop
+  using matxop = bool;
+
+  randomOp_t(const tensorShape_t<RANK> &shape, Distribution_t dist,
+             uint64_t seed, T alpha, T beta)
+      : shape_(shape), seed_(seed), dist_(dist), alpha_(alpha), beta_(beta)
+  {
+  }
+
+  /**
+   * Value at a row-major element index
+   */
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T Get(index_t idx) const
+  {
+    return alpha_ * matxPhiloxRandom<T>(seed_, static_cast<uint64_t>(idx),
+                                        dist_) +
+           beta_;
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T operator()() const
+  {
+    return Get(0);
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T operator()(index_t i) const
+  {
+    return Get(i);
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T operator()(index_t i,
+                                                             index_t j) const
+  {
+    return Get(i * Size(1) + j);
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T
+  operator()(index_t i, index_t j, index_t k) const
+  {
+    return Get((i * Size(1) + j) * Size(2) + k);
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T
+  operator()(index_t i, index_t j, index_t k, index_t l) const
+  {
+    return Get(((i * Size(1) + j) * Size(2) + k) * Size(3) + l);
+  }
+
+  static inline constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+  {
+    return RANK;
+  }
+
+  index_t inline __MATX_HOST__ __MATX_DEVICE__ Size(int dim) const
+  {
+    return shape_.Size(dim);
+  }
+};
+
+/**
+ * Stateless random numbers
+ *
+ * Returns an operator producing random values of the given shape from a
+ * counter-based Philox4x32-10 generator. No generator state is allocated:
+ * each element is computed from the seed and its index when it is read, on
+ * host or device, so (t = random<float>(t.Shape(), NORMAL)).run(exec) fills a
+ * host tensor with the same values a device run would.
+ *
+ * @tparam T
+ *   float, double, or a complex of either
+ * @param shape
+ *   Shape of the operator
+ * @param dist
+ *   Distribution to use
+ * @param seed
+ *   Seed for the sequence
+ * @param alpha
+ *   Scale applied to each value
+ * @param beta
+ *   Offset added to each value
+ * @returns
+ *   A randomOp_t with the given parameters
+ */
+template <typename T, int RANK>
+inline auto random(const tensorShape_t<RANK> &shape, Distribution_t dist,
+                   uint64_t seed = 0, T alpha = 1, T beta = 0)
+{
+  return randomOp_t<T, RANK>(shape, dist, seed, alpha, beta);
+}
+
+/**
+ * Stateless random numbers
+ *
+ * @tparam T
+ *   float, double, or a complex of either
+ * @param sizes
+ *   Dimensions of the operator in the form of an initializer list
+ * @param dist
+ *   Distribution to use
+ * @param seed
+ *   Seed for the sequence
+ * @param alpha
+ *   Scale applied to each value
+ * @param beta
+ *   Offset added to each value
+ * @returns
+ *   A randomOp_t with the given parameters
+ */
+template <typename T, int RANK>
+inline auto random(const index_t (&sizes)[RANK], Distribution_t dist,
+                   uint64_t seed = 0, T alpha = 1, T beta = 0)
+{
+  return random<T>(tensorShape_t<RANK>(static_cast<const index_t *>(sizes)),
+                   dist, seed, alpha, beta);
+}
+
+/**
+ * Philox blocks generated together by the host fill. The rounds run across
+ * the blocks as independent SIMD lanes
+ */
+constexpr index_t HOST_RANDOM_BLOCKS = 64;
+
+/**
+ * Fewest values handed to one host thread
+ */
+constexpr index_t HOST_RANDOM_MIN_TASK = 1 << 15;
+
+/**
+ * Values of Philox blocks b0 to b0 + nb - 1 in sequence order
+ *
+ * Produces exactly what matxPhiloxRandom gives for the same elements, but a
+ * whole batch at a time: the counters, rounds, uniform conversions and
+ * Box-Muller transforms all run over the batch in straight-line loops that
+ * the host compiler vectorizes.
+ *
+ * @param seed
+ *   Seed of the sequence
+ * @param b0
+ *   First block
+ * @param nb
+ *   Number of blocks, at most HOST_RANDOM_BLOCKS
+ * @param dist
+ *   Distribution of the values
+ * @param vals
+ *   nb * matxPhiloxValuesPerBlock<T>() output values
+ */
+template <typename T>
+inline void matxHostPhiloxValues(uint64_t seed, uint64_t b0, index_t nb,
+                                 Distribution_t dist, T *vals)
+{
+  constexpr index_t B = HOST_RANDOM_BLOCKS;
+  uint32_t x0[B], x1[B], x2[B], x3[B];
+  for (index_t i = 0; i < nb; i++) {
+    const uint64_t c = b0 + static_cast<uint64_t>(i);
+    x0[i] = static_cast<uint32_t>(c);
+    x1[i] = static_cast<uint32_t>(c >> 32);
+    x2[i] = 0;
+    x3[i] = 0;
+  }
+
+  uint32_t k0 = static_cast<uint32_t>(seed);
+  uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+  for (int round = 0; round < MATX_PHILOX_ROUNDS; round++) {
+    for (index_t i = 0; i < nb; i++) {
+      matxPhiloxRound(x0[i], x1[i], x2[i], x3[i], k0, k1);
+    }
+    k0 += MATX_PHILOX_W0;
+    k1 += MATX_PHILOX_W1;
+  }
+
+  // Uniform pairs in the order matxPhiloxRandom consumes them: one Box-Muller
+  // pair per two words for float and per four words for double
+  using real_t = value_type_t<T>;
+  constexpr bool single = std::is_same_v<real_t, float>;
+  constexpr index_t PAIRS = single ? 2 : 1;
+  real_t ua[B * PAIRS], ub[B * PAIRS];
+  if constexpr (single) {
+    for (index_t i = 0; i < nb; i++) {
+      ua[2 * i] = matxPhiloxUniformFloat(x0[i]);
+      ub[2 * i] = matxPhiloxUniformFloat(x1[i]);
+      ua[2 * i + 1] = matxPhiloxUniformFloat(x2[i]);
+      ub[2 * i + 1] = matxPhiloxUniformFloat(x3[i]);
+    }
+  }
+  else {
+    for (index_t i = 0; i < nb; i++) {
+      ua[i] = matxPhiloxUniformDouble(x0[i], x1[i]);
+      ub[i] = matxPhiloxUniformDouble(x2[i], x3[i]);
+    }
+  }
+
+  const index_t np = nb * PAIRS;
+  if (dist == NORMAL) {
+    // matxRandBoxMuller split in two so the log and sincos loop vectorizes.
+    // The second loop stays scalar unless built with -fno-math-errno, since
+    // std::sqrt may set errno; its argument is never negative, but the
+    // compiler cannot prove that. A reciprocal square root approximation
+    // would vectorize but no longer match matxPhiloxRandom.
+    real_t sn[B * PAIRS], cs[B * PAIRS];
+    for (index_t j = 0; j < np; j++) {
+      ua[j] = static_cast<real_t>(-2) * matxRandLog(ua[j]);
+      matxRandSinCos2Pi(ub[j], sn[j], cs[j]);
+    }
+    for (index_t j = 0; j < np; j++) {
+      const real_t rad = std::sqrt(ua[j]);
+      ua[j] = rad * cs[j];
+      ub[j] = rad * sn[j];
+    }
+  }
+
+  for (index_t j = 0; j < np; j++) {
+    if constexpr (is_complex_v<T>) {
+      vals[j] = {ua[j], ub[j]};
+    }
+    else {
+      vals[2 * j] = ua[j];
+      vals[2 * j + 1] = ub[j];
+    }
+  }
+}
+
 /**
  * Populate a tensor with random values
  *
+ * Fills t with the values of random<T>(t.Shape(), dist, seed), so the result
+ * is the same as filling it on the host and the device and does not depend
+ * on any generator state.
+ *
  * @param t
  *   Output tensor view
  * @param dist
@@ -362,15 +918,74 @@ public:
  *   Random seed
  * @param stream
  *   Stream to execute
- * Note: leave this function out for now since it may be confusing to users with
- * all the allocations it does
  */
-// template<class T, int RANK>
-// inline void rand(tensor_t<T,RANK> t, Distribution_t dist = UNIFORM,
-// uint64_t seed = 0, cudaStream_t stream = 0) {
-//   randomGenerator_t<T> r(t.TotalSize(), seed);
-//   auto tmp = r.template GetTensorView<RANK> (t.Shape(), dist);
-//   exec(set(t, tmp), stream);
-// }
+template <typename T, int RANK>
+inline void rand(tensor_t<T, RANK> t, Distribution_t dist = UNIFORM,
+                 uint64_t seed = 0, cudaStream_t stream = 0)
+{
+  (t = random<T>(t.Shape(), dist, seed)).run(stream);
+}
+
+/**
+ * Populate a host tensor with random values
+ *
+ * Host counterpart of rand() producing the same values. Philox blocks are
+ * generated HOST_RANDOM_BLOCKS at a time with the rounds and the uniform and
+ * Box-Muller conversions vectorized across blocks. Each element depends only
+ * on the seed and its row-major index, so the work is split across threads
+ * by element offset and the output is identical for any number of threads.
+ *
+ * @param t
+ *   Output tensor view
+ * @param dist
+ *   Type of random distribution
+ * @param seed
+ *   Random seed
+ * @param exec
+ *   Host executor
+ */
+template <typename T, int RANK>
+inline void rand(tensor_t<T, RANK> t, Distribution_t dist, uint64_t seed,
+                 const HostExecutor &exec)
+{
+  if constexpr (RANK == 0) {
+    t() = matxPhiloxRandom<T>(seed, 0, dist);
+  }
+  else {
+    constexpr index_t per = matxPhiloxValuesPerBlock<T>();
+    constexpr index_t tile = HOST_RANDOM_BLOCKS * per;
+    const index_t n = t.Size(RANK - 1);
+    const index_t stride = t.Stride(RANK - 1);
+    const index_t total = batch_count(t, 1) * n;
+    if (total == 0) {
+      return;
+    }
+
+    // Tasks start on a tile boundary, so every tile starts a Philox block
+    index_t task = std::max(HOST_RANDOM_MIN_TASK,
+                            (total + exec.GetNumThreads() - 1) /
+                                exec.GetNumThreads());
+    task = (task + tile - 1) / tile * tile;
+    exec.ParallelFor((total + task - 1) / task, [&](index_t tk) {
+      const index_t end = std::min(total, (tk + 1) * task);
+      index_t row = tk * task / n;
+      index_t col = tk * task % n;
+      T *ptr = &batch_at(t, row, 0);
+      T vals[tile];
+      for (index_t e = tk * task; e < end; e += tile) {
+        const index_t cnt = std::min(tile, end - e);
+        matxHostPhiloxValues(seed, static_cast<uint64_t>(e / per),
+                             (cnt + per - 1) / per, dist, vals);
+        for (index_t k = 0; k < cnt; k++) {
+          ptr[col * stride] = vals[k];
+          if (++col == n && e + k + 1 < end) {
+            col = 0;
+            ptr = &batch_at(t, ++row, 0);
+          }
+        }
+      }
+    });
+  }
+}
 
 } // end namespace matx
@@ -34,10 +34,12 @@
 
 #include "matx_cub.h"
 #include "matx_error.h"
+#include "matx_exec_host.h"
 #include "matx_get_grid_dims.h"
 #include "matx_tensor.h"
 #include "matx_type_utils.h"
 #include <cfloat>
+#include <climits>
 
 #ifdef __CUDACC__  
 /**
@@ -395,7 +397,6 @@ __MATX_DEVICE__ inline void atomicAdd(cuda::std::complex<double> *addr,
 
 namespace matx {
 
-#ifdef __CUDACC__  
 template <typename T> constexpr inline __MATX_HOST__ __MATX_DEVICE__ T maxVal();
 template <typename T> constexpr inline __MATX_HOST__ __MATX_DEVICE__ T minVal();
 
@@ -419,6 +420,61 @@ template <> constexpr inline __MATX_HOST__ __MATX_DEVICE__ uint32_t minVal<uint3
 {
   return 0;
 }
+/*
+ * 64-bit integers are specialized on long and long long rather than the
+ * fixed-width aliases. int64_t is one of the two depending on the platform,
+ * while index_t is always long long, so both must exist without colliding.
+ */
+/* Returns the max value of a long at compile time */
+template <> constexpr inline __MATX_HOST__ __MATX_DEVICE__ long maxVal<long>()
+{
+  return LONG_MAX;
+}
+/* Returns the min value of a long at compile time */
+template <> constexpr inline __MATX_HOST__ __MATX_DEVICE__ long minVal<long>()
+{
+  return LONG_MIN;
+}
+/* Returns the max value of an unsigned long at compile time */
+template <>
+constexpr inline __MATX_HOST__ __MATX_DEVICE__ unsigned long
+maxVal<unsigned long>()
+{
+  return ULONG_MAX;
+}
+/* Returns the min value of an unsigned long at compile time */
+template <>
+constexpr inline __MATX_HOST__ __MATX_DEVICE__ unsigned long
+minVal<unsigned long>()
+{
+  return 0;
+}
+/* Returns the max value of a long long at compile time */
+template <>
+constexpr inline __MATX_HOST__ __MATX_DEVICE__ long long maxVal<long long>()
+{
+  return LLONG_MAX;
+}
+/* Returns the min value of a long long at compile time */
+template <>
+constexpr inline __MATX_HOST__ __MATX_DEVICE__ long long minVal<long long>()
+{
+  return LLONG_MIN;
+}
+/* Returns the max value of an unsigned long long at compile time */
+template <>
+constexpr inline __MATX_HOST__ __MATX_DEVICE__ unsigned long long
+maxVal<unsigned long long>()
+{
+  return ULLONG_MAX;
+}
+/* Returns the min value of an unsigned long long at compile time */
+template <>
+constexpr inline __MATX_HOST__ __MATX_DEVICE__ unsigned long long
+minVal<unsigned long long>()
+{
+  return 0;
+}
 /* Returns the max value of a float at compile time */
 template <> constexpr inline __MATX_HOST__ __MATX_DEVICE__ float maxVal<float>()
 {
@@ -559,6 +615,7 @@ public:
     };
 #endif
 
+#ifdef __CUDACC__  
 template <typename T, typename Op>
 __MATX_DEVICE__ inline T warpReduceOp(T val, Op op, uint32_t size)
 {
@@ -1099,6 +1156,146 @@ void inline median(tensor_t<T, RANK> &dest,
 #endif  
 }
 
+/**
+ * Calculate the median of values in a tensor on the host
+ *
+ * Calculates the median of each row (last dimension) of a tensor by selection
+ * rather than sorting: each row is copied once and partitioned with
+ * introselect, so the work per row is linear in its length. For an even
+ * number of items, the mean of the two middle elements is selected. The output
+ * has one less dimension than the input.
+ *
+ * @tparam T
+ *   Output data type
+ * @tparam RANK
+ *   Rank of output tensor
+ * @tparam RANK_IN
+ *   Input rank
+ *
+ * @param dest
+ *   Destination view of reduction
+ * @param in
+ *   Input data to reduce
+ * @param exec
+ *   Host executor
+ */
+template <typename T, int RANK, int RANK_IN>
+void inline median(tensor_t<T, RANK> &dest, const tensor_t<T, RANK_IN> &in,
+                   const HostExecutor &exec)
+{
+  matxHostPercentile(dest, in, 50.0, exec);
+}
+
+/**
+ * Calculate a percentile of values in a tensor on the host
+ *
+ * Calculates the q-th percentile of each row (last dimension) of a tensor.
+ * When the percentile falls between two elements of the sorted row, the
+ * result is linearly interpolated between them, so q = 50 gives the median
+ * and q = 0 and q = 100 give the minimum and maximum. Rows are reduced by
+ * selection in linear time without sorting.
+ *
+ * @tparam T
+ *   Output data type
+ * @tparam RANK
+ *   Rank of output tensor
+ * @tparam RANK_IN
+ *   Input rank
+ *
+ * @param dest
+ *   Destination view of reduction
+ * @param in
+ *   Input data to reduce
+ * @param q
+ *   Percentile between 0 and 100
+ * @param exec
+ *   Host executor
+ */
+template <typename T, int RANK, int RANK_IN>
+void inline percentile(tensor_t<T, RANK> &dest, const tensor_t<T, RANK_IN> &in,
+                       double q, const HostExecutor &exec)
+{
+  matxHostPercentile(dest, in, q, exec);
+}
+
+/**
+ * Scan mode of the host scan functions
+ */
+typedef enum {
+  SCAN_MODE_INCLUSIVE, ///< Element i includes input element i
+  SCAN_MODE_EXCLUSIVE  ///< Element i covers input elements before i
+} ScanMode_t;
+
+/**
+ * Prefix scan of a tensor along any dimension on the host
+ *
+ * Combines the elements of "in" along dimension "dim" with an associative
+ * reduction operator, such as reduceOpSum, reduceOpProd, reduceOpMax or
+ * reduceOpMin, giving a cumulative sum, product, maximum or minimum. An
+ * exclusive scan starts each line with the operator's Init() value. The
+ * dimension is scanned in place without transposing, and long lines are split
+ * into blocks scanned in parallel. dest may be the same tensor as in.
+ *
+ * @tparam T
+ *   Data type
+ * @tparam RANK
+ *   Rank of tensors
+ * @tparam ScanOp
+ *   Reduction operator to scan with
+ *
+ * @param dest
+ *   Destination of the scan
+ * @param in
+ *   Input data to scan
+ * @param op
+ *   Associative reduction operator
+ * @param exec
+ *   Host executor
+ * @param dim
+ *   Dimension to scan along
+ * @param mode
+ *   Inclusive or exclusive scan
+ */
+template <typename T, int RANK, typename ScanOp>
+void inline scan(tensor_t<T, RANK> &dest, const tensor_t<T, RANK> &in,
+                 ScanOp op, const HostExecutor &exec, int dim = RANK - 1,
+                 ScanMode_t mode = SCAN_MODE_INCLUSIVE)
+{
+  matxHostScan(dest, in, op, dim, mode == SCAN_MODE_EXCLUSIVE, exec);
+}
+
+/**
+ * Compute a cumulative sum of a tensor along any dimension on the host
+ *
+ * Same as scan() with reduceOpSum. By default rows (the last dimension) are
+ * summed inclusively like the CUDA cumsum(), so an input of [1, 2, 3, 4]
+ * gives [1, 3, 6, 10], or [0, 1, 3, 6] in exclusive mode.
+ *
+ * @tparam T
+ *   Data type
+ * @tparam RANK
+ *   Rank of tensors
+ *
+ * @param dest
+ *   Destination of the sum
+ * @param in
+ *   Input data to sum
+ * @param exec
+ *   Host executor
+ * @param dim
+ *   Dimension to sum along
+ * @param mode
+ *   Inclusive or exclusive sum
+ */
+template <typename T, int RANK>
+void inline cumsum(tensor_t<T, RANK> &dest, const tensor_t<T, RANK> &in,
+                   const HostExecutor &exec, int dim = RANK - 1,
+                   ScanMode_t mode = SCAN_MODE_INCLUSIVE)
+{
+  matxHostScan(dest, in, reduceOpSum<T>(), dim, mode == SCAN_MODE_EXCLUSIVE,
+               exec);
+}
+
 /**
  * Compute sum of numbers
  *
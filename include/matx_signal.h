@@ -32,11 +32,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <type_traits>
+#include <vector>
 
 #include "matx_allocator.h"
+#include "matx_cache.h"
 #include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_fft_host.h"
 #include "matx_shape.h"
 #include "matx_tensor.h"
 #include "matx_type_utils.h"
@@ -104,5 +110,380 @@ void dct(tensor_t<T, RANK> &out, tensor_t<T, RANK> &in,
   dctOp(out, s, N).run(stream);
 }
 
+/**
+ * DCT variants supported by the host transforms. Scaling follows the
+ * unnormalized definitions used by scipy.fft.dct:
+ *
+ * - DCT_TYPE_II:  y[k] = 2 sum x[n] cos(pi k (2n + 1) / 2N)
+ * - DCT_TYPE_III: y[k] = x[0] + 2 sum_{n > 0} x[n] cos(pi n (2k + 1) / 2N)
+ * - DCT_TYPE_IV:  y[k] = 2 sum x[n] cos(pi (2n + 1) (2k + 1) / 4N)
+ */
+enum DctType_t { DCT_TYPE_II, DCT_TYPE_III, DCT_TYPE_IV };
+
+/**
+ * Host plan for a DCT of one length and type
+ *
+ * Uses Makhoul's reordering, "A Fast Cosine Transform in One and Two
+ * Dimensions", IEEE Trans. ASSP, 1980: DCT-II becomes an N-point real FFT of
+ * the even samples followed by the reversed odd samples, and DCT-III is the
+ * same steps in reverse. For even N the real FFT is computed as an N/2-point
+ * complex FFT of the reordered samples packed in pairs, so no complex
+ * temporary larger than N reals is needed. DCT-IV for even N is an N/2-point
+ * complex FFT between a pre- and a post-twiddle. Odd lengths fall back to an
+ * N-point (DCT-II, III) or 2N-point (DCT-IV) complex FFT.
+ *
+ * The FFT tables and all twiddles are computed by the constructor. Exec only
+ * reads the plan, and rows of a batch are transformed in parallel, each
+ * thread with its own work buffer.
+ *
+ * @tparam T
+ *   float or double
+ */
+template <typename T> class matxDctHostPlan_t {
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "Host DCTs must be float or double");
+
+public:
+  /**
+   * Construct a plan
+   *
+   * @param n
+   *   Transform length
+   * @param type
+   *   DCT variant
+   */
+  matxDctHostPlan_t(index_t n, DctType_t type)
+      : n_(n), type_(type), fft_(FftLength(n, type))
+  {
+    const index_t m = n / 2;
+    const double N = static_cast<double>(n);
+    auto set = [](std::vector<cuda::std::complex<T>> &tw, index_t k,
+                  double mag, double ang) {
+      tw[k] = {static_cast<T>(mag * std::cos(ang)),
+               static_cast<T>(mag * std::sin(ang))};
+    };
+
+    if (type == DCT_TYPE_II) {
+      // Even: X_k = Re(t), X_{N-k} = -Im(t) with
+      // t = w_k (Z_k + conj Z_{M-k}) - i w_k e^{-2 pi i k / N} (Z_k - conj Z_{M-k})
+      // and w_k = e^{-i pi k / 2N}. Odd: X_k = Re(2 w_k V_k)
+      const index_t len = (n % 2 == 0) ? m + 1 : n;
+      tw0_.resize(len);
+      tw1_.resize(len);
+      for (index_t k = 0; k < len; k++) {
+        const double kk = static_cast<double>(k);
+        set(tw0_, k, n % 2 == 0 ? 1.0 : 2.0, -M_PI * kk / (2 * N));
+        set(tw1_, k, 1.0, -M_PI / 2 - 5 * M_PI * kk / (2 * N));
+      }
+    }
+    else if (type == DCT_TYPE_III) {
+      // V_k = conj(w_k) (X_k - i X_{N-k}) is the Hermitian spectrum of the
+      // reordered output; even lengths fold it to M points with
+      // Z_k = (V_k + conj V_{M-k}) + i e^{2 pi i k / N} (V_k - conj V_{M-k})
+      const index_t len = (n % 2 == 0) ? m + 1 : n;
+      tw0_.resize(len);
+      tw1_.resize(len);
+      for (index_t k = 0; k < len; k++) {
+        const double kk = static_cast<double>(k);
+        set(tw0_, k, 1.0, M_PI * kk / (2 * N));
+        set(tw1_, k, 1.0, M_PI / 2 + 2 * M_PI * kk / N);
+      }
+    }
+    else if (n % 2 == 0) {
+      // z_j = (x_{2j} + i x_{N-1-2j}) e^{-i pi (4j + 1) / 4N},
+      // d_k = 2 e^{-i pi k / N} Z_k, y_{2k} = Re(d_k), y_{N-1-2k} = -Im(d_k)
+      tw0_.resize(m);
+      tw1_.resize(m);
+      for (index_t k = 0; k < m; k++) {
+        const double kk = static_cast<double>(k);
+        set(tw0_, k, 1.0, -M_PI * (4 * kk + 1) / (4 * N));
+        set(tw1_, k, 2.0, -M_PI * kk / N);
+      }
+    }
+    else {
+      // y_k = Re(2 e^{-i pi (2k + 1) / 4N} FFT_2N(x_j e^{-i pi j / 2N})_k)
+      tw0_.resize(n);
+      tw1_.resize(n);
+      for (index_t k = 0; k < n; k++) {
+        const double kk = static_cast<double>(k);
+        set(tw0_, k, 1.0, -M_PI * kk / (2 * N));
+        set(tw1_, k, 2.0, -M_PI * (2 * kk + 1) / (4 * N));
+      }
+    }
+  }
+
+  /**
+   * Transform length
+   */
+  index_t Size() const noexcept { return n_; }
+
+  /**
+   * DCT variant
+   */
+  DctType_t Type() const noexcept { return type_; }
+
+  /**
+   * Number of T values of work space ExecRow needs
+   */
+  index_t WorkSize() const noexcept
+  {
+    return 2 * fft_.Size() + fft_.ScratchSize();
+  }
+
+  /**
+   * Transform one row
+   *
+   * @param out
+   *   Output row, may be the same as in
+   * @param ostride
+   *   Stride of out
+   * @param in
+   *   Input row
+   * @param istride
+   *   Stride of in
+   * @param work
+   *   WorkSize() values
+   */
+  void ExecRow(T *out, index_t ostride, const T *in, index_t istride,
+               T *work) const
+  {
+    const index_t n = n_;
+    const index_t m = n / 2;
+    T *z = work;
+    T *scratch = work + 2 * fft_.Size();
+    auto x = [&](index_t i) { return in[i * istride]; };
+    auto y = [&](index_t i) -> T & { return out[i * ostride]; };
+
+    if (type_ == DCT_TYPE_II) {
+      if (n % 2 == 0) {
+        // The reordered sequence, read as M complex values
+        for (index_t j = 0; j < m; j++) {
+          z[j] = x(2 * j);
+          z[n - 1 - j] = x(2 * j + 1);
+        }
+        fft_.Exec(z, false, scratch);
+        for (index_t k = 0; k <= m; k++) {
+          const index_t k0 = (k == m) ? 0 : k;
+          const index_t k1 = (k == 0) ? 0 : m - k;
+          const T sr = z[2 * k0] + z[2 * k1];
+          const T si = z[2 * k0 + 1] - z[2 * k1 + 1];
+          const T dr = z[2 * k0] - z[2 * k1];
+          const T di = z[2 * k0 + 1] + z[2 * k1 + 1];
+          const T ar = tw0_[k].real(), ai = tw0_[k].imag();
+          const T br = tw1_[k].real(), bi = tw1_[k].imag();
+          y(k) = ar * sr - ai * si + br * dr - bi * di;
+          if (k > 0 && k < m) {
+            y(n - k) = -(ar * si + ai * sr + br * di + bi * dr);
+          }
+        }
+      }
+      else {
+        for (index_t j = 0; j < n - m; j++) {
+          z[2 * j] = x(2 * j);
+          z[2 * j + 1] = 0;
+        }
+        for (index_t j = 0; j < m; j++) {
+          z[2 * (n - 1 - j)] = x(2 * j + 1);
+          z[2 * (n - 1 - j) + 1] = 0;
+        }
+        fft_.Exec(z, false, scratch);
+        for (index_t k = 0; k < n; k++) {
+          y(k) = tw0_[k].real() * z[2 * k] - tw0_[k].imag() * z[2 * k + 1];
+        }
+      }
+    }
+    else if (type_ == DCT_TYPE_III) {
+      auto v = [&](index_t k, T &vr, T &vi) {
+        const T xk = x(k);
+        const T xn = (k == 0) ? T(0) : x(n - k);
+        const T cr = tw0_[k].real(), ci = tw0_[k].imag();
+        vr = cr * xk + ci * xn;
+        vi = ci * xk - cr * xn;
+      };
+
+      if (n % 2 == 0) {
+        for (index_t k = 0; k < m; k++) {
+          T pr, pi, qr, qi;
+          v(k, pr, pi);
+          v(m - k, qr, qi);
+          const T dr = pr - qr;
+          const T di = pi + qi;
+          const T br = tw1_[k].real(), bi = tw1_[k].imag();
+          z[2 * k] = pr + qr + br * dr - bi * di;
+          z[2 * k + 1] = pi - qi + br * di + bi * dr;
+        }
+        fft_.Exec(z, true, scratch);
+        for (index_t j = 0; j < m; j++) {
+          const T even = z[j];
+          const T odd = z[n - 1 - j];
+          y(2 * j) = even;
+          y(2 * j + 1) = odd;
+        }
+      }
+      else {
+        for (index_t k = 0; k < n; k++) {
+          v(k, z[2 * k], z[2 * k + 1]);
+        }
+        fft_.Exec(z, true, scratch);
+        for (index_t j = 0; j < n - m; j++) {
+          y(2 * j) = z[2 * j];
+        }
+        for (index_t j = 0; j < m; j++) {
+          y(2 * j + 1) = z[2 * (n - 1 - j)];
+        }
+      }
+    }
+    else {
+      if (n % 2 == 0) {
+        for (index_t j = 0; j < m; j++) {
+          const T ur = x(2 * j);
+          const T ui = x(n - 1 - 2 * j);
+          const T cr = tw0_[j].real(), ci = tw0_[j].imag();
+          z[2 * j] = ur * cr - ui * ci;
+          z[2 * j + 1] = ur * ci + ui * cr;
+        }
+        fft_.Exec(z, false, scratch);
+        for (index_t k = 0; k < m; k++) {
+          const T cr = tw1_[k].real(), ci = tw1_[k].imag();
+          const T dr = z[2 * k] * cr - z[2 * k + 1] * ci;
+          const T di = z[2 * k] * ci + z[2 * k + 1] * cr;
+          y(2 * k) = dr;
+          y(n - 1 - 2 * k) = -di;
+        }
+      }
+      else {
+        for (index_t j = 0; j < n; j++) {
+          const T xj = x(j);
+          z[2 * j] = xj * tw0_[j].real();
+          z[2 * j + 1] = xj * tw0_[j].imag();
+        }
+        std::fill(z + 2 * n, z + 4 * n, T(0));
+        fft_.Exec(z, false, scratch);
+        for (index_t k = 0; k < n; k++) {
+          y(k) = tw1_[k].real() * z[2 * k] - tw1_[k].imag() * z[2 * k + 1];
+        }
+      }
+    }
+  }
+
+  /**
+   * Transform every row of a tensor
+   *
+   * The last dimension is transformed and all others are batch dimensions.
+   *
+   * @param out
+   *   Output tensor, may be the same as in
+   * @param in
+   *   Input tensor of the same shape
+   * @param exec
+   *   Host executor
+   */
+  template <int RANK>
+  void Exec(tensor_t<T, RANK> &out, const tensor_t<T, RANK> &in,
+            const HostExecutor &exec) const
+  {
+    static_assert(RANK >= 1, "DCT input must have a rank of at least 1");
+    for (int d = 0; d < RANK; d++) {
+      MATX_ASSERT_STR(out.Size(d) == in.Size(d), matxInvalidSize,
+                      "DCT input and output shapes must match");
+    }
+    MATX_ASSERT_STR(in.Size(RANK - 1) == n_, matxInvalidSize,
+                    "DCT length does not match the plan");
+
+    const index_t rows = batch_count(in, 1);
+    const index_t tasks = std::min<index_t>(rows, exec.GetNumThreads());
+    exec.ParallelFor(tasks, [&](index_t t) {
+      std::vector<T> work(WorkSize());
+      for (index_t r = t * rows / tasks; r < (t + 1) * rows / tasks; r++) {
+        ExecRow(&batch_at(out, r, 0), out.Stride(RANK - 1),
+                &batch_at(in, r, 0), in.Stride(RANK - 1), work.data());
+      }
+    });
+  }
+
+private:
+  static index_t FftLength(index_t n, DctType_t type)
+  {
+    MATX_ASSERT_STR(n > 0, matxInvalidSize, "DCT length must be positive");
+    if (n % 2 == 0) {
+      return n / 2;
+    }
+    return type == DCT_TYPE_IV ? 2 * n : n;
+  }
+
+  index_t n_;
+  DctType_t type_;
+  matxHostFftPlan_t<T> fft_;
+  std::vector<cuda::std::complex<T>> tw0_, tw1_;
+};
+
+/**
+ * Parameters needed to cache a host DCT plan
+ */
+struct DctHostParams_t {
+  index_t n;
+  DctType_t type;
+  MatXDataType_t dtype;
+};
+
+struct DctHostParamsKeyHash {
+  std::size_t operator()(const DctHostParams_t &k) const noexcept
+  {
+    return std::hash<uint64_t>()(k.n) + std::hash<uint64_t>()(k.type) +
+           std::hash<uint64_t>()(k.dtype);
+  }
+};
+
+struct DctHostParamsKeyEq {
+  bool operator()(const DctHostParams_t &l, const DctHostParams_t &t) const
+      noexcept
+  {
+    return l.n == t.n && l.type == t.type && l.dtype == t.dtype;
+  }
+};
+
+static matxCache_t<DctHostParams_t, DctHostParamsKeyHash, DctHostParamsKeyEq>
+    dct_host_cache;
+
+/**
+ * Discrete Cosine Transform on the host
+ *
+ * Computes a DCT-II, DCT-III or DCT-IV of the last dimension of "in" for
+ * every combination of the other dimensions. Plans, with their FFT tables
+ * and twiddles, are cached per length and type. Scaling matches
+ * scipy.fft.dct, so DCT_TYPE_II agrees with the device dct() and DCT-III
+ * of a DCT-II returns 2N times the input.
+ *
+ * @tparam T
+ *   float or double
+ * @tparam RANK
+ *   Rank of input and output tensors
+ *
+ * @param out
+ *   Output tensor, may be the same as in
+ * @param in
+ *   Input tensor of the same shape
+ * @param exec
+ *   Host executor
+ * @param type
+ *   DCT variant
+ *
+ **/
+template <typename T, int RANK>
+void dct(tensor_t<T, RANK> &out, const tensor_t<T, RANK> &in,
+         const HostExecutor &exec, DctType_t type = DCT_TYPE_II)
+{
+  DctHostParams_t params{in.Size(RANK - 1), type, TypeToInt<T>()};
+  auto ret = dct_host_cache.Lookup(params);
+  if (ret == std::nullopt) {
+    auto tmp = new matxDctHostPlan_t<T>{params.n, type};
+    dct_host_cache.Insert(params, static_cast<void *>(tmp));
+    tmp->Exec(out, in, exec);
+  }
+  else {
+    static_cast<matxDctHostPlan_t<T> *>(ret.value())->Exec(out, in, exec);
+  }
+}
+
 }; // namespace signal
 }; // namespace matx
\ No newline at end of file
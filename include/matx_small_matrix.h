@@ -0,0 +1,478 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
+#include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_tensor.h"
+#include "kernels/matx_small_matrix_kernels.cuh"
+
+namespace matx {
+
+// Largest square size handled by the small-matrix engine
+constexpr index_t SMALL_MATRIX_MAX_DIM = 8;
+// Threads per block for the device small-matrix kernels
+constexpr unsigned int SMALL_MATRIX_BLOCK = 128;
+// Matrices interleaved per SIMD group on the host
+constexpr index_t SMALL_MATRIX_HOST_LANES = 8;
+// SIMD groups per host task
+constexpr index_t SMALL_MATRIX_HOST_GROUPS = 64;
+
+/**
+ * Call f with std::integral_constant<index_t, n> for 2 <= n <= 8
+ *
+ * Bridges runtime sizes onto the compile-time small-matrix kernels.
+ *
+ * @returns
+ *   False if n is outside the supported range and f was not called
+ */
+template <typename F> inline bool matxSmallDispatch(index_t n, F &&f)
+{
+  switch (n) {
+  case 2:
+    f(std::integral_constant<index_t, 2>{});
+    return true;
+  case 3:
+    f(std::integral_constant<index_t, 3>{});
+    return true;
+  case 4:
+    f(std::integral_constant<index_t, 4>{});
+    return true;
+  case 5:
+    f(std::integral_constant<index_t, 5>{});
+    return true;
+  case 6:
+    f(std::integral_constant<index_t, 6>{});
+    return true;
+  case 7:
+    f(std::integral_constant<index_t, 7>{});
+    return true;
+  case 8:
+    f(std::integral_constant<index_t, 8>{});
+    return true;
+  default:
+    return false;
+  }
+}
+
+/**
+ * Run f(first, count) over the batch in groups of SMALL_MATRIX_HOST_LANES,
+ * with SMALL_MATRIX_HOST_GROUPS groups per host task
+ */
+template <typename F>
+inline void matxSmallHostGroups(index_t batches, const HostExecutor &exec,
+                                F &&f)
+{
+  constexpr index_t W = SMALL_MATRIX_HOST_LANES;
+  constexpr index_t per_task = W * SMALL_MATRIX_HOST_GROUPS;
+  exec.ParallelFor((batches + per_task - 1) / per_task, [&](index_t t) {
+    const index_t end = std::min(batches, (t + 1) * per_task);
+    for (index_t b0 = t * per_task; b0 < end; b0 += W) {
+      f(b0, std::min(W, end - b0));
+    }
+  });
+}
+
+/**
+ * Batched small matrix multiply with compile-time sizes
+ *
+ * Computes C = alpha * A * B + beta * C + epi for every matrix in the batch
+ * with fully unrolled loops and each matrix held in registers, one matrix per
+ * thread. Intended for large batches of matrices up to about 8x8 where
+ * library GEMMs are dominated by per-matrix overhead. Any strides are
+ * accepted.
+ *
+ * @tparam M
+ *   Rows of A and C
+ * @tparam K
+ *   Columns of A and rows of B
+ * @tparam N
+ *   Columns of B and C
+ *
+ * @param c
+ *   Output tensor C
+ * @param a
+ *   Input tensor A
+ * @param b
+ *   Input tensor B
+ * @param stream
+ *   CUDA stream
+ * @param alpha
+ *   Scale on A * B
+ * @param beta
+ *   Scale on C
+ * @param epi
+ *   Optional operator added to the output, broadcast to the shape of C
+ */
+template <index_t M, index_t K, index_t N, typename TC, typename TA,
+          typename TB, int RANK, typename Epi = matxNoEpilogue_t>
+void matmul_small(tensor_t<TC, RANK> c, const tensor_t<TA, RANK> &a,
+                  const tensor_t<TB, RANK> &b, cudaStream_t stream = 0,
+                  float alpha = 1.0f, float beta = 0.0f, const Epi &epi = {})
+{
+  using scale_t = value_type_t<promote_matx_half_t<TC>>;
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(a.Size(RANK - 2) == M && a.Size(RANK - 1) == K &&
+                  b.Size(RANK - 2) == K && b.Size(RANK - 1) == N &&
+                  c.Size(RANK - 2) == M && c.Size(RANK - 1) == N,
+              matxInvalidSize);
+
+  [[maybe_unused]] const index_t batches = batch_count(c, 2);
+  [[maybe_unused]] tensor_impl_t<TC, RANK> &c_base = c;
+  [[maybe_unused]] const tensor_impl_t<TA, RANK> &a_base = a;
+  [[maybe_unused]] const tensor_impl_t<TB, RANK> &b_base = b;
+  [[maybe_unused]] const typename base_type<Epi>::type &epi_base = epi;
+#ifdef __CUDACC__
+  const unsigned int blocks = static_cast<unsigned int>(
+      (batches + SMALL_MATRIX_BLOCK - 1) / SMALL_MATRIX_BLOCK);
+  SmallMatMul<M, K, N><<<blocks, SMALL_MATRIX_BLOCK, 0, stream>>>(
+      c_base, a_base, b_base, batches, static_cast<scale_t>(alpha),
+      static_cast<scale_t>(beta), epi_base);
+#endif
+}
+
+/**
+ * Host batched small matrix multiply with compile-time sizes
+ *
+ * Matrices are loaded SMALL_MATRIX_HOST_LANES at a time into interleaved
+ * lanes so the unrolled kernel vectorizes across the batch.
+ *
+ * @param c
+ *   Output tensor C
+ * @param a
+ *   Input tensor A
+ * @param b
+ *   Input tensor B
+ * @param exec
+ *   Host executor
+ * @param alpha
+ *   Scale on A * B
+ * @param beta
+ *   Scale on C
+ * @param epi
+ *   Optional operator added to the output, broadcast to the shape of C
+ */
+template <index_t M, index_t K, index_t N, typename TC, typename TA,
+          typename TB, int RANK, typename Epi = matxNoEpilogue_t>
+void matmul_small(tensor_t<TC, RANK> c, const tensor_t<TA, RANK> &a,
+                  const tensor_t<TB, RANK> &b, const HostExecutor &exec,
+                  float alpha = 1.0f, float beta = 0.0f, const Epi &epi = {})
+{
+  using compute_t = promote_matx_half_t<TC>;
+  using scale_t = value_type_t<compute_t>;
+  constexpr index_t W = SMALL_MATRIX_HOST_LANES;
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(a.Size(RANK - 2) == M && a.Size(RANK - 1) == K &&
+                  b.Size(RANK - 2) == K && b.Size(RANK - 1) == N &&
+                  c.Size(RANK - 2) == M && c.Size(RANK - 1) == N,
+              matxInvalidSize);
+
+  const scale_t salpha = static_cast<scale_t>(alpha);
+  const scale_t sbeta = static_cast<scale_t>(beta);
+  matxSmallHostGroups(batch_count(c, 2), exec, [&](index_t b0, index_t nw) {
+    compute_t av[M][K][W] = {};
+    compute_t bv[K][N][W] = {};
+    compute_t cv[M][N][W];
+    for (index_t w = 0; w < nw; w++) {
+      for (index_t i = 0; i < M; i++) {
+        for (index_t j = 0; j < K; j++) {
+          av[i][j][w] = static_cast<compute_t>(batch_at2(a, b0 + w, i, j));
+        }
+      }
+      for (index_t i = 0; i < K; i++) {
+        for (index_t j = 0; j < N; j++) {
+          bv[i][j][w] = static_cast<compute_t>(batch_at2(b, b0 + w, i, j));
+        }
+      }
+    }
+
+    matxSmallMatMulLanes(cv, av, bv);
+
+    for (index_t w = 0; w < nw; w++) {
+      for (index_t i = 0; i < M; i++) {
+        for (index_t j = 0; j < N; j++) {
+          compute_t v = cv[i][j][w] * salpha;
+          if (sbeta != scale_t(0)) {
+            v += static_cast<compute_t>(batch_at2(c, b0 + w, i, j)) * sbeta;
+          }
+          if constexpr (!std::is_same_v<Epi, matxNoEpilogue_t>) {
+            v += static_cast<compute_t>(batch_get_value2(epi, c, b0 + w, i, j));
+          }
+          batch_at2(c, b0 + w, i, j) = static_cast<TC>(v);
+        }
+      }
+    }
+  });
+}
+
+/**
+ * Batched small matrix inverse with a compile-time size
+ *
+ * Gauss-Jordan elimination with partial pivoting, fully unrolled with each
+ * matrix in registers. A zero pivot in any matrix raises matxLUError, as in
+ * the library path, which costs one synchronization of the stream.
+ *
+ * @tparam N
+ *   Matrix size
+ *
+ * @param a_inv
+ *   Inverse of A
+ * @param a
+ *   Input matrix A
+ * @param stream
+ *   CUDA stream
+ */
+template <index_t N, typename T, int RANK>
+void inv_small(tensor_t<T, RANK> a_inv, const tensor_t<T, RANK> &a,
+               cudaStream_t stream = 0)
+{
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(a.Size(RANK - 2) == N && a.Size(RANK - 1) == N,
+              matxInvalidSize);
+
+  [[maybe_unused]] const index_t batches = batch_count(a, 2);
+  [[maybe_unused]] tensor_impl_t<T, RANK> &o_base = a_inv;
+  [[maybe_unused]] const tensor_impl_t<T, RANK> &a_base = a;
+#ifdef __CUDACC__
+  int *d_info;
+  matxAlloc(reinterpret_cast<void **>(&d_info), sizeof(*d_info),
+            MATX_ASYNC_DEVICE_MEMORY, stream);
+  cudaMemsetAsync(d_info, 0, sizeof(*d_info), stream);
+
+  const unsigned int blocks = static_cast<unsigned int>(
+      (batches + SMALL_MATRIX_BLOCK - 1) / SMALL_MATRIX_BLOCK);
+  SmallInv<N><<<blocks, SMALL_MATRIX_BLOCK, 0, stream>>>(o_base, a_base,
+                                                         batches, d_info);
+
+  int h_info = 0;
+  cudaMemcpyAsync(&h_info, d_info, sizeof(h_info), cudaMemcpyDeviceToHost,
+                  stream);
+  cudaStreamSynchronize(stream);
+  matxFree(d_info);
+  MATX_ASSERT_STR(h_info == 0, matxLUError,
+                  "Small matrix inverse input is singular");
+#endif
+}
+
+/**
+ * Host batched small matrix inverse with a compile-time size
+ *
+ * Sizes up to 4 use the closed-form adjugate, larger ones Gauss-Jordan with
+ * partial pivoting, both interleaved across SMALL_MATRIX_HOST_LANES
+ * matrices so the compiler vectorizes over the batch. A zero determinant or
+ * pivot in any matrix raises matxLUError, as in the host LU path.
+ *
+ * @tparam N
+ *   Matrix size
+ *
+ * @param a_inv
+ *   Inverse of A
+ * @param a
+ *   Input matrix A
+ * @param exec
+ *   Host executor
+ */
+template <index_t N, typename T, int RANK>
+void inv_small(tensor_t<T, RANK> a_inv, const tensor_t<T, RANK> &a,
+               const HostExecutor &exec)
+{
+  using compute_t = promote_matx_half_t<T>;
+  constexpr index_t W = SMALL_MATRIX_HOST_LANES;
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(a.Size(RANK - 2) == N && a.Size(RANK - 1) == N,
+              matxInvalidSize);
+
+  std::atomic<bool> ok{true};
+  matxSmallHostGroups(batch_count(a, 2), exec, [&](index_t b0, index_t nw) {
+    compute_t av[N][N][W];
+    compute_t xv[N][N][W];
+    // Idle lanes hold the identity so they stay finite
+    for (index_t i = 0; i < N; i++) {
+      for (index_t j = 0; j < N; j++) {
+        for (index_t w = 0; w < W; w++) {
+          av[i][j][w] = i == j ? compute_t(1) : compute_t(0);
+        }
+      }
+    }
+    for (index_t w = 0; w < nw; w++) {
+      for (index_t i = 0; i < N; i++) {
+        for (index_t j = 0; j < N; j++) {
+          av[i][j][w] = static_cast<compute_t>(batch_at2(a, b0 + w, i, j));
+        }
+      }
+    }
+
+    bool lanes_ok;
+    if constexpr (N <= 4) {
+      lanes_ok = matxSmallAdjInvLanes(xv, av);
+    }
+    else {
+      lanes_ok = matxSmallInvLanes(xv, av);
+    }
+    if (!lanes_ok) {
+      ok = false;
+    }
+
+    for (index_t w = 0; w < nw; w++) {
+      for (index_t i = 0; i < N; i++) {
+        for (index_t j = 0; j < N; j++) {
+          batch_at2(a_inv, b0 + w, i, j) = static_cast<T>(xv[i][j][w]);
+        }
+      }
+    }
+  });
+  MATX_ASSERT_STR(ok, matxLUError, "Small matrix inverse input is singular");
+}
+
+/**
+ * Batched small matrix determinant with a compile-time size
+ *
+ * LU with partial pivoting, fully unrolled with each matrix in registers.
+ *
+ * @tparam N
+ *   Matrix size
+ *
+ * @param out
+ *   Determinant of each matrix in the batch
+ * @param a
+ *   Input matrix A
+ * @param stream
+ *   CUDA stream
+ */
+template <index_t N, typename T, int RANK>
+void det_small(tensor_t<T, RANK - 2> &out, const tensor_t<T, RANK> &a,
+               cudaStream_t stream = 0)
+{
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(a.Size(RANK - 2) == N && a.Size(RANK - 1) == N,
+              matxInvalidSize);
+
+  [[maybe_unused]] const index_t batches = batch_count(a, 2);
+  [[maybe_unused]] tensor_impl_t<T, RANK - 2> &o_base = out;
+  [[maybe_unused]] const tensor_impl_t<T, RANK> &a_base = a;
+#ifdef __CUDACC__
+  const unsigned int blocks = static_cast<unsigned int>(
+      (batches + SMALL_MATRIX_BLOCK - 1) / SMALL_MATRIX_BLOCK);
+  SmallDet<N><<<blocks, SMALL_MATRIX_BLOCK, 0, stream>>>(o_base, a_base,
+                                                         batches);
+#endif
+}
+
+/**
+ * Host batched small matrix determinant with a compile-time size
+ *
+ * @tparam N
+ *   Matrix size
+ *
+ * @param out
+ *   Determinant of each matrix in the batch
+ * @param a
+ *   Input matrix A
+ * @param exec
+ *   Host executor
+ */
+template <index_t N, typename T, int RANK>
+void det_small(tensor_t<T, RANK - 2> &out, const tensor_t<T, RANK> &a,
+               const HostExecutor &exec)
+{
+  using compute_t = promote_matx_half_t<T>;
+  constexpr index_t W = SMALL_MATRIX_HOST_LANES;
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  MATX_ASSERT(a.Size(RANK - 2) == N && a.Size(RANK - 1) == N,
+              matxInvalidSize);
+
+  matxSmallHostGroups(batch_count(a, 2), exec, [&](index_t b0, index_t nw) {
+    compute_t av[N][N][W];
+    compute_t dv[W];
+    for (index_t i = 0; i < N; i++) {
+      for (index_t j = 0; j < N; j++) {
+        for (index_t w = 0; w < W; w++) {
+          av[i][j][w] = i == j ? compute_t(1) : compute_t(0);
+        }
+      }
+    }
+    for (index_t w = 0; w < nw; w++) {
+      for (index_t i = 0; i < N; i++) {
+        for (index_t j = 0; j < N; j++) {
+          av[i][j][w] = static_cast<compute_t>(batch_at2(a, b0 + w, i, j));
+        }
+      }
+    }
+
+    matxSmallDetLanes(dv, av);
+
+    for (index_t w = 0; w < nw; w++) {
+      batch_at0(out, b0 + w) = static_cast<T>(dv[w]);
+    }
+  });
+}
+
+/**
+ * Run a GEMM through the small-matrix engine if it qualifies
+ *
+ * Batched square problems up to SMALL_MATRIX_MAX_DIM are dispatched onto the
+ * compile-time kernels. Only square sizes are dispatched automatically to
+ * bound the number of instantiations; other small shapes can call
+ * matmul_small directly.
+ *
+ * @returns
+ *   True if the GEMM was run
+ */
+template <typename TC, typename TA, typename TB, int RANK, typename Executor,
+          typename Epi = matxNoEpilogue_t>
+inline bool matxMatMulSmallTry(tensor_t<TC, RANK> &c,
+                               const tensor_t<TA, RANK> &a,
+                               const tensor_t<TB, RANK> &b, Executor &&ex,
+                               float alpha, float beta, const Epi &epi = {})
+{
+  if constexpr (RANK < 3) {
+    return false;
+  }
+  else {
+    const index_t n = c.Size(RANK - 1);
+    if (c.Size(RANK - 2) != n || a.Size(RANK - 1) != n) {
+      return false;
+    }
+
+    return matxSmallDispatch(n, [&](auto ic) {
+      constexpr index_t SN = decltype(ic)::value;
+      matmul_small<SN, SN, SN>(c, a, b, ex, alpha, beta, epi);
+    });
+  }
+}
+
+} // end namespace matx
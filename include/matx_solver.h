@@ -36,6 +36,8 @@
 #include "cusolverDn.h"
 #include "matx_dim.h"
 #include "matx_error.h"
+#include "matx_small_matrix.h"
+#include "matx_solver_host.h"
 #include "matx_tensor.h"
 #include <cstdio>
 #include <numeric>
@@ -354,6 +356,106 @@ void chol(tensor_t<T1, RANK> &out, const tensor_t<T1, RANK> &a,
   matxFree(tp);
 }
 
+/**
+ * Host plan for Cholesky factorization
+ *
+ * Factors each batch with a right-looking blocked algorithm whose trailing
+ * updates run on the host GEMM. Batches of matrices up to
+ * HOST_SOLVER_SMALL_DIM are instead factored SMALL_MATRIX_HOST_LANES at a
+ * time in an interleaved layout that vectorizes across the batch. The plan
+ * holds no state, so it is built on every call rather than cached.
+ *
+ * @tparam T1
+ *  Data type of A matrix
+ * @tparam RANK
+ *  Rank of A matrix
+ */
+template <typename T1, int RANK> class matxDnCholHostPlan_t {
+public:
+  /**
+   * Construct a host Cholesky plan
+   *
+   * @param a
+   *   Input tensor view
+   * @param uplo
+   *   Use upper or lower triangle for computation
+   */
+  matxDnCholHostPlan_t([[maybe_unused]] const tensor_t<T1, RANK> &a,
+                       [[maybe_unused]] cublasFillMode_t uplo =
+                           CUBLAS_FILL_MODE_UPPER)
+  {
+    MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_matx_half_v<T1> && !is_complex_half_v<T1>,
+                           matxInvalidType,
+                           "Host Cholesky does not support half types");
+  }
+
+  /**
+   * Execute a Cholesky factorization on the host
+   *
+   * The selected triangle of out receives the factor and the other triangle
+   * is left as it was in a. Throws matxSolverError if any batch is not
+   * positive definite.
+   *
+   * @param out
+   *   Output tensor
+   * @param a
+   *   Input tensor
+   * @param exec
+   *   Host executor
+   * @param uplo
+   *   Part of matrix to fill
+   */
+  void Exec(tensor_t<T1, RANK> &out, const tensor_t<T1, RANK> &a,
+            const HostExecutor &exec,
+            cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+  {
+    // Ensure matrix is square
+    MATX_ASSERT(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize);
+
+    // Ensure output size matches input
+    for (int i = 0; i < RANK; i++) {
+      MATX_ASSERT(out.Size(i) == a.Size(i), matxInvalidSize);
+    }
+
+    if (out.Data() != a.Data()) {
+      (out = a).run(exec);
+    }
+
+    MATX_ASSERT(matxHostChol(out, uplo == CUBLAS_FILL_MODE_UPPER, exec),
+                matxSolverError);
+  }
+};
+
+/**
+ * Perform a Cholesky decomposition on the host
+ *
+ * Same semantics as the stream version. Row-major inputs are factored in
+ * place, so no transposes are needed.
+ *
+ * @tparam T1
+ *   Data type of matrix A
+ * @tparam RANK
+ *   Rank of matrix A
+ *
+ * @param out
+ *   Output tensor
+ * @param a
+ *   Input tensor
+ * @param exec
+ *   Host executor
+ * @param uplo
+ *   Part of matrix to fill
+ */
+template <typename T1, int RANK>
+void chol(tensor_t<T1, RANK> &out, const tensor_t<T1, RANK> &a,
+          const HostExecutor &exec,
+          cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+{
+  matxDnCholHostPlan_t<T1, RANK> plan{a, uplo};
+  plan.Exec(out, a, exec, uplo);
+}
+
 /***************************************** LU FACTORIZATION
  * *********************************************/
 
@@ -574,13 +676,113 @@ void lu(tensor_t<T1, RANK> &out, tensor_t<int64_t, RANK - 1> &piv,
   matxFree(tp);
 }
 
+/**
+ * Host plan for LU factorization with partial pivoting
+ *
+ * Factors each batch with a right-looking blocked algorithm: panels are
+ * factored with partial pivoting, and the trailing matrix is updated with
+ * the host GEMM. Batches of matrices up to HOST_SOLVER_SMALL_DIM are instead
+ * factored SMALL_MATRIX_HOST_LANES at a time in an interleaved layout. The
+ * output and 1-based pivots match the cuSolver plan. The plan holds no
+ * state, so it is built on every call rather than cached.
+ *
+ * @tparam T1
+ *  Data type of A matrix
+ * @tparam RANK
+ *  Rank of A matrix
+ */
+template <typename T1, int RANK> class matxDnLUHostPlan_t {
+public:
+  /**
+   * Construct a host LU plan
+   *
+   * @param piv
+   *   Pivot indices
+   * @param a
+   *   Input tensor view
+   */
+  matxDnLUHostPlan_t([[maybe_unused]] tensor_t<int64_t, RANK - 1> &piv,
+                     [[maybe_unused]] const tensor_t<T1, RANK> &a)
+  {
+    MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_matx_half_v<T1> && !is_complex_half_v<T1>,
+                           matxInvalidType,
+                           "Host LU does not support half types");
+  }
+
+  /**
+   * Execute an LU factorization on the host
+   *
+   * Throws matxSolverError if any batch is singular.
+   *
+   * @param out
+   *   Output tensor view
+   * @param piv
+   *   Output of pivot indices
+   * @param a
+   *   Input matrix A
+   * @param exec
+   *   Host executor
+   */
+  void Exec(tensor_t<T1, RANK> &out, tensor_t<int64_t, RANK - 1> &piv,
+            const tensor_t<T1, RANK> &a, const HostExecutor &exec)
+  {
+    for (int i = 0; i < RANK; i++) {
+      MATX_ASSERT(out.Size(i) == a.Size(i), matxInvalidSize);
+    }
+    for (int i = 0; i < RANK - 2; i++) {
+      MATX_ASSERT(piv.Size(i) == a.Size(i), matxInvalidSize);
+    }
+    MATX_ASSERT(piv.Size(RANK - 2) ==
+                    std::min(a.Size(RANK - 2), a.Size(RANK - 1)),
+                matxInvalidSize);
+    MATX_ASSERT(piv.Stride(RANK - 2) == 1, matxInvalidParameter);
+
+    if (out.Data() != a.Data()) {
+      (out = a).run(exec);
+    }
+
+    MATX_ASSERT(matxHostLU(out, piv, exec), matxSolverError);
+  }
+};
+
+/**
+ * Perform a LU decomposition on the host
+ *
+ * Same semantics as the stream version. Row-major inputs are factored in
+ * place, so no transposes are needed.
+ *
+ * @tparam T1
+ *   Data type of matrix A
+ * @tparam RANK
+ *   Rank of matrix A
+ *
+ * @param out
+ *   Output tensor view
+ * @param piv
+ *   Output of pivot indices
+ * @param a
+ *   Input matrix A
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void lu(tensor_t<T1, RANK> &out, tensor_t<int64_t, RANK - 1> &piv,
+        const tensor_t<T1, RANK> &a, const HostExecutor &exec)
+{
+  matxDnLUHostPlan_t<T1, RANK> plan{piv, a};
+  plan.Exec(out, piv, a, exec);
+}
+
 /**
  * Compute the determinant of a matrix
  *
  * Computes the terminant of a matrix by first computing the LU composition,
- * then reduces the product of the diagonal elements of U. The input and output
+ * then reduces the product of the diagonal elements of U, negated once for
+ * every row interchange. The input and output
  * parameters may be the same tensor. In that case, the input is destroyed and
- * the output is stored in-place.
+ * the output is stored in-place. Batches of square matrices up to
+ * SMALL_MATRIX_MAX_DIM use the register-resident small-matrix kernels instead.
  *
  * @tparam T1
  *   Data type of matrix A
@@ -598,6 +800,16 @@ template <typename T1, int RANK>
 void det(tensor_t<T1, RANK - 2> &out, const tensor_t<T1, RANK> &a,
          const cudaStream_t stream = 0)
 {
+  // Batches of tiny matrices are factored one per thread in registers
+  if constexpr (RANK >= 3) {
+    if (a.Size(RANK - 1) == a.Size(RANK - 2) &&
+        matxSmallDispatch(a.Size(RANK - 1), [&](auto ic) {
+          det_small<decltype(ic)::value>(out, a, stream);
+        })) {
+      return;
+    }
+  }
+
   // Get parameters required by these tensors
   tensorShape_t<RANK - 1> s;
 
@@ -611,8 +823,14 @@ void det(tensor_t<T1, RANK - 2> &out, const tensor_t<T1, RANK> &a,
   tensor_t<int64_t, RANK - 1> piv{s};
   tensor_t<T1, RANK> ac{a.Shape()};
 
+  tensor_t<T1, RANK - 1> d{s};
+
   lu(ac, piv, a, stream);
-  prod(out, diag(ac), stream);
+  (d = diag(ac)).run(stream);
+
+  // Every row interchange recorded in the 1-based pivots flips the sign
+  IF(piv != range_x<int64_t>(s, 1, 1), d = T1(0) - d).run(stream);
+  prod(out, d, stream);
 }
 
 /***************************************** QR FACTORIZATION
@@ -843,6 +1061,102 @@ void qr(tensor_t<T1, RANK> &out, tensor_t<T1, RANK - 1> &tau,
   matxFree(tp);
 }
 
+/**
+ * Host plan for QR factorization
+ *
+ * Factors each batch with blocked Householder QR. The reflectors of each
+ * panel are combined in compact-WY form so the trailing updates run on the
+ * host GEMM. Batches are spread across threads when there are enough of
+ * them, and otherwise each matrix uses every thread. The output and tau
+ * match the cuSolver plan. The plan holds no state, so it is built on every
+ * call rather than cached.
+ *
+ * @tparam T1
+ *  Data type of A matrix
+ * @tparam RANK
+ *  Rank of A matrix
+ */
+template <typename T1, int RANK> class matxDnQRHostPlan_t {
+public:
+  /**
+   * Construct a host QR plan
+   *
+   * @param tau
+   *   Scaling factors for reflections
+   * @param a
+   *   Input tensor view
+   */
+  matxDnQRHostPlan_t([[maybe_unused]] tensor_t<T1, RANK - 1> &tau,
+                     [[maybe_unused]] const tensor_t<T1, RANK> &a)
+  {
+    MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_matx_half_v<T1> && !is_complex_half_v<T1>,
+                           matxInvalidType,
+                           "Host QR does not support half types");
+  }
+
+  /**
+   * Execute a QR factorization on the host
+   *
+   * @param out
+   *   Output tensor view
+   * @param tau
+   *   Output of reflection scalar values
+   * @param a
+   *   Input tensor A
+   * @param exec
+   *   Host executor
+   */
+  void Exec(tensor_t<T1, RANK> &out, tensor_t<T1, RANK - 1> &tau,
+            const tensor_t<T1, RANK> &a, const HostExecutor &exec)
+  {
+    for (int i = 0; i < RANK; i++) {
+      MATX_ASSERT(out.Size(i) == a.Size(i), matxInvalidSize);
+    }
+    for (int i = 0; i < RANK - 2; i++) {
+      MATX_ASSERT(tau.Size(i) == a.Size(i), matxInvalidSize);
+    }
+    MATX_ASSERT(tau.Size(RANK - 2) ==
+                    std::min(a.Size(RANK - 2), a.Size(RANK - 1)),
+                matxInvalidSize);
+    MATX_ASSERT(tau.Stride(RANK - 2) == 1, matxInvalidParameter);
+
+    if (out.Data() != a.Data()) {
+      (out = a).run(exec);
+    }
+
+    matxHostQR(out, tau, exec);
+  }
+};
+
+/**
+ * Perform a QR decomposition on the host
+ *
+ * Same semantics as the stream version. Row-major inputs are factored in
+ * place, so no transposes are needed.
+ *
+ * @tparam T1
+ *   Data type of matrix A
+ * @tparam RANK
+ *   Rank of matrix A
+ *
+ * @param out
+ *   Output tensor view
+ * @param tau
+ *   Output of reflection scalar values
+ * @param a
+ *   Input tensor A
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void qr(tensor_t<T1, RANK> &out, tensor_t<T1, RANK - 1> &tau,
+        const tensor_t<T1, RANK> &a, const HostExecutor &exec)
+{
+  matxDnQRHostPlan_t<T1, RANK> plan{tau, a};
+  plan.Exec(out, tau, a, exec);
+}
+
 /********************************************** SVD
  * *********************************************/
 
@@ -1120,6 +1434,173 @@ void svd(tensor_t<T2, RANK> &u, tensor_t<T3, RANK - 1> &s,
   matxFree(tp);
 }
 
+/**
+ * Host plan for singular value decomposition
+ *
+ * Each batch is reduced with the blocked host QR, and one-sided Jacobi with a
+ * round-robin rotation order then runs on the conjugate transpose of the
+ * triangular factor, which converges in a few sweeps for square and
+ * rectangular inputs alike. Within a step the pairs are disjoint, so large
+ * matrices apply them in parallel. Batches are spread across threads when
+ * there are enough of them. The plan holds no state, so it is built on every
+ * call rather than cached.
+ *
+ * @tparam T1
+ *  Data type of A matrix
+ * @tparam T2
+ *  Data type of U matrix
+ * @tparam T3
+ *  Data type of S vector
+ * @tparam T4
+ *  Data type of V matrix
+ * @tparam RANK
+ *  Rank of A, U, and V matrices, and RANK-1 of S
+ */
+template <typename T1, typename T2, typename T3, typename T4, int RANK>
+class matxDnSVDHostPlan_t {
+public:
+  /**
+   * Construct a host SVD plan
+   *
+   * @param u
+   *   Output tensor view for U matrix
+   * @param s
+   *   Output tensor view for S matrix
+   * @param v
+   *   Output tensor view for V matrix
+   * @param a
+   *   Input tensor view for A matrix
+   * @param jobu
+   *   Compute all ('A'), the first min(m, n) ('S'), or none ('N') of the
+   *   columns of U
+   * @param jobvt
+   *   Compute all ('A'), the first min(m, n) ('S'), or none ('N') of the
+   *   rows of V^H
+   */
+  matxDnSVDHostPlan_t([[maybe_unused]] tensor_t<T2, RANK> &u,
+                      [[maybe_unused]] tensor_t<T3, RANK - 1> &s,
+                      [[maybe_unused]] tensor_t<T4, RANK> &v,
+                      [[maybe_unused]] const tensor_t<T1, RANK> &a,
+                      [[maybe_unused]] const char jobu = 'A',
+                      [[maybe_unused]] const char jobvt = 'A')
+  {
+    MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_matx_half_v<T1> && !is_complex_half_v<T1>,
+                           matxInvalidType,
+                           "Host SVD does not support half types");
+    MATX_STATIC_ASSERT_STR((std::is_same_v<T1, T2> && std::is_same_v<T1, T4> &&
+                            std::is_same_v<T3, value_type_t<T1>>),
+                           matxInvalidType,
+                           "Host SVD requires U and V of the input type and "
+                           "real singular values");
+  }
+
+  /**
+   * Execute an SVD on the host
+   *
+   * U and V^H are written column-major, the same layout as the stream
+   * version, so u(j, i) = U(i, j) and v(j, i) = V^H(i, j). Transposing u and
+   * v gives A = U * diag(S) * V^H. Throws matxSolverError if the Jacobi
+   * sweeps do not converge.
+   *
+   * @param u
+   *   U matrix output
+   * @param s
+   *   Sigma matrix output
+   * @param v
+   *   V^H matrix output
+   * @param a
+   *   Input matrix A
+   * @param exec
+   *   Host executor
+   * @param jobu
+   *   Columns of U to compute: 'A', 'S' or 'N'
+   * @param jobvt
+   *   Rows of V^H to compute: 'A', 'S' or 'N'
+   */
+  void Exec(tensor_t<T2, RANK> &u, tensor_t<T3, RANK - 1> &s,
+            tensor_t<T4, RANK> &v, const tensor_t<T1, RANK> &a,
+            const HostExecutor &exec, const char jobu = 'A',
+            const char jobvt = 'A')
+  {
+    const index_t m = a.Size(RANK - 2);
+    const index_t n = a.Size(RANK - 1);
+    const index_t k = std::min(m, n);
+    MATX_ASSERT_STR(jobu == 'A' || jobu == 'S' || jobu == 'N',
+                    matxInvalidParameter, "jobu must be 'A', 'S' or 'N'");
+    MATX_ASSERT_STR(jobvt == 'A' || jobvt == 'S' || jobvt == 'N',
+                    matxInvalidParameter, "jobvt must be 'A', 'S' or 'N'");
+    MATX_ASSERT(s.Size(RANK - 2) == k, matxInvalidSize);
+    if (jobu != 'N') {
+      MATX_ASSERT(u.Size(RANK - 1) == m &&
+                      u.Size(RANK - 2) >= (jobu == 'A' ? m : k),
+                  matxInvalidSize);
+    }
+    if (jobvt != 'N') {
+      MATX_ASSERT(v.Size(RANK - 2) == n &&
+                      v.Size(RANK - 1) >= (jobvt == 'A' ? n : k),
+                  matxInvalidSize);
+    }
+    for (int i = 0; i < RANK - 2; i++) {
+      MATX_ASSERT(s.Size(i) == a.Size(i), matxInvalidSize);
+    }
+
+    // Transposed views give the column-major layout
+    const index_t batches = batch_count(a, 2);
+    std::atomic<bool> good{true};
+    matxHostSolverBatches(
+        batches, exec, [&](index_t b, const HostExecutor &ex) {
+          if (!matxHostSVDOne(
+                  matxHostSolverBatch(a, b), &batch_at(s, b, 0),
+                  s.Stride(RANK - 2),
+                  jobu != 'N' ? matxHostSolverBatch(u, b).Trans()
+                              : matxHostSolverMat_t<T2>{nullptr, 0, 0},
+                  jobvt != 'N' ? matxHostSolverBatch(v, b).Trans()
+                               : matxHostSolverMat_t<T4>{nullptr, 0, 0},
+                  m, n, jobu, jobvt, ex)) {
+            good = false;
+          }
+        });
+    MATX_ASSERT_STR(good, matxSolverError, "Host SVD did not converge");
+  }
+};
+
+/**
+ * Perform a SVD decomposition on the host
+ *
+ * See matxDnSVDHostPlan_t. U and V^H are returned column-major, as in the
+ * stream version.
+ *
+ * @tparam T1
+ *   Data type of matrix A
+ * @tparam RANK
+ *   Rank of matrix A
+ *
+ * @param u
+ *   U matrix output
+ * @param s
+ *   Sigma matrix output
+ * @param v
+ *   V^H matrix output
+ * @param a
+ *   Input matrix A
+ * @param exec
+ *   Host executor
+ * @param jobu
+ *   Columns of U to compute: 'A', 'S' or 'N'
+ * @param jobvt
+ *   Rows of V^H to compute: 'A', 'S' or 'N'
+ */
+template <typename T1, typename T2, typename T3, typename T4, int RANK>
+void svd(tensor_t<T2, RANK> &u, tensor_t<T3, RANK - 1> &s,
+         tensor_t<T4, RANK> &v, const tensor_t<T1, RANK> &a,
+         const HostExecutor &exec, const char jobu = 'A',
+         const char jobvt = 'A')
+{
+  matxDnSVDHostPlan_t<T1, T2, T3, T4, RANK> plan{u, s, v, a, jobu, jobvt};
+  plan.Exec(u, s, v, a, exec, jobu, jobvt);
+}
+
 /*************************************** Eigenvalues and eigenvectors
  * *************************************/
 
@@ -1374,4 +1855,686 @@ void eig(tensor_t<T1, RANK> &out, tensor_t<T2, RANK - 1> &w,
   matxFree(tp);
 }
 
+/**
+ * Host plan for Hermitian eigen decomposition
+ *
+ * Each batch is reduced to a real symmetric tridiagonal with blocked
+ * Householder reflectors, as in LAPACK sytrd/hetrd, and the tridiagonal is
+ * solved by divide and conquer. The eigenvectors are back-transformed with
+ * the same compact-WY blocks as the host QR. When only eigenvalues are
+ * requested the tridiagonal is solved with implicit QL instead, skipping all
+ * of the vector work. Batches are spread across threads when there are
+ * enough of them. The plan holds no state, so it is built on every call
+ * rather than cached.
+ *
+ * @tparam T1
+ *  Data type of A matrix
+ * @tparam T2
+ *  Data type of W matrix
+ * @tparam RANK
+ *  Rank of A matrix
+ */
+template <typename T1, typename T2, int RANK>
+class matxDnEigHostPlan_t {
+public:
+  /**
+   * Construct a host eigen decomposition plan
+   *
+   * @param w
+   *   Eigenvalues of A
+   * @param a
+   *   Input tensor view
+   * @param jobz
+   *   CUSOLVER_EIG_MODE_VECTOR to compute eigenvectors or
+   * CUSOLVER_EIG_MODE_NOVECTOR to not compute
+   * @param uplo
+   *   Triangle of A to read
+   */
+  matxDnEigHostPlan_t([[maybe_unused]] tensor_t<T2, RANK - 1> &w,
+                      [[maybe_unused]] const tensor_t<T1, RANK> &a,
+                      [[maybe_unused]] cusolverEigMode_t jobz =
+                          CUSOLVER_EIG_MODE_VECTOR,
+                      [[maybe_unused]] cublasFillMode_t uplo =
+                          CUBLAS_FILL_MODE_UPPER)
+  {
+    MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_matx_half_v<T1> && !is_complex_half_v<T1>,
+                           matxInvalidType,
+                           "Host eigen decomposition does not support half "
+                           "types");
+    MATX_STATIC_ASSERT_STR((std::is_same_v<T2, value_type_t<T1>>),
+                           matxInvalidType,
+                           "Host eigen decomposition requires real "
+                           "eigenvalues of the input precision");
+  }
+
+  /**
+   * Execute an eigen decomposition on the host
+   *
+   * Eigenvalues are returned in ascending order. With
+   * CUSOLVER_EIG_MODE_VECTOR, column j of out holds the eigenvector of
+   * w[j], matching the layout returned by the stream version; otherwise out
+   * is not written. out may be the same tensor as a.
+   *
+   * @param out
+   *   Eigenvectors output
+   * @param w
+   *   Eigenvalues output
+   * @param a
+   *   Input matrix A
+   * @param exec
+   *   Host executor
+   * @param jobz
+   *   CUSOLVER_EIG_MODE_VECTOR to compute eigenvectors or
+   * CUSOLVER_EIG_MODE_NOVECTOR to not compute
+   * @param uplo
+   *   Triangle of A to read
+   */
+  void Exec(tensor_t<T1, RANK> &out, tensor_t<T2, RANK - 1> &w,
+            const tensor_t<T1, RANK> &a, const HostExecutor &exec,
+            cusolverEigMode_t jobz = CUSOLVER_EIG_MODE_VECTOR,
+            cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+  {
+    MATX_ASSERT(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize);
+    for (int i = 0; i < RANK; i++) {
+      MATX_ASSERT(out.Size(i) == a.Size(i), matxInvalidSize);
+    }
+    for (int i = 0; i < RANK - 1; i++) {
+      MATX_ASSERT(w.Size(i) == a.Size(i), matxInvalidSize);
+    }
+
+    const bool ok =
+        matxHostEig(out, w, a, jobz == CUSOLVER_EIG_MODE_VECTOR,
+                    uplo == CUBLAS_FILL_MODE_UPPER, exec);
+    MATX_ASSERT_STR(ok, matxSolverError,
+                    "Host eigen decomposition did not converge");
+  }
+};
+
+/**
+ * Perform a Eig decomposition on the host
+ *
+ * See matxDnEigHostPlan_t. Eigenvalues are returned in ascending order and
+ * column j of out holds the eigenvector of w[j]. The input and output
+ * parameters may be the same tensor.
+ *
+ * @tparam T1
+ *   Data type of matrix A
+ * @tparam RANK
+ *   Rank of matrix A
+ *
+ * @param out
+ *   Output tensor view
+ * @param w
+ *   Eigenvalues output
+ * @param a
+ *   Input matrix A
+ * @param exec
+ *   Host executor
+ * @param jobz
+ *   CUSOLVER_EIG_MODE_VECTOR to compute eigenvectors or
+ * CUSOLVER_EIG_MODE_NOVECTOR to not compute
+ * @param uplo
+ *   Triangle of A to read
+ */
+template <typename T1, typename T2, int RANK>
+void eig(tensor_t<T1, RANK> &out, tensor_t<T2, RANK - 1> &w,
+         const tensor_t<T1, RANK> &a, const HostExecutor &exec,
+         cusolverEigMode_t jobz = CUSOLVER_EIG_MODE_VECTOR,
+         cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+{
+  matxDnEigHostPlan_t<T1, T2, RANK> plan{w, a, jobz, uplo};
+  plan.Exec(out, w, a, exec, jobz, uplo);
+}
+
+/*************************************** Linear solves
+ * *************************************/
+
+typedef enum {
+  MAT_SOLVE_ALGO_LU,
+  MAT_SOLVE_ALGO_CHOL,
+} MatSolveAlgo_t;
+
+/**
+ * Parameters needed to solve A * X = B. We distinguish unique solves mostly
+ * by the sizes of A and B and the factorization used.
+ */
+struct DnSolveParams_t {
+  int64_t n;
+  int64_t nrhs;
+  void *A;
+  void *B;
+  size_t batch_size;
+  MatSolveAlgo_t algo;
+  cublasFillMode_t uplo;
+  MatXDataType_t dtype;
+};
+
+template <typename T1, int RANK>
+class matxDnSolveSolverPlan_t : public matxDnSolver_t {
+public:
+  /**
+   * Plan for solving \f$\textbf{A} * \textbf{X} = \textbf{B}\f$ without
+   * forming the inverse of A
+   *
+   * With MAT_SOLVE_ALGO_LU, A is factored with getrf and X found with getrs.
+   * With MAT_SOLVE_ALGO_CHOL, A already holds a Cholesky factor in the uplo
+   * triangle and X is found with potrs. Both operate on column-major views.
+   *
+   * @tparam T1
+   *  Data type of A and B matrices
+   * @tparam RANK
+   *  Rank of A and B matrices
+   *
+   * @param a
+   *   Input tensor view of A or its Cholesky factor
+   * @param b
+   *   Right-hand sides
+   * @param algo
+   *   Factorization to use
+   * @param uplo
+   *   Triangle holding the Cholesky factor
+   */
+  matxDnSolveSolverPlan_t(const tensor_t<T1, RANK> &a,
+                          const tensor_t<T1, RANK> &b,
+                          MatSolveAlgo_t algo = MAT_SOLVE_ALGO_LU,
+                          cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+  {
+    static_assert(RANK >= 2);
+
+    params = GetSolveParams(a, b, algo, uplo);
+    GetWorkspaceSize(&hspace, &dspace);
+    AllocateWorkspace(params.batch_size);
+    if (params.algo == MAT_SOLVE_ALGO_LU) {
+      matxAlloc(reinterpret_cast<void **>(&d_piv),
+                params.batch_size * params.n * sizeof(*d_piv),
+                MATX_DEVICE_MEMORY);
+    }
+  }
+
+  void GetWorkspaceSize(size_t *host, size_t *device) override
+  {
+    // potrs needs no workspace, so reserve a minimal allocation
+    *host = 1;
+    *device = 1;
+    if (params.algo == MAT_SOLVE_ALGO_LU) {
+      cusolverStatus_t ret = cusolverDnXgetrf_bufferSize(
+          handle, dn_params, params.n, params.n, MatXTypeToCudaType<T1>(),
+          params.A, params.n, MatXTypeToCudaType<T1>(), device, host);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+    }
+  }
+
+  static DnSolveParams_t GetSolveParams(const tensor_t<T1, RANK> &a,
+                                        const tensor_t<T1, RANK> &b,
+                                        MatSolveAlgo_t algo,
+                                        cublasFillMode_t uplo)
+  {
+    DnSolveParams_t params;
+    params.batch_size = matxDnSolver_t::GetNumBatches(a);
+    params.n = a.Size(RANK - 1);
+    params.nrhs = b.Size(RANK - 2);
+    params.A = a.Data();
+    params.B = b.Data();
+    params.algo = algo;
+    params.uplo = uplo;
+    params.dtype = TypeToInt<T1>();
+
+    return params;
+  }
+
+  /**
+   * Execute the solve on column-major views. A is overwritten by its factors
+   * for MAT_SOLVE_ALGO_LU and B by the solution.
+   *
+   * @param a
+   *   A, or its Cholesky factor, with shape [..., n, n]
+   * @param b
+   *   Right-hand sides with shape [..., nrhs, n]
+   * @param stream
+   *   CUDA stream
+   */
+  void Exec(tensor_t<T1, RANK> &a, tensor_t<T1, RANK> &b,
+            const cudaStream_t stream = 0)
+  {
+    MATX_ASSERT(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize);
+    MATX_ASSERT(b.Size(RANK - 1) == a.Size(RANK - 1), matxInvalidSize);
+    for (int i = 0; i < RANK - 2; i++) {
+      MATX_ASSERT(b.Size(i) == a.Size(i), matxInvalidSize);
+    }
+
+    cusolverDnSetStream(handle, stream);
+
+    batch_a_ptrs.clear();
+    SetBatchPointers(b);
+    const std::vector<void *> batch_b_ptrs = batch_a_ptrs;
+    batch_a_ptrs.clear();
+    SetBatchPointers(a);
+
+    if (params.algo == MAT_SOLVE_ALGO_LU) {
+      for (size_t i = 0; i < batch_a_ptrs.size(); i++) {
+        cusolverStatus_t ret = cusolverDnXgetrf(
+            handle, dn_params, params.n, params.n, MatXTypeToCudaType<T1>(),
+            batch_a_ptrs[i], params.n, d_piv + i * params.n,
+            MatXTypeToCudaType<T1>(),
+            reinterpret_cast<uint8_t *>(d_workspace) + i * dspace, dspace,
+            reinterpret_cast<uint8_t *>(h_workspace) + i * hspace, hspace,
+            d_info + i);
+        MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+      }
+
+      // Synchronize once for the whole batch rather than after every getrf
+      std::vector<int> info(batch_a_ptrs.size());
+      cudaMemcpyAsync(info.data(), d_info, info.size() * sizeof(int),
+                      cudaMemcpyDeviceToHost, stream);
+      cudaStreamSynchronize(stream);
+      for (const int v : info) {
+        MATX_ASSERT_STR(v == 0, matxSolverError, "Matrix is singular");
+      }
+    }
+
+    for (size_t i = 0; i < batch_a_ptrs.size(); i++) {
+      cusolverStatus_t ret;
+      if (params.algo == MAT_SOLVE_ALGO_LU) {
+        ret = cusolverDnXgetrs(handle, dn_params, CUBLAS_OP_N, params.n,
+                               params.nrhs, MatXTypeToCudaType<T1>(),
+                               batch_a_ptrs[i], params.n, d_piv + i * params.n,
+                               MatXTypeToCudaType<T1>(), batch_b_ptrs[i],
+                               params.n, d_info + i);
+      }
+      else {
+        ret = cusolverDnXpotrs(handle, dn_params, params.uplo, params.n,
+                               params.nrhs, MatXTypeToCudaType<T1>(),
+                               batch_a_ptrs[i], params.n,
+                               MatXTypeToCudaType<T1>(), batch_b_ptrs[i],
+                               params.n, d_info + i);
+      }
+
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+    }
+  }
+
+  /**
+   * Solve handle destructor
+   *
+   * Destroys any helper data used for provider type and any workspace memory
+   * created
+   *
+   */
+  ~matxDnSolveSolverPlan_t() { matxFree(d_piv); }
+
+private:
+  int64_t *d_piv = nullptr;
+  DnSolveParams_t params;
+};
+
+/**
+ * Crude hash to get a reasonably good delta for collisions. This doesn't need
+ * to be perfect, but fast enough to not slow down lookups, and different enough
+ * so the common solver parameters change
+ */
+struct DnSolveParamsKeyHash {
+  std::size_t operator()(const DnSolveParams_t &k) const noexcept
+  {
+    return (std::hash<uint64_t>()(k.n)) + (std::hash<uint64_t>()(k.nrhs)) +
+           (std::hash<uint64_t>()(k.batch_size));
+  }
+};
+
+/**
+ * Test solve parameters for equality. Unlike the hash, all parameters must
+ * match.
+ */
+struct DnSolveParamsKeyEq {
+  bool operator()(const DnSolveParams_t &l, const DnSolveParams_t &t) const
+      noexcept
+  {
+    return l.n == t.n && l.nrhs == t.nrhs && l.batch_size == t.batch_size &&
+           l.algo == t.algo && l.uplo == t.uplo && l.dtype == t.dtype;
+  }
+};
+
+// Static caches of solve handles
+static matxCache_t<DnSolveParams_t, DnSolveParamsKeyHash, DnSolveParamsKeyEq>
+    dnsolve_cache;
+
+/**
+ * Run a cached device solve plan on transposed copies of A and B and copy
+ * the solution back into x
+ */
+template <typename T1, int RANK>
+void matxDnSolveDevice(tensor_t<T1, RANK> &x, const tensor_t<T1, RANK> &a,
+                       const tensor_t<T1, RANK> &b, MatSolveAlgo_t algo,
+                       cublasFillMode_t uplo, cudaStream_t stream)
+{
+  for (int i = 0; i < RANK; i++) {
+    MATX_ASSERT(x.Size(i) == b.Size(i), matxInvalidSize);
+  }
+
+  /* Temporary WAR
+     cuSolver doesn't support row-major layouts, so A and B are transposed in
+     and the solution is transposed out.
+  */
+  T1 *tpa;
+  T1 *tpb;
+  matxAlloc(reinterpret_cast<void **>(&tpa), a.Bytes(),
+            MATX_ASYNC_DEVICE_MEMORY, stream);
+  matxAlloc(reinterpret_cast<void **>(&tpb), b.Bytes(),
+            MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto at = matxDnSolver_t::TransposeCopy(tpa, a, stream);
+  auto bt = matxDnSolver_t::TransposeCopy(tpb, b, stream);
+
+  auto params =
+      matxDnSolveSolverPlan_t<T1, RANK>::GetSolveParams(at, bt, algo, uplo);
+
+  auto ret = dnsolve_cache.Lookup(params);
+  if (ret == std::nullopt) {
+    auto tmp = new matxDnSolveSolverPlan_t<T1, RANK>{at, bt, algo, uplo};
+    dnsolve_cache.Insert(params, static_cast<void *>(tmp));
+    tmp->Exec(at, bt, stream);
+  }
+  else {
+    auto solve_type =
+        static_cast<matxDnSolveSolverPlan_t<T1, RANK> *>(ret.value());
+    solve_type->Exec(at, bt, stream);
+  }
+
+  copy(x, bt.PermuteMatrix(), stream);
+  matxFree(tpa);
+  matxFree(tpb);
+}
+
+/**
+ * Solve A * X = B using a cached plan
+ *
+ * A is LU factored with partial pivoting and X is found by forward and back
+ * substitution on every column of B, which costs less and is more accurate
+ * than forming inv(A) and multiplying. A is not modified, and x may be the
+ * same tensor as b.
+ *
+ * @tparam T1
+ *   Data type of matrices
+ * @tparam RANK
+ *   Rank of matrices
+ *
+ * @param x
+ *   Solution with shape [..., n, nrhs]
+ * @param a
+ *   Square matrix A with shape [..., n, n]
+ * @param b
+ *   Right-hand sides with shape [..., n, nrhs]
+ * @param stream
+ *   CUDA stream
+ */
+template <typename T1, int RANK>
+void solve(tensor_t<T1, RANK> &x, const tensor_t<T1, RANK> &a,
+           const tensor_t<T1, RANK> &b, cudaStream_t stream = 0)
+{
+  matxDnSolveDevice(x, a, b, MAT_SOLVE_ALGO_LU, CUBLAS_FILL_MODE_UPPER, stream);
+}
+
+/**
+ * Solve A * X = B from the Cholesky factor of A using a cached plan
+ *
+ * l is the output of chol() with the same uplo: A = U^H * U for
+ * CUBLAS_FILL_MODE_UPPER or A = L * L^H for CUBLAS_FILL_MODE_LOWER. Only that
+ * triangle is read. x may be the same tensor as b.
+ *
+ * @tparam T1
+ *   Data type of matrices
+ * @tparam RANK
+ *   Rank of matrices
+ *
+ * @param x
+ *   Solution with shape [..., n, nrhs]
+ * @param l
+ *   Cholesky factor of A with shape [..., n, n]
+ * @param b
+ *   Right-hand sides with shape [..., n, nrhs]
+ * @param stream
+ *   CUDA stream
+ * @param uplo
+ *   Triangle holding the factor
+ */
+template <typename T1, int RANK>
+void cho_solve(tensor_t<T1, RANK> &x, const tensor_t<T1, RANK> &l,
+               const tensor_t<T1, RANK> &b, cudaStream_t stream = 0,
+               cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+{
+  matxDnSolveDevice(x, l, b, MAT_SOLVE_ALGO_CHOL, uplo, stream);
+}
+
+/**
+ * Reusable host factorization for solving A * X = B
+ *
+ * Factor() computes the blocked LU with partial pivoting or, for
+ * MAT_SOLVE_ALGO_CHOL, the blocked Cholesky factorization of every batch of
+ * A and keeps it. Solve() can then be called any number of times with new
+ * right-hand sides; each runs the row interchanges and two blocked
+ * triangular solves over all of its columns. Batches are spread across
+ * threads when there are enough of them.
+ *
+ * @tparam T1
+ *  Data type of A and B matrices
+ * @tparam RANK
+ *  Rank of A and B matrices
+ */
+template <typename T1, int RANK> class matxDnSolveHostPlan_t {
+public:
+  /**
+   * Construct a host factorization for matrices shaped like a
+   *
+   * @param a
+   *   Input tensor view
+   * @param algo
+   *   Factorization to use
+   */
+  matxDnSolveHostPlan_t(const tensor_t<T1, RANK> &a,
+                        MatSolveAlgo_t algo = MAT_SOLVE_ALGO_LU)
+      : algo_(algo), n_(a.Size(RANK - 1)), batches_(batch_count(a, 2))
+  {
+    MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+    MATX_STATIC_ASSERT_STR(!is_matx_half_v<T1> && !is_complex_half_v<T1>,
+                           matxInvalidType,
+                           "Host solve does not support half types");
+    MATX_ASSERT(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize);
+
+    factors_.resize(static_cast<size_t>(batches_ * n_ * n_));
+    if (algo_ == MAT_SOLVE_ALGO_LU) {
+      piv_.resize(static_cast<size_t>(batches_ * n_));
+    }
+  }
+
+  /**
+   * Factor every batch of A, replacing any previous factorization
+   *
+   * @param a
+   *   Input matrix A
+   * @param exec
+   *   Host executor
+   * @param uplo
+   *   Triangle of A read by MAT_SOLVE_ALGO_CHOL
+   */
+  void Factor(const tensor_t<T1, RANK> &a, const HostExecutor &exec,
+              cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+  {
+    MATX_ASSERT(a.Size(RANK - 1) == n_ && a.Size(RANK - 2) == n_ &&
+                    batch_count(a, 2) == batches_,
+                matxInvalidSize);
+
+    std::atomic<bool> ok{true};
+    matxHostSolverBatches(batches_, exec, [&](index_t b, const HostExecutor &ex) {
+      const auto src = matxHostSolverBatch(a, b);
+      const auto f = Batch(b);
+      if (algo_ == MAT_SOLVE_ALGO_LU) {
+        for (index_t i = 0; i < n_; i++) {
+          for (index_t j = 0; j < n_; j++) {
+            f(i, j) = src(i, j);
+          }
+        }
+        if (!matxHostLUBlocked(f, piv_.data() + b * n_, n_, n_, ex)) {
+          ok = false;
+        }
+      }
+      else {
+        // Keep the lower factor, reading A from the requested triangle
+        for (index_t i = 0; i < n_; i++) {
+          for (index_t j = 0; j <= i; j++) {
+            f(i, j) = uplo == CUBLAS_FILL_MODE_UPPER ? matxHostConj(src(j, i))
+                                                     : src(i, j);
+          }
+        }
+        if (!matxHostCholBlocked(f, n_, ex)) {
+          ok = false;
+        }
+      }
+    });
+
+    factored_ = ok;
+    if (algo_ == MAT_SOLVE_ALGO_LU) {
+      MATX_ASSERT_STR(factored_, matxSolverError, "Matrix is singular");
+    }
+    else {
+      MATX_ASSERT_STR(factored_, matxSolverError,
+                      "Matrix is not positive definite");
+    }
+  }
+
+  /**
+   * Solve A * X = B with the current factorization
+   *
+   * @param x
+   *   Solution with shape [..., n, nrhs]. May be the same tensor as b
+   * @param b
+   *   Right-hand sides with shape [..., n, nrhs]
+   * @param exec
+   *   Host executor
+   */
+  void Solve(tensor_t<T1, RANK> &x, const tensor_t<T1, RANK> &b,
+             const HostExecutor &exec) const
+  {
+    MATX_ASSERT_STR(factored_, matxInvalidParameter,
+                    "Factor must succeed before Solve");
+    MATX_ASSERT(b.Size(RANK - 2) == n_ && batch_count(b, 2) == batches_,
+                matxInvalidSize);
+    for (int i = 0; i < RANK; i++) {
+      MATX_ASSERT(x.Size(i) == b.Size(i), matxInvalidSize);
+    }
+
+    if (x.Data() != b.Data()) {
+      (x = b).run(exec);
+    }
+
+    const index_t nrhs = b.Size(RANK - 1);
+    matxHostSolverBatches(batches_, exec, [&](index_t bi, const HostExecutor &ex) {
+      if (algo_ == MAT_SOLVE_ALGO_LU) {
+        matxHostLUSolve(Batch(bi), piv_.data() + bi * n_,
+                        matxHostSolverBatch(x, bi), n_, nrhs, ex);
+      }
+      else {
+        matxHostCholSolve(Batch(bi), false, matxHostSolverBatch(x, bi), n_,
+                          nrhs, ex);
+      }
+    });
+  }
+
+private:
+  matxHostSolverMat_t<T1> Batch(index_t b) const
+  {
+    return {const_cast<T1 *>(factors_.data()) + b * n_ * n_, n_, 1};
+  }
+
+  MatSolveAlgo_t algo_;
+  index_t n_;
+  index_t batches_;
+  bool factored_ = false;
+  std::vector<T1> factors_;
+  std::vector<int64_t> piv_;
+};
+
+/**
+ * Solve A * X = B on the host
+ *
+ * See matxDnSolveHostPlan_t. A is LU factored on every call into a
+ * factorization that is released on return, so no per-shape storage outlives
+ * the call; to solve repeatedly against the same A, construct a
+ * matxDnSolveHostPlan_t, call Factor once and Solve for each set of
+ * right-hand sides.
+ *
+ * @tparam T1
+ *   Data type of matrices
+ * @tparam RANK
+ *   Rank of matrices
+ *
+ * @param x
+ *   Solution with shape [..., n, nrhs]
+ * @param a
+ *   Square matrix A with shape [..., n, n]
+ * @param b
+ *   Right-hand sides with shape [..., n, nrhs]
+ * @param exec
+ *   Host executor
+ */
+template <typename T1, int RANK>
+void solve(tensor_t<T1, RANK> &x, const tensor_t<T1, RANK> &a,
+           const tensor_t<T1, RANK> &b, const HostExecutor &exec)
+{
+  matxDnSolveHostPlan_t<T1, RANK> plan{a};
+  plan.Factor(a, exec);
+  plan.Solve(x, b, exec);
+}
+
+/**
+ * Solve A * X = B on the host from the Cholesky factor of A
+ *
+ * l is the output of chol() with the same uplo: A = U^H * U for
+ * CUBLAS_FILL_MODE_UPPER or A = L * L^H for CUBLAS_FILL_MODE_LOWER. Only that
+ * triangle is read, and the two triangular solves run blocked over every
+ * column of B. x may be the same tensor as b.
+ *
+ * @tparam T1
+ *   Data type of matrices
+ * @tparam RANK
+ *   Rank of matrices
+ *
+ * @param x
+ *   Solution with shape [..., n, nrhs]
+ * @param l
+ *   Cholesky factor of A with shape [..., n, n]
+ * @param b
+ *   Right-hand sides with shape [..., n, nrhs]
+ * @param exec
+ *   Host executor
+ * @param uplo
+ *   Triangle holding the factor
+ */
+template <typename T1, int RANK>
+void cho_solve(tensor_t<T1, RANK> &x, const tensor_t<T1, RANK> &l,
+               const tensor_t<T1, RANK> &b, const HostExecutor &exec,
+               cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+{
+  MATX_STATIC_ASSERT(RANK >= 2 && RANK <= 4, matxInvalidDim);
+  const index_t n = l.Size(RANK - 1);
+  MATX_ASSERT(l.Size(RANK - 2) == n && b.Size(RANK - 2) == n,
+              matxInvalidSize);
+  for (int i = 0; i < RANK; i++) {
+    MATX_ASSERT(x.Size(i) == b.Size(i), matxInvalidSize);
+  }
+  for (int i = 0; i < RANK - 2; i++) {
+    MATX_ASSERT(b.Size(i) == l.Size(i), matxInvalidSize);
+  }
+
+  if (x.Data() != b.Data()) {
+    (x = b).run(exec);
+  }
+
+  const index_t nrhs = b.Size(RANK - 1);
+  matxHostSolverBatches(
+      batch_count(l, 2), exec, [&](index_t bi, const HostExecutor &ex) {
+        matxHostCholSolve(matxHostSolverBatch(l, bi),
+                          uplo == CUBLAS_FILL_MODE_UPPER,
+                          matxHostSolverBatch(x, bi), n, nrhs, ex);
+      });
+}
+
 } // end namespace matx
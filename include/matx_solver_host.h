@@ -0,0 +1,2072 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "matx_error.h"
+#include "matx_exec_host.h"
+#include "matx_matmul_host.h"
+#include "matx_small_matrix.h"
+#include "matx_tensor.h"
+#include "matx_type_utils.h"
+
+namespace matx {
+
+/**
+ * Panel width of the blocked host factorizations. Panels are factored with
+ * unblocked code and the trailing matrix is updated with the host GEMM.
+ */
+constexpr index_t HOST_SOLVER_BLOCK = 64;
+
+/**
+ * Largest dimension factored by the batched lane kernels. Batches of
+ * matrices up to this size are loaded SMALL_MATRIX_HOST_LANES at a time into
+ * an interleaved layout so every step vectorizes across the batch.
+ */
+constexpr index_t HOST_SOLVER_SMALL_DIM = 16;
+
+/**
+ * Strided view of one matrix factored in place on the host
+ */
+template <typename T> struct matxHostSolverMat_t {
+  T *data;
+  index_t rs; // Row stride
+  index_t cs; // Column stride
+
+  T &operator()(index_t r, index_t c) const { return data[r * rs + c * cs]; }
+
+  /**
+   * View starting at row r and column c
+   */
+  matxHostSolverMat_t Sub(index_t r, index_t c) const
+  {
+    return {data + r * rs + c * cs, rs, cs};
+  }
+
+  /**
+   * Transposed view of the same memory
+   */
+  matxHostSolverMat_t Trans() const { return {data, cs, rs}; }
+
+  /**
+   * GEMM operand reading this view, optionally conjugated
+   */
+  matxHostGemmOperand_t<T> Operand(bool conj = false) const
+  {
+    return {data, rs, cs, conj};
+  }
+};
+
+/**
+ * View of batch b of a tensor whose last two dimensions are the matrix
+ */
+template <typename T, int RANK>
+inline matxHostSolverMat_t<T> matxHostSolverBatch(const tensor_t<T, RANK> &t,
+                                                  index_t b)
+{
+  return {t.Data() + matxHostGemmBatchOffset(t, b), t.Stride(RANK - 2),
+          t.Stride(RANK - 1)};
+}
+
+template <typename T> inline T matxHostConj(const T &v)
+{
+  if constexpr (is_complex_v<T>) {
+    return T(v.real(), -v.imag());
+  }
+  else {
+    return v;
+  }
+}
+
+template <typename T> inline value_type_t<T> matxHostRealPart(const T &v)
+{
+  if constexpr (is_complex_v<T>) {
+    return v.real();
+  }
+  else {
+    return v;
+  }
+}
+
+/**
+ * C = alpha * op(A) * op(B) + beta * C on single-matrix views, where op
+ * optionally conjugates its operand
+ */
+template <typename T>
+inline void matxHostSolverGemm(const matxHostSolverMat_t<T> &c,
+                               const matxHostGemmOperand_t<T> &a,
+                               const matxHostGemmOperand_t<T> &b, index_t m,
+                               index_t n, index_t k, value_type_t<T> alpha,
+                               value_type_t<T> beta, const HostExecutor &exec)
+{
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return;
+  }
+
+  matxHostGemm<T>([&](index_t) { return c.Operand(); },
+                  [&](index_t) { return a; }, [&](index_t) { return b; }, m, n,
+                  k, 1, alpha, beta, exec);
+}
+
+/**
+ * Run func(b, exec) over every batch. Batches are spread across the threads
+ * when there are enough of them to keep every thread busy; otherwise they
+ * run in turn and each one uses all of the threads.
+ */
+template <typename Func>
+inline void matxHostSolverBatches(index_t batches, const HostExecutor &exec,
+                                  Func &&func)
+{
+  if (batches >= exec.GetNumThreads() && batches > 1) {
+    const HostExecutor single{SingleThreadHostExecutor{}};
+    exec.ParallelFor(batches, [&](index_t b) { func(b, single); });
+  }
+  else {
+    for (index_t b = 0; b < batches; b++) {
+      func(b, exec);
+    }
+  }
+}
+
+/***************************************** CHOLESKY
+ * *********************************************/
+
+/**
+ * Unblocked lower Cholesky of the leading n x n block of a. Returns false if
+ * the matrix is not positive definite.
+ */
+template <typename T>
+bool matxHostCholUnblocked(const matxHostSolverMat_t<T> &a, index_t n)
+{
+  using real_t = value_type_t<T>;
+  for (index_t j = 0; j < n; j++) {
+    real_t d = matxHostRealPart(a(j, j));
+    for (index_t p = 0; p < j; p++) {
+      const T l = a(j, p);
+      d -= matxHostRealPart(l * matxHostConj(l));
+    }
+    if (!(d > real_t(0))) {
+      return false;
+    }
+
+    d = std::sqrt(d);
+    a(j, j) = T(d);
+    for (index_t i = j + 1; i < n; i++) {
+      T s = a(i, j);
+      for (index_t p = 0; p < j; p++) {
+        s -= a(i, p) * matxHostConj(a(j, p));
+      }
+      a(i, j) = s / d;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Right-looking blocked lower Cholesky, A = L * L^H, in place
+ *
+ * Only the lower triangle is read and written. Each step factors a diagonal
+ * block, solves for the panel below it, and updates the trailing lower
+ * triangle: the diagonal blocks with scalar code and everything below them
+ * with the host GEMM. An upper factor is produced by calling this on the
+ * transposed view, since the lower factor of conj(A) stored transposed is
+ * the upper factor of A.
+ */
+template <typename T>
+bool matxHostCholBlocked(const matxHostSolverMat_t<T> &a, index_t n,
+                         const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr index_t NB = HOST_SOLVER_BLOCK;
+
+  for (index_t k0 = 0; k0 < n; k0 += NB) {
+    const index_t nb = std::min(NB, n - k0);
+    const auto l11 = a.Sub(k0, k0);
+    if (!matxHostCholUnblocked(l11, nb)) {
+      return false;
+    }
+
+    const index_t r = n - k0 - nb;
+    if (r == 0) {
+      break;
+    }
+
+    // L21 = A21 * L11^-H, one row per work item
+    const auto l21 = a.Sub(k0 + nb, k0);
+    exec.ParallelFor(r, [&](index_t i) {
+      for (index_t j = 0; j < nb; j++) {
+        T s = l21(i, j);
+        for (index_t p = 0; p < j; p++) {
+          s -= l21(i, p) * matxHostConj(l11(j, p));
+        }
+        l21(i, j) = s / matxHostRealPart(l11(j, j));
+      }
+    });
+
+    // A22 -= L21 * L21^H, lower triangle only
+    const auto a22 = a.Sub(k0 + nb, k0 + nb);
+    for (index_t jb = 0; jb < r; jb += NB) {
+      const index_t w = std::min(NB, r - jb);
+      for (index_t i = jb; i < jb + w; i++) {
+        for (index_t j = jb; j <= i; j++) {
+          T s = 0;
+          for (index_t p = 0; p < nb; p++) {
+            s += l21(i, p) * matxHostConj(l21(j, p));
+          }
+          a22(i, j) -= s;
+        }
+      }
+
+      matxHostSolverGemm(a22.Sub(jb + w, jb), l21.Sub(jb + w, 0).Operand(),
+                         l21.Sub(jb, 0).Trans().Operand(true), r - jb - w, w,
+                         nb, real_t(-1), real_t(1), exec);
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Lower Cholesky of W interleaved n x n matrices, a[(i * n + j) * W + w].
+ * Lanes that are not positive definite are flagged in ok and produce
+ * non-finite values.
+ */
+template <index_t W, typename T>
+void matxHostCholLanes(T *a, index_t n, bool (&ok)[W])
+{
+  using real_t = value_type_t<T>;
+  auto at = [&](index_t i, index_t j) { return a + (i * n + j) * W; };
+
+  for (index_t j = 0; j < n; j++) {
+    real_t d[W];
+    T *ajj = at(j, j);
+    for (index_t w = 0; w < W; w++) {
+      d[w] = matxHostRealPart(ajj[w]);
+    }
+    for (index_t p = 0; p < j; p++) {
+      const T *ajp = at(j, p);
+      for (index_t w = 0; w < W; w++) {
+        d[w] -= matxHostRealPart(ajp[w] * matxHostConj(ajp[w]));
+      }
+    }
+
+    real_t rinv[W];
+    for (index_t w = 0; w < W; w++) {
+      ok[w] = ok[w] && d[w] > real_t(0);
+      d[w] = std::sqrt(d[w]);
+      ajj[w] = T(d[w]);
+      rinv[w] = real_t(1) / d[w];
+    }
+
+    for (index_t i = j + 1; i < n; i++) {
+      T *aij = at(i, j);
+      for (index_t p = 0; p < j; p++) {
+        const T *aip = at(i, p);
+        const T *ajp = at(j, p);
+        for (index_t w = 0; w < W; w++) {
+          aij[w] -= aip[w] * matxHostConj(ajp[w]);
+        }
+      }
+      for (index_t w = 0; w < W; w++) {
+        aij[w] *= rinv[w];
+      }
+    }
+  }
+}
+
+/**
+ * Batched in-place lower Cholesky of small matrices using interleaved lanes.
+ * Only the lower triangle of each view is read and written. Returns false if
+ * any matrix is not positive definite.
+ */
+template <typename T, typename MatGet>
+bool matxHostCholSmallBatched(MatGet get, index_t batches, index_t n,
+                              const HostExecutor &exec)
+{
+  constexpr index_t W = SMALL_MATRIX_HOST_LANES;
+  const index_t groups = (batches + W - 1) / W;
+  std::atomic<bool> good{true};
+
+  exec.ParallelFor(groups, [&](index_t g) {
+    const index_t b0 = g * W;
+    const index_t lanes = std::min(W, batches - b0);
+    std::vector<T> buf(static_cast<size_t>(n * n * W));
+    for (index_t w = 0; w < W; w++) {
+      const auto m = get(b0 + std::min(w, lanes - 1));
+      for (index_t i = 0; i < n; i++) {
+        for (index_t j = 0; j <= i; j++) {
+          buf[(i * n + j) * W + w] = w < lanes ? m(i, j) : T(i == j ? 1 : 0);
+        }
+      }
+    }
+
+    bool ok[W];
+    std::fill(std::begin(ok), std::end(ok), true);
+    matxHostCholLanes<W>(buf.data(), n, ok);
+
+    for (index_t w = 0; w < lanes; w++) {
+      const auto m = get(b0 + w);
+      for (index_t i = 0; i < n; i++) {
+        for (index_t j = 0; j <= i; j++) {
+          m(i, j) = buf[(i * n + j) * W + w];
+        }
+      }
+      if (!ok[w]) {
+        good = false;
+      }
+    }
+  });
+
+  return good;
+}
+
+/**
+ * Factor every batch of a in place as A = L * L^H (lower) or A = U^H * U
+ * (upper). Only the selected triangle is referenced.
+ */
+template <typename T, int RANK>
+bool matxHostChol(const tensor_t<T, RANK> &a, bool upper,
+                  const HostExecutor &exec)
+{
+  const index_t batches = batch_count(a, 2);
+  const index_t n = a.Size(RANK - 1);
+  auto get = [&](index_t b) {
+    const auto m = matxHostSolverBatch(a, b);
+    return upper ? m.Trans() : m;
+  };
+
+  if (batches > 1 && n <= HOST_SOLVER_SMALL_DIM) {
+    return matxHostCholSmallBatched<T>(get, batches, n, exec);
+  }
+
+  std::atomic<bool> good{true};
+  matxHostSolverBatches(batches, exec, [&](index_t b, const HostExecutor &ex) {
+    if (!matxHostCholBlocked(get(b), n, ex)) {
+      good = false;
+    }
+  });
+
+  return good;
+}
+
+/***************************************** LU FACTORIZATION
+ * *********************************************/
+
+/**
+ * Swap rows r1 and r2 of a over columns [c0, c1)
+ */
+template <typename T>
+inline void matxHostSwapRows(const matxHostSolverMat_t<T> &a, index_t r1,
+                             index_t r2, index_t c0, index_t c1)
+{
+  for (index_t c = c0; c < c1; c++) {
+    std::swap(a(r1, c), a(r2, c));
+  }
+}
+
+/**
+ * Unblocked LU with partial pivoting of the m x nb panel starting at column
+ * k0 of a, where the panel's diagonal starts at row k0. Pivots are stored
+ * 1-based in piv[k0..k0+nb) as row indices of a, and row swaps are applied
+ * to the panel columns only. Returns false if an exact zero pivot was found.
+ */
+template <typename T>
+bool matxHostLUPanel(const matxHostSolverMat_t<T> &a, int64_t *piv,
+                     index_t m, index_t k0, index_t nb)
+{
+  bool good = true;
+  for (index_t j = k0; j < k0 + nb; j++) {
+    index_t p = j;
+    auto best = matxSmallMag(a(j, j));
+    for (index_t i = j + 1; i < m; i++) {
+      const auto v = matxSmallMag(a(i, j));
+      if (v > best) {
+        best = v;
+        p = i;
+      }
+    }
+
+    piv[j] = static_cast<int64_t>(p + 1);
+    if (best == decltype(best)(0)) {
+      good = false;
+      continue;
+    }
+
+    if (p != j) {
+      matxHostSwapRows(a, j, p, k0, k0 + nb);
+    }
+
+    const T rinv = T(1) / a(j, j);
+    for (index_t i = j + 1; i < m; i++) {
+      const T f = a(i, j) * rinv;
+      a(i, j) = f;
+      for (index_t c = j + 1; c < k0 + nb; c++) {
+        a(i, c) -= f * a(j, c);
+      }
+    }
+  }
+
+  return good;
+}
+
+/**
+ * Right-looking blocked LU with partial pivoting, P * A = L * U, in place
+ *
+ * Each step factors a panel of HOST_SOLVER_BLOCK columns, applies its row
+ * swaps to the rest of the matrix, solves for the block row of U, and
+ * updates the trailing matrix with the host GEMM. Output layout and pivots
+ * match LAPACK getrf.
+ */
+template <typename T>
+bool matxHostLUBlocked(const matxHostSolverMat_t<T> &a, int64_t *piv,
+                       index_t m, index_t n, const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr index_t NB = HOST_SOLVER_BLOCK;
+  const index_t mn = std::min(m, n);
+  bool good = true;
+
+  for (index_t k0 = 0; k0 < mn; k0 += NB) {
+    const index_t nb = std::min(NB, mn - k0);
+    good = matxHostLUPanel(a, piv, m, k0, nb) && good;
+
+    for (index_t j = k0; j < k0 + nb; j++) {
+      const index_t p = static_cast<index_t>(piv[j] - 1);
+      if (p != j) {
+        matxHostSwapRows(a, j, p, 0, k0);
+        matxHostSwapRows(a, j, p, k0 + nb, n);
+      }
+    }
+
+    const index_t r = n - k0 - nb;
+    if (r == 0) {
+      continue;
+    }
+
+    // U12 = L11^-1 * A12, in blocks of columns
+    const auto l11 = a.Sub(k0, k0);
+    const auto a12 = a.Sub(k0, k0 + nb);
+    const index_t col_blocks = (r + NB - 1) / NB;
+    exec.ParallelFor(col_blocks, [&](index_t cb) {
+      const index_t c1 = std::min(r, (cb + 1) * NB);
+      for (index_t i = 1; i < nb; i++) {
+        for (index_t p = 0; p < i; p++) {
+          const T l = l11(i, p);
+          for (index_t c = cb * NB; c < c1; c++) {
+            a12(i, c) -= l * a12(p, c);
+          }
+        }
+      }
+    });
+
+    // A22 -= L21 * U12
+    matxHostSolverGemm(a.Sub(k0 + nb, k0 + nb), a.Sub(k0 + nb, k0).Operand(),
+                       a12.Operand(), m - k0 - nb, r, nb, real_t(-1),
+                       real_t(1), exec);
+  }
+
+  return good;
+}
+
+/**
+ * LU with partial pivoting of W interleaved m x n matrices,
+ * a[(i * n + j) * W + w], with 1-based pivots in piv[k * W + w]. Lanes with
+ * an exact zero pivot are flagged in ok.
+ */
+template <index_t W, typename T>
+void matxHostLULanes(T *a, int64_t *piv, index_t m, index_t n, bool (&ok)[W])
+{
+  auto at = [&](index_t i, index_t j) { return a + (i * n + j) * W; };
+  const index_t mn = std::min(m, n);
+
+  for (index_t k = 0; k < mn; k++) {
+    T rinv[W];
+    for (index_t w = 0; w < W; w++) {
+      index_t p = k;
+      auto best = matxSmallMag(at(k, k)[w]);
+      for (index_t i = k + 1; i < m; i++) {
+        const auto v = matxSmallMag(at(i, k)[w]);
+        if (v > best) {
+          best = v;
+          p = i;
+        }
+      }
+
+      piv[k * W + w] = static_cast<int64_t>(p + 1);
+      if (p != k) {
+        for (index_t j = 0; j < n; j++) {
+          std::swap(at(k, j)[w], at(p, j)[w]);
+        }
+      }
+
+      // A zero pivot leaves its column unscaled, as in getrf
+      const bool zero = best == decltype(best)(0);
+      ok[w] = ok[w] && !zero;
+      rinv[w] = zero ? T(0) : T(1) / at(k, k)[w];
+    }
+
+    for (index_t i = k + 1; i < m; i++) {
+      T *aik = at(i, k);
+      for (index_t w = 0; w < W; w++) {
+        aik[w] *= rinv[w];
+      }
+      for (index_t j = k + 1; j < n; j++) {
+        T *aij = at(i, j);
+        const T *akj = at(k, j);
+        for (index_t w = 0; w < W; w++) {
+          aij[w] -= aik[w] * akj[w];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Batched in-place LU of small matrices using interleaved lanes. pivget(b)
+ * returns the pivot array of batch b.
+ */
+template <typename T, typename MatGet, typename PivGet>
+bool matxHostLUSmallBatched(MatGet get, PivGet pivget, index_t batches,
+                            index_t m, index_t n, const HostExecutor &exec)
+{
+  constexpr index_t W = SMALL_MATRIX_HOST_LANES;
+  const index_t groups = (batches + W - 1) / W;
+  const index_t mn = std::min(m, n);
+  std::atomic<bool> good{true};
+
+  exec.ParallelFor(groups, [&](index_t g) {
+    const index_t b0 = g * W;
+    const index_t lanes = std::min(W, batches - b0);
+    std::vector<T> buf(static_cast<size_t>(m * n * W));
+    std::vector<int64_t> pbuf(static_cast<size_t>(mn * W));
+    for (index_t w = 0; w < W; w++) {
+      const auto a = get(b0 + std::min(w, lanes - 1));
+      for (index_t i = 0; i < m; i++) {
+        for (index_t j = 0; j < n; j++) {
+          buf[(i * n + j) * W + w] = w < lanes ? a(i, j) : T(i == j ? 1 : 0);
+        }
+      }
+    }
+
+    bool ok[W];
+    std::fill(std::begin(ok), std::end(ok), true);
+    matxHostLULanes<W>(buf.data(), pbuf.data(), m, n, ok);
+
+    for (index_t w = 0; w < lanes; w++) {
+      const auto a = get(b0 + w);
+      int64_t *piv = pivget(b0 + w);
+      for (index_t i = 0; i < m; i++) {
+        for (index_t j = 0; j < n; j++) {
+          a(i, j) = buf[(i * n + j) * W + w];
+        }
+      }
+      for (index_t k = 0; k < mn; k++) {
+        piv[k] = pbuf[k * W + w];
+      }
+      if (!ok[w]) {
+        good = false;
+      }
+    }
+  });
+
+  return good;
+}
+
+/**
+ * Factor every batch of a in place as P * A = L * U, with min(m, n) 1-based
+ * pivots per batch in the last dimension of piv
+ */
+template <typename T, int RANK>
+bool matxHostLU(const tensor_t<T, RANK> &a, tensor_t<int64_t, RANK - 1> &piv,
+                const HostExecutor &exec)
+{
+  const index_t batches = batch_count(a, 2);
+  const index_t m = a.Size(RANK - 2);
+  const index_t n = a.Size(RANK - 1);
+  auto get = [&](index_t b) { return matxHostSolverBatch(a, b); };
+  auto pivget = [&](index_t b) { return &batch_at(piv, b, 0); };
+
+  if (batches > 1 && std::max(m, n) <= HOST_SOLVER_SMALL_DIM) {
+    return matxHostLUSmallBatched<T>(get, pivget, batches, m, n, exec);
+  }
+
+  std::atomic<bool> good{true};
+  matxHostSolverBatches(batches, exec, [&](index_t b, const HostExecutor &ex) {
+    if (!matxHostLUBlocked(get(b), pivget(b), m, n, ex)) {
+      good = false;
+    }
+  });
+
+  return good;
+}
+
+/***************************************** TRIANGULAR SOLVES
+ * *********************************************/
+
+/**
+ * Solve op(T) * X = B in place for the n x n triangular t and the n x nrhs
+ * b, as in BLAS trsm, where op conjugates t when conj is set. lower selects
+ * forward or backward substitution and unit an implicit unit diagonal; the
+ * other triangle of t is never read. Diagonal blocks of HOST_SOLVER_BLOCK
+ * rows are solved with row operations across blocks of right-hand sides and
+ * the remaining rows are updated with the host GEMM.
+ */
+template <typename T>
+void matxHostTrsm(const matxHostSolverMat_t<T> &t,
+                  const matxHostSolverMat_t<T> &b, index_t n, index_t nrhs,
+                  bool lower, bool unit, bool conj, const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr index_t NB = HOST_SOLVER_BLOCK;
+  if (n <= 0 || nrhs <= 0) {
+    return;
+  }
+
+  const auto tv = [&](index_t i, index_t j) {
+    return conj ? matxHostConj(t(i, j)) : t(i, j);
+  };
+
+  // Substitution on rows k0 to k0 + nb, in blocks of columns
+  const index_t col_blocks = (nrhs + NB - 1) / NB;
+  const auto diag = [&](index_t k0, index_t nb) {
+    const auto solve = [&](index_t cb) {
+      const index_t c0 = cb * NB;
+      const index_t c1 = std::min(nrhs, c0 + NB);
+      for (index_t ii = 0; ii < nb; ii++) {
+        const index_t i = lower ? k0 + ii : k0 + nb - 1 - ii;
+        const index_t p0 = lower ? k0 : i + 1;
+        const index_t p1 = lower ? i : k0 + nb;
+        for (index_t p = p0; p < p1; p++) {
+          const T l = tv(i, p);
+          for (index_t c = c0; c < c1; c++) {
+            b(i, c) -= l * b(p, c);
+          }
+        }
+        if (!unit) {
+          const T r = T(1) / tv(i, i);
+          for (index_t c = c0; c < c1; c++) {
+            b(i, c) *= r;
+          }
+        }
+      }
+    };
+
+    if (col_blocks > 1) {
+      exec.ParallelFor(col_blocks, solve);
+    }
+    else {
+      solve(0);
+    }
+  };
+
+  if (lower) {
+    for (index_t k0 = 0; k0 < n; k0 += NB) {
+      const index_t nb = std::min(NB, n - k0);
+      diag(k0, nb);
+      matxHostSolverGemm(b.Sub(k0 + nb, 0), t.Sub(k0 + nb, k0).Operand(conj),
+                         b.Sub(k0, 0).Operand(), n - k0 - nb, nrhs, nb,
+                         real_t(-1), real_t(1), exec);
+    }
+  }
+  else {
+    for (index_t k0 = ((n - 1) / NB) * NB; k0 >= 0; k0 -= NB) {
+      const index_t nb = std::min(NB, n - k0);
+      diag(k0, nb);
+      matxHostSolverGemm(b, t.Sub(0, k0).Operand(conj), b.Sub(k0, 0).Operand(),
+                         k0, nrhs, nb, real_t(-1), real_t(1), exec);
+    }
+  }
+}
+
+/**
+ * Solve A * X = B in place on x, which holds B on entry, from the getrf-style
+ * factors and 1-based pivots of A
+ */
+template <typename T>
+void matxHostLUSolve(const matxHostSolverMat_t<T> &lu, const int64_t *piv,
+                     const matxHostSolverMat_t<T> &x, index_t n, index_t nrhs,
+                     const HostExecutor &exec)
+{
+  for (index_t j = 0; j < n; j++) {
+    const index_t p = static_cast<index_t>(piv[j] - 1);
+    if (p != j) {
+      matxHostSwapRows(x, j, p, 0, nrhs);
+    }
+  }
+  matxHostTrsm(lu, x, n, nrhs, true, true, false, exec);
+  matxHostTrsm(lu, x, n, nrhs, false, false, false, exec);
+}
+
+/**
+ * Solve A * X = B in place on x, which holds B on entry, from the Cholesky
+ * factor of A: A = U^H * U when upper is set and A = L * L^H otherwise. Only
+ * that triangle of the factor is read.
+ */
+template <typename T>
+void matxHostCholSolve(const matxHostSolverMat_t<T> &f, bool upper,
+                       const matxHostSolverMat_t<T> &x, index_t n,
+                       index_t nrhs, const HostExecutor &exec)
+{
+  matxHostTrsm(upper ? f.Trans() : f, x, n, nrhs, true, false, upper, exec);
+  matxHostTrsm(upper ? f : f.Trans(), x, n, nrhs, false, false, !upper, exec);
+}
+
+/***************************************** QR FACTORIZATION
+ * *********************************************/
+
+/**
+ * Generate an elementary reflector H = I - tau * v * v^H with v(0) = 1 such
+ * that H^H * [alpha; x] = [beta; 0] with beta real, as in LAPACK larfg. x
+ * (column 0 of the view, len rows) is overwritten with v(1:) and alpha with
+ * beta.
+ */
+template <typename T>
+T matxHostReflector(T &alpha, const matxHostSolverMat_t<T> &x, index_t len)
+{
+  using real_t = value_type_t<T>;
+  real_t xnorm2 = 0;
+  for (index_t i = 0; i < len; i++) {
+    xnorm2 += matxHostRealPart(x(i, 0) * matxHostConj(x(i, 0)));
+  }
+
+  const real_t ar = matxHostRealPart(alpha);
+  real_t ai = 0;
+  if constexpr (is_complex_v<T>) {
+    ai = alpha.imag();
+  }
+  if (xnorm2 == real_t(0) && ai == real_t(0)) {
+    return T(0);
+  }
+
+  real_t beta = std::sqrt(ar * ar + ai * ai + xnorm2);
+  if (ar >= real_t(0)) {
+    beta = -beta;
+  }
+
+  T tau;
+  if constexpr (is_complex_v<T>) {
+    tau = T((beta - ar) / beta, -ai / beta);
+  }
+  else {
+    tau = (beta - ar) / beta;
+  }
+
+  const T scale = T(1) / (alpha - T(beta));
+  for (index_t i = 0; i < len; i++) {
+    x(i, 0) *= scale;
+  }
+  alpha = T(beta);
+
+  return tau;
+}
+
+/**
+ * Unblocked Householder QR of the panel of columns [k0, k0 + nb) of an
+ * m-row matrix, applying each reflector to the rest of the panel only
+ */
+template <typename T>
+void matxHostQRPanel(const matxHostSolverMat_t<T> &a, T *tau, index_t m,
+                     index_t k0, index_t nb, std::vector<T> &w)
+{
+  const index_t k1 = k0 + nb;
+  w.resize(static_cast<size_t>(nb));
+  for (index_t j = k0; j < k1 && j < m; j++) {
+    tau[j] = matxHostReflector(a(j, j), a.Sub(j + 1, j), m - j - 1);
+
+    // Apply H^H = I - conj(tau) * v * v^H to the panel columns to the right
+    const index_t cols = k1 - j - 1;
+    if (cols == 0 || tau[j] == T(0)) {
+      continue;
+    }
+
+    const auto c = a.Sub(j, j + 1);
+    for (index_t q = 0; q < cols; q++) {
+      w[q] = c(0, q);
+    }
+    for (index_t i = 1; i < m - j; i++) {
+      const T vi = matxHostConj(a(j + i, j));
+      for (index_t q = 0; q < cols; q++) {
+        w[q] += vi * c(i, q);
+      }
+    }
+
+    const T ct = matxHostConj(tau[j]);
+    for (index_t q = 0; q < cols; q++) {
+      c(0, q) -= ct * w[q];
+    }
+    for (index_t i = 1; i < m - j; i++) {
+      const T f = ct * a(j + i, j);
+      for (index_t q = 0; q < cols; q++) {
+        c(i, q) -= f * w[q];
+      }
+    }
+  }
+}
+
+/**
+ * Build the compact-WY form I - V * T * V^H of the nb reflectors stored from
+ * column k0 of a, as in LAPACK larft. v receives the explicit (m - k0) x nb
+ * reflectors with their unit diagonal and t the upper triangular nb x nb
+ * factor.
+ */
+template <typename T>
+void matxHostQRBlockWY(const matxHostSolverMat_t<T> &a, const T *tau,
+                       index_t m, index_t k0, index_t nb, std::vector<T> &vbuf,
+                       std::vector<T> &gbuf, std::vector<T> &tbuf,
+                       const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  const index_t mk = m - k0;
+  vbuf.assign(static_cast<size_t>(mk * nb), T(0));
+  const matxHostSolverMat_t<T> v{vbuf.data(), nb, 1};
+  for (index_t i = 0; i < mk; i++) {
+    for (index_t j = 0; j < std::min(i + 1, nb); j++) {
+      v(i, j) = i == j ? T(1) : a(k0 + i, k0 + j);
+    }
+  }
+
+  // T from the Gram matrix G = V^H * V
+  gbuf.resize(static_cast<size_t>(nb * nb));
+  const matxHostSolverMat_t<T> g{gbuf.data(), nb, 1};
+  matxHostSolverGemm(g, v.Trans().Operand(true), v.Operand(), nb, nb, mk,
+                     real_t(1), real_t(0), exec);
+
+  tbuf.assign(static_cast<size_t>(nb * nb), T(0));
+  const matxHostSolverMat_t<T> t{tbuf.data(), nb, 1};
+  for (index_t i = 0; i < nb; i++) {
+    const T ti = tau[k0 + i];
+    t(i, i) = ti;
+    for (index_t p = 0; p < i; p++) {
+      T s = 0;
+      for (index_t q = p; q < i; q++) {
+        s += t(p, q) * g(q, i);
+      }
+      t(p, i) = -ti * s;
+    }
+  }
+}
+
+/**
+ * Blocked Householder QR, A = Q * R, in place
+ *
+ * Output layout and tau match LAPACK geqrf: R is in the upper triangle and
+ * the reflectors below the diagonal. Each panel of HOST_SOLVER_BLOCK columns
+ * is factored with unblocked code, and its reflectors are combined in
+ * compact-WY form, H1 ... Hnb = I - V * T * V^H. Applying that to the trailing
+ * matrix, C -= V * (T^H * (V^H * C)), is then three host GEMMs.
+ */
+template <typename T>
+void matxHostQRBlocked(const matxHostSolverMat_t<T> &a, T *tau, index_t m,
+                       index_t n, const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr index_t NB = HOST_SOLVER_BLOCK;
+  const index_t mn = std::min(m, n);
+  std::vector<T> w;
+  std::vector<T> vbuf;
+  std::vector<T> tbuf;
+  std::vector<T> gbuf;
+  std::vector<T> wbuf;
+  std::vector<T> w2buf;
+
+  for (index_t k0 = 0; k0 < mn; k0 += NB) {
+    const index_t nb = std::min(NB, mn - k0);
+    matxHostQRPanel(a, tau, m, k0, nb, w);
+
+    const index_t r = n - k0 - nb;
+    if (r == 0) {
+      continue;
+    }
+
+    const index_t mk = m - k0;
+    matxHostQRBlockWY(a, tau, m, k0, nb, vbuf, gbuf, tbuf, exec);
+    const matxHostSolverMat_t<T> v{vbuf.data(), nb, 1};
+    const matxHostSolverMat_t<T> t{tbuf.data(), nb, 1};
+
+    // C -= V * (T^H * (V^H * C))
+    const auto c = a.Sub(k0, k0 + nb);
+    wbuf.resize(static_cast<size_t>(nb * r));
+    w2buf.resize(static_cast<size_t>(nb * r));
+    const matxHostSolverMat_t<T> w1{wbuf.data(), r, 1};
+    const matxHostSolverMat_t<T> w2{w2buf.data(), r, 1};
+    matxHostSolverGemm(w1, v.Trans().Operand(true), c.Operand(), nb, r, mk,
+                       real_t(1), real_t(0), exec);
+    matxHostSolverGemm(w2, t.Trans().Operand(true), w1.Operand(), nb, r, nb,
+                       real_t(1), real_t(0), exec);
+    matxHostSolverGemm(c, v.Operand(), w2.Operand(), mk, r, nb, real_t(-1),
+                       real_t(1), exec);
+  }
+}
+
+/**
+ * c = Q * c for the first k reflectors stored in a by matxHostQRBlocked. The
+ * blocks are applied last to first, each in its compact-WY form.
+ */
+template <typename T>
+void matxHostQRApplyQ(const matxHostSolverMat_t<T> &a, const T *tau,
+                      index_t m, index_t k, const matxHostSolverMat_t<T> &c,
+                      index_t n, const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr index_t NB = HOST_SOLVER_BLOCK;
+  std::vector<T> vbuf;
+  std::vector<T> tbuf;
+  std::vector<T> gbuf;
+  std::vector<T> wbuf;
+  std::vector<T> w2buf;
+
+  for (index_t k0 = ((k - 1) / NB) * NB; k0 >= 0; k0 -= NB) {
+    const index_t nb = std::min(NB, k - k0);
+    const index_t mk = m - k0;
+    matxHostQRBlockWY(a, tau, m, k0, nb, vbuf, gbuf, tbuf, exec);
+    const matxHostSolverMat_t<T> v{vbuf.data(), nb, 1};
+    const matxHostSolverMat_t<T> t{tbuf.data(), nb, 1};
+
+    // C -= V * (T * (V^H * C))
+    const auto cs = c.Sub(k0, 0);
+    wbuf.resize(static_cast<size_t>(nb * n));
+    w2buf.resize(static_cast<size_t>(nb * n));
+    const matxHostSolverMat_t<T> w1{wbuf.data(), n, 1};
+    const matxHostSolverMat_t<T> w2{w2buf.data(), n, 1};
+    matxHostSolverGemm(w1, v.Trans().Operand(true), cs.Operand(), nb, n, mk,
+                       real_t(1), real_t(0), exec);
+    matxHostSolverGemm(w2, t.Operand(), w1.Operand(), nb, n, nb, real_t(1),
+                       real_t(0), exec);
+    matxHostSolverGemm(cs, v.Operand(), w2.Operand(), mk, n, nb, real_t(-1),
+                       real_t(1), exec);
+  }
+}
+
+/**
+ * QR factor every batch of a in place, with min(m, n) reflector scales per
+ * batch in the last dimension of tau
+ */
+template <typename T, int RANK>
+void matxHostQR(const tensor_t<T, RANK> &a, tensor_t<T, RANK - 1> &tau,
+                const HostExecutor &exec)
+{
+  const index_t batches = batch_count(a, 2);
+  const index_t m = a.Size(RANK - 2);
+  const index_t n = a.Size(RANK - 1);
+
+  matxHostSolverBatches(batches, exec, [&](index_t b, const HostExecutor &ex) {
+    matxHostQRBlocked(matxHostSolverBatch(a, b), &batch_at(tau, b, 0), m, n,
+                      ex);
+  });
+}
+
+/********************************************** SVD
+ * *********************************************/
+
+/**
+ * Apply one Jacobi rotation to rows gp and gq of length l so they become
+ * orthogonal, and the same rotation to the rows vp and vq of length k when
+ * vp is not null. Returns false if the rows were already orthogonal to
+ * within tol, or if either squared norm is at most negl. Such rows are
+ * rounding noise of a rank-deficient input and can't be made orthogonal to
+ * relative precision, so rotating them would never converge.
+ *
+ * With gamma = gp^H * gq = |gamma| * e, gq is first scaled by conj(e) so the
+ * pair has a real inner product, and a real rotation then zeroes it. The
+ * combined 2 x 2 transform is unitary.
+ */
+template <typename T>
+bool matxHostJacobiRotate(T *gp, T *gq, index_t l, T *vp, T *vq, index_t k,
+                          value_type_t<T> tol, value_type_t<T> negl)
+{
+  using real_t = value_type_t<T>;
+  real_t alpha = 0;
+  real_t beta = 0;
+  T gamma = 0;
+  for (index_t i = 0; i < l; i++) {
+    alpha += matxHostRealPart(gp[i] * matxHostConj(gp[i]));
+    beta += matxHostRealPart(gq[i] * matxHostConj(gq[i]));
+    gamma += matxHostConj(gp[i]) * gq[i];
+  }
+
+  if (alpha <= negl || beta <= negl) {
+    return false;
+  }
+
+  const real_t gabs = std::sqrt(matxHostRealPart(gamma * matxHostConj(gamma)));
+  // The norms are taken separately so that tiny columns don't underflow
+  if (gabs == real_t(0) || gabs <= tol * std::sqrt(alpha) * std::sqrt(beta)) {
+    return false;
+  }
+
+  const real_t zeta = (beta - alpha) / (real_t(2) * gabs);
+  const real_t t = std::copysign(real_t(1), zeta) /
+                   (std::abs(zeta) + std::sqrt(real_t(1) + zeta * zeta));
+  const real_t c = real_t(1) / std::sqrt(real_t(1) + t * t);
+  const real_t sn = c * t;
+  const T ce = matxHostConj(gamma / gabs);
+
+  auto rotate = [&](T *x, T *y, index_t len) {
+    for (index_t i = 0; i < len; i++) {
+      const T xp = x[i];
+      const T yq = y[i] * ce;
+      x[i] = c * xp - sn * yq;
+      y[i] = sn * xp + c * yq;
+    }
+  };
+
+  rotate(gp, gq, l);
+  if (vp != nullptr) {
+    rotate(vp, vq, k);
+  }
+
+  return true;
+}
+
+/**
+ * One-sided Jacobi on the k rows of g, each of length l
+ *
+ * The rows are the columns of X (l x k), and sweeps of rotations make them
+ * mutually orthogonal, so X * V = U * S with the rotations accumulated into
+ * the rows of vr (k x k, the columns of V) when vr is not null. Pairs are
+ * visited in round-robin order: each step is a set of disjoint pairs, so
+ * large problems apply the pairs of a step in parallel. Returns false if a
+ * full sweep still rotated after MAX_SWEEPS sweeps.
+ */
+template <typename T>
+bool matxHostJacobiSweeps(T *g, index_t k, index_t l, T *vr,
+                          const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr int MAX_SWEEPS = 30;
+  constexpr index_t PARALLEL_WORK = 1 << 16;
+  const real_t tol =
+      static_cast<real_t>(l) * std::numeric_limits<real_t>::epsilon();
+  const index_t nn = k + (k & 1);
+  const bool parallel =
+      exec.GetNumThreads() > 1 && (nn / 2) * (l + k) >= PARALLEL_WORK;
+  std::vector<index_t> order(static_cast<size_t>(nn));
+  std::iota(order.begin(), order.end(), 0);
+
+  if (k < 2) {
+    return true;
+  }
+
+  // Rotations preserve the Frobenius norm, so rows below eps times it stay
+  // negligible for the whole decomposition
+  real_t fro2 = 0;
+  for (index_t i = 0; i < k * l; i++) {
+    fro2 += matxHostRealPart(g[i] * matxHostConj(g[i]));
+  }
+  const real_t negl = fro2 * std::numeric_limits<real_t>::epsilon() *
+                      std::numeric_limits<real_t>::epsilon();
+
+  for (int sweep = 0; sweep < MAX_SWEEPS; sweep++) {
+    std::atomic<bool> rotated{false};
+    for (index_t step = 0; step < nn - 1; step++) {
+      auto pair = [&](index_t t) {
+        const index_t p = order[t];
+        const index_t q = order[nn - 1 - t];
+        if (p >= k || q >= k) {
+          return;
+        }
+        if (matxHostJacobiRotate(g + p * l, g + q * l, l,
+                                 vr ? vr + p * k : nullptr,
+                                 vr ? vr + q * k : nullptr, k, tol, negl)) {
+          rotated.store(true, std::memory_order_relaxed);
+        }
+      };
+
+      if (parallel) {
+        exec.ParallelFor(nn / 2, pair);
+      }
+      else {
+        for (index_t t = 0; t < nn / 2; t++) {
+          pair(t);
+        }
+      }
+
+      std::rotate(order.begin() + 1, order.end() - 1, order.end());
+    }
+
+    if (!rotated) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Fill the rows of q (rows x l) that are not flagged in valid so that all
+ * rows are orthonormal. Each missing row starts from the unit vector with
+ * the smallest projection onto the rows already present, which leaves a
+ * residual of at least 1 - filled / l, and is orthogonalized against them.
+ */
+template <typename T>
+void matxHostCompleteBasis(T *q, index_t rows, index_t l,
+                           std::vector<char> &valid)
+{
+  using real_t = value_type_t<T>;
+  std::vector<real_t> proj(static_cast<size_t>(l), real_t(0));
+  auto accumulate = [&](const T *y) {
+    for (index_t i = 0; i < l; i++) {
+      proj[i] += matxHostRealPart(y[i] * matxHostConj(y[i]));
+    }
+  };
+  for (index_t j = 0; j < rows; j++) {
+    if (valid[j]) {
+      accumulate(q + j * l);
+    }
+  }
+
+  for (index_t r = 0; r < rows; r++) {
+    if (valid[r]) {
+      continue;
+    }
+
+    T *x = q + r * l;
+    const index_t t = static_cast<index_t>(
+        std::min_element(proj.begin(), proj.end()) - proj.begin());
+    std::fill(x, x + l, T(0));
+    x[t] = T(1);
+
+    // Two passes of Gram-Schmidt against the accepted rows
+    for (int pass = 0; pass < 2; pass++) {
+      for (index_t j = 0; j < rows; j++) {
+        if (!valid[j]) {
+          continue;
+        }
+        const T *y = q + j * l;
+        T d = 0;
+        for (index_t i = 0; i < l; i++) {
+          d += matxHostConj(y[i]) * x[i];
+        }
+        for (index_t i = 0; i < l; i++) {
+          x[i] -= d * y[i];
+        }
+      }
+    }
+
+    real_t nrm = 0;
+    for (index_t i = 0; i < l; i++) {
+      nrm += matxHostRealPart(x[i] * matxHostConj(x[i]));
+    }
+    nrm = std::sqrt(nrm);
+    for (index_t i = 0; i < l; i++) {
+      x[i] /= nrm;
+    }
+    valid[r] = 1;
+    accumulate(x);
+  }
+}
+
+/**
+ * Singular value decomposition of one m x n matrix, A = U * S * V^H
+ *
+ * Works on X = A (m >= n) or X = A^H (m < n), which is l x k with l >= k.
+ * The columns of X are ordered by decreasing norm and reduced with the
+ * blocked Householder QR, X * P = Q * R, and one-sided Jacobi then runs on
+ * R^H, stored with its columns as contiguous rows. This is the QR
+ * preconditioned Jacobi of Drmac and Veselic: R^H is much closer to having
+ * orthogonal columns than X, so square and tall inputs alike converge in a
+ * few sweeps. With R^H * W = Z * S, X = (Q * W) * S * (P * Z)^H, so the
+ * rotations give the left vectors of X after applying Q and the normalized
+ * columns give the right ones. Singular values are sorted in descending
+ * order, and vectors for zero singular values or for a full ('A') basis are
+ * completed to an orthonormal set.
+ *
+ * U and V^H are written through u(i, j) and vt(i, j); jobs follow gesvd with
+ * 'A', 'S' or 'N'. Returns false if the Jacobi sweeps did not converge.
+ */
+template <typename T>
+bool matxHostSVDOne(const matxHostSolverMat_t<T> &a, value_type_t<T> *s,
+                    index_t s_stride, const matxHostSolverMat_t<T> &u,
+                    const matxHostSolverMat_t<T> &vt, index_t m, index_t n,
+                    char jobu, char jobvt, const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  const bool trans = m < n;
+  const index_t l = trans ? n : m;
+  const index_t k = trans ? m : n;
+  if (k == 0) {
+    return true;
+  }
+
+  // The rotations give the left vectors of X and the Jacobi output the right
+  const char xjob = trans ? jobvt : jobu;
+  const char rjob = trans ? jobu : jobvt;
+  const index_t xrows = xjob == 'A' ? l : (xjob == 'S' ? k : 0);
+
+  auto xat = [&](index_t i, index_t j) {
+    return trans ? matxHostConj(a(j, i)) : a(i, j);
+  };
+
+  // Column order by decreasing norm, a cheap stand-in for QR pivoting
+  std::vector<real_t> cn(static_cast<size_t>(k), real_t(0));
+  for (index_t j = 0; j < k; j++) {
+    for (index_t i = 0; i < l; i++) {
+      const T v = xat(i, j);
+      cn[j] += matxHostRealPart(v * matxHostConj(v));
+    }
+  }
+  std::vector<index_t> cp(static_cast<size_t>(k));
+  std::iota(cp.begin(), cp.end(), 0);
+  std::stable_sort(cp.begin(), cp.end(),
+                   [&](index_t x, index_t y) { return cn[x] > cn[y]; });
+
+  std::vector<T> g(static_cast<size_t>(k * l));
+  for (index_t j = 0; j < k; j++) {
+    for (index_t i = 0; i < l; i++) {
+      g[j * l + i] = xat(i, cp[j]);
+    }
+  }
+
+  std::vector<T> tau(static_cast<size_t>(k));
+  matxHostQRBlocked(matxHostSolverMat_t<T>{g.data(), 1, l}, tau.data(), l, k,
+                    exec);
+
+  // Columns of R^H are the conjugated rows of R
+  std::vector<T> y(static_cast<size_t>(k * k), T(0));
+  for (index_t i = 0; i < k; i++) {
+    for (index_t j = i; j < k; j++) {
+      y[i * k + j] = matxHostConj(g[j * l + i]);
+    }
+  }
+
+  std::vector<T> w;
+  if (xrows > 0) {
+    w.assign(static_cast<size_t>(k * k), T(0));
+    for (index_t j = 0; j < k; j++) {
+      w[j * k + j] = T(1);
+    }
+  }
+
+  const bool converged =
+      matxHostJacobiSweeps(y.data(), k, k, w.empty() ? nullptr : w.data(),
+                           exec);
+
+  // Singular values are the column norms, sorted in descending order
+  std::vector<real_t> sv(static_cast<size_t>(k));
+  for (index_t j = 0; j < k; j++) {
+    real_t nrm = 0;
+    for (index_t i = 0; i < k; i++) {
+      nrm += matxHostRealPart(y[j * k + i] * matxHostConj(y[j * k + i]));
+    }
+    sv[j] = std::sqrt(nrm);
+  }
+
+  std::vector<index_t> perm(static_cast<size_t>(k));
+  std::iota(perm.begin(), perm.end(), 0);
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&](index_t x, index_t y) { return sv[x] > sv[y]; });
+  for (index_t j = 0; j < k; j++) {
+    s[j * s_stride] = sv[perm[j]];
+  }
+
+  if (rjob != 'N') {
+    // Right vectors of X are the normalized columns, with negligible
+    // singular values left for the basis completion
+    const real_t small =
+        sv[perm[0]] * static_cast<real_t>(k) *
+        std::numeric_limits<real_t>::epsilon();
+    std::vector<T> z(static_cast<size_t>(k * k), T(0));
+    std::vector<char> valid(static_cast<size_t>(k), 0);
+    for (index_t j = 0; j < k; j++) {
+      const real_t sj = sv[perm[j]];
+      if (!(sj > small)) {
+        continue;
+      }
+      const T *src = y.data() + perm[j] * k;
+      for (index_t i = 0; i < k; i++) {
+        z[j * k + i] = src[i] / sj;
+      }
+      valid[j] = 1;
+    }
+    matxHostCompleteBasis(z.data(), k, k, valid);
+
+    // Undo the column ordering
+    for (index_t j = 0; j < k; j++) {
+      for (index_t i = 0; i < k; i++) {
+        if (trans) {
+          u(cp[i], j) = z[j * k + i];
+        }
+        else {
+          vt(j, cp[i]) = matxHostConj(z[j * k + i]);
+        }
+      }
+    }
+  }
+
+  if (xrows == 0) {
+    return converged;
+  }
+
+  // Left vectors of X are Q * [W; 0], orthonormal even for zero singular
+  // values, so only the columns past k of a full basis need completing
+  std::vector<T> q(static_cast<size_t>(xrows * l), T(0));
+  std::vector<char> valid(static_cast<size_t>(xrows), 0);
+  for (index_t j = 0; j < k; j++) {
+    const T *src = w.data() + perm[j] * k;
+    for (index_t i = 0; i < k; i++) {
+      q[j * l + i] = src[i];
+    }
+    valid[j] = 1;
+  }
+
+  // Apply Q to each [W; 0], held as the columns of a transposed view
+  matxHostQRApplyQ(matxHostSolverMat_t<T>{g.data(), 1, l}, tau.data(), l, k,
+                   matxHostSolverMat_t<T>{q.data(), 1, l}, k, exec);
+
+  matxHostCompleteBasis(q.data(), xrows, l, valid);
+  for (index_t j = 0; j < xrows; j++) {
+    for (index_t i = 0; i < l; i++) {
+      if (trans) {
+        vt(j, i) = matxHostConj(q[j * l + i]);
+      }
+      else {
+        u(i, j) = q[j * l + i];
+      }
+    }
+  }
+
+  return converged;
+}
+
+/***************************************** EIGEN DECOMPOSITION
+ * *************************************/
+
+/**
+ * Reduce the full Hermitian matrix a to a real symmetric tridiagonal with
+ * diagonal d and off-diagonal e, as in LAPACK sytrd/hetrd. Each panel of
+ * HOST_SOLVER_BLOCK columns accumulates V and W so that the trailing matrix
+ * is updated once with two GEMMs, A -= V * W^H + W * V^H, while the per
+ * column Hermitian matrix-vector products run across the executor. The
+ * reflectors are left below the first subdiagonal with the QR layout of the
+ * (n - 1) x (n - 1) block starting at (1, 0).
+ */
+template <typename T>
+void matxHostTridiag(const matxHostSolverMat_t<T> &a, index_t n,
+                     value_type_t<T> *d, value_type_t<T> *e, T *tau,
+                     const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr index_t NB = HOST_SOLVER_BLOCK;
+  std::vector<T> vbuf;
+  std::vector<T> wbuf;
+  std::vector<T> x(static_cast<size_t>(n));
+  std::vector<T> y1(static_cast<size_t>(NB));
+  std::vector<T> y2(static_cast<size_t>(NB));
+
+  for (index_t k0 = 0; k0 < n - 1; k0 += NB) {
+    const index_t nb = std::min(NB, n - 1 - k0);
+    vbuf.assign(static_cast<size_t>(n * nb), T(0));
+    wbuf.assign(static_cast<size_t>(n * nb), T(0));
+    const matxHostSolverMat_t<T> v{vbuf.data(), nb, 1};
+    const matxHostSolverMat_t<T> w{wbuf.data(), nb, 1};
+
+    for (index_t j = 0; j < nb; j++) {
+      const index_t i = k0 + j;
+
+      // Bring column i up to date with the earlier columns of the panel
+      for (index_t r = i; r < n; r++) {
+        T acc = 0;
+        for (index_t p = 0; p < j; p++) {
+          acc += v(r, p) * matxHostConj(w(i, p)) +
+                 w(r, p) * matxHostConj(v(i, p));
+        }
+        a(r, i) -= acc;
+      }
+
+      d[i] = matxHostRealPart(a(i, i));
+      tau[i] = matxHostReflector(a(i + 1, i), a.Sub(i + 2, i), n - i - 2);
+      e[i] = matxHostRealPart(a(i + 1, i));
+
+      v(i + 1, j) = T(1);
+      for (index_t r = i + 2; r < n; r++) {
+        v(r, j) = a(r, i);
+      }
+
+      // x = A22 * v - V * (W^H * v) - W * (V^H * v), with A22 as of the start
+      // of the panel
+      for (index_t p = 0; p < j; p++) {
+        T s1 = 0;
+        T s2 = 0;
+        for (index_t r = i + 1; r < n; r++) {
+          s1 += matxHostConj(w(r, p)) * v(r, j);
+          s2 += matxHostConj(v(r, p)) * v(r, j);
+        }
+        y1[p] = s1;
+        y2[p] = s2;
+      }
+
+      // A22 is stored in full, so A22 * v is accumulated as a sum of its
+      // conjugated rows, which vectorizes without reassociating
+      const index_t len = n - i - 1;
+      const auto rows = [&](index_t r0, index_t r1) {
+        for (index_t r = r0; r < r1; r++) {
+          T acc = 0;
+          for (index_t p = 0; p < j; p++) {
+            acc -= v(r, p) * y1[p] + w(r, p) * y2[p];
+          }
+          x[r] = acc;
+        }
+        for (index_t c = i + 1; c < n; c++) {
+          const T vc = v(c, j);
+          const T *ac = &a(c, 0);
+          if (a.cs == 1) {
+            for (index_t r = r0; r < r1; r++) {
+              x[r] += matxHostConj(ac[r]) * vc;
+            }
+          }
+          else {
+            for (index_t r = r0; r < r1; r++) {
+              x[r] += matxHostConj(ac[r * a.cs]) * vc;
+            }
+          }
+        }
+        for (index_t r = r0; r < r1; r++) {
+          x[r] *= tau[i];
+        }
+      };
+      if (len >= HOST_SOLVER_BLOCK * 4 && exec.GetNumThreads() > 1) {
+        const index_t chunks = std::min(
+            static_cast<index_t>(exec.GetNumThreads()), len / HOST_SOLVER_BLOCK);
+        exec.ParallelFor(chunks, [&](index_t c) {
+          rows(i + 1 + c * len / chunks, i + 1 + (c + 1) * len / chunks);
+        });
+      }
+      else {
+        rows(i + 1, n);
+      }
+
+      T xv = 0;
+      for (index_t r = i + 1; r < n; r++) {
+        xv += matxHostConj(x[r]) * v(r, j);
+      }
+      const T alpha = real_t(-0.5) * tau[i] * xv;
+      for (index_t r = i + 1; r < n; r++) {
+        w(r, j) = x[r] + alpha * v(r, j);
+      }
+    }
+
+    const index_t t0 = k0 + nb;
+    const index_t r = n - t0;
+    if (r > 0) {
+      const auto c = a.Sub(t0, t0);
+      const auto vt = v.Sub(t0, 0);
+      const auto wt = w.Sub(t0, 0);
+      matxHostSolverGemm(c, vt.Operand(), wt.Trans().Operand(true), r, r, nb,
+                         real_t(-1), real_t(1), exec);
+      matxHostSolverGemm(c, wt.Operand(), vt.Trans().Operand(true), r, r, nb,
+                         real_t(-1), real_t(1), exec);
+    }
+  }
+
+  d[n - 1] = matxHostRealPart(a(n - 1, n - 1));
+  e[n - 1] = 0;
+}
+
+/**
+ * Implicit QL with Wilkinson shifts on the symmetric tridiagonal (d, e), where
+ * e[i] couples i and i + 1. Rotations are accumulated into the columns of
+ * the n x n row-major z when it is given. Returns false if an eigenvalue does
+ * not converge.
+ */
+template <typename R>
+bool matxHostTridiagQL(R *d, R *e, index_t n, R *z)
+{
+  const R eps = std::numeric_limits<R>::epsilon();
+  for (index_t l = 0; l < n; l++) {
+    int iter = 0;
+    index_t m;
+    do {
+      for (m = l; m < n - 1; m++) {
+        const R dd = std::abs(d[m]) + std::abs(d[m + 1]);
+        if (std::abs(e[m]) <= eps * dd) {
+          break;
+        }
+      }
+      if (m == l) {
+        break;
+      }
+      if (iter++ == 60) {
+        return false;
+      }
+
+      R g = (d[l + 1] - d[l]) / (R(2) * e[l]);
+      R r = std::hypot(g, R(1));
+      g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+      R s = 1;
+      R c = 1;
+      R p = 0;
+      bool underflow = false;
+      for (index_t i = m - 1; i >= l; i--) {
+        const R f = s * e[i];
+        const R b = c * e[i];
+        r = std::hypot(f, g);
+        e[i + 1] = r;
+        if (r == R(0)) {
+          d[i + 1] -= p;
+          e[m] = 0;
+          underflow = true;
+          break;
+        }
+        s = f / r;
+        c = g / r;
+        g = d[i + 1] - p;
+        r = (d[i] - g) * s + R(2) * c * b;
+        p = s * r;
+        d[i + 1] = g + p;
+        g = c * r - b;
+        if (z != nullptr) {
+          for (index_t k = 0; k < n; k++) {
+            const R zf = z[k * n + i + 1];
+            z[k * n + i + 1] = s * z[k * n + i] + c * zf;
+            z[k * n + i] = c * z[k * n + i] - s * zf;
+          }
+        }
+      }
+      if (underflow) {
+        continue;
+      }
+      d[l] -= p;
+      e[l] = g;
+      e[m] = 0;
+    } while (true);
+  }
+
+  return true;
+}
+
+/**
+ * Sort eigenvalues in ascending order together with the columns of the
+ * n x n row-major z, when it is given
+ */
+template <typename R>
+void matxHostEigSort(R *d, index_t n, R *z)
+{
+  std::vector<index_t> perm(static_cast<size_t>(n));
+  std::iota(perm.begin(), perm.end(), 0);
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&](index_t x, index_t y) { return d[x] < d[y]; });
+  const std::vector<R> ds(d, d + n);
+  for (index_t j = 0; j < n; j++) {
+    d[j] = ds[perm[j]];
+  }
+  if (z != nullptr) {
+    std::vector<R> row(static_cast<size_t>(n));
+    for (index_t i = 0; i < n; i++) {
+      std::copy(z + i * n, z + (i + 1) * n, row.begin());
+      for (index_t j = 0; j < n; j++) {
+        z[i * n + j] = row[perm[j]];
+      }
+    }
+  }
+}
+
+/**
+ * Eigenvalues and eigenvectors of D + rho * z * z^T for rho > 0 and strictly
+ * increasing d, by the secular equation. Roots are found by bisection on the
+ * offset from the nearest pole so that the differences d[i] - lambda[j] keep
+ * full relative accuracy, and z is recomputed from the roots (Gu and
+ * Eisenstat) so the vectors are orthogonal without reorthogonalization. y
+ * receives the k x k row-major eigenvectors as columns.
+ */
+template <typename R>
+void matxHostSecular(const R *d, const R *z, R rho, index_t k, R *lambda, R *y)
+{
+  std::vector<index_t> origin(static_cast<size_t>(k));
+  std::vector<R> mu(static_cast<size_t>(k));
+  const auto secular = [&](index_t o, R m) {
+    R f = 1;
+    for (index_t i = 0; i < k; i++) {
+      f += rho * z[i] * z[i] / ((d[i] - d[o]) - m);
+    }
+    return f;
+  };
+
+  for (index_t j = 0; j < k; j++) {
+    index_t o = j;
+    R lo;
+    R hi;
+    if (j == k - 1) {
+      lo = 0;
+      hi = rho;
+    }
+    else {
+      const R half = (d[j + 1] - d[j]) / R(2);
+      if (secular(j, half) > R(0)) {
+        lo = 0;
+        hi = half;
+      }
+      else {
+        o = j + 1;
+        lo = -half;
+        hi = 0;
+      }
+    }
+
+    // The secular function is increasing between poles
+    for (int it = 0; it < 256; it++) {
+      const R mid = lo + (hi - lo) / R(2);
+      if (!(mid > lo && mid < hi)) {
+        break;
+      }
+      if (secular(o, mid) > R(0)) {
+        hi = mid;
+      }
+      else {
+        lo = mid;
+      }
+    }
+    origin[j] = o;
+    mu[j] = lo + (hi - lo) / R(2);
+    lambda[j] = d[o] + mu[j];
+  }
+
+  // delta(i, j) = d[i] - lambda[j]
+  const auto delta = [&](index_t i, index_t j) {
+    return (d[i] - d[origin[j]]) - mu[j];
+  };
+
+  std::vector<R> zh(static_cast<size_t>(k));
+  for (index_t i = 0; i < k; i++) {
+    R p = -delta(i, k - 1) / rho;
+    for (index_t j = 0; j < i; j++) {
+      p *= delta(i, j) / (d[i] - d[j]);
+    }
+    for (index_t j = i; j < k - 1; j++) {
+      p *= delta(i, j) / (d[i] - d[j + 1]);
+    }
+    zh[i] = std::copysign(std::sqrt(std::abs(p)), z[i]);
+  }
+
+  for (index_t j = 0; j < k; j++) {
+    R nrm = 0;
+    for (index_t i = 0; i < k; i++) {
+      const R v = zh[i] / delta(i, j);
+      y[i * k + j] = v;
+      nrm += v * v;
+    }
+    nrm = R(1) / std::sqrt(nrm);
+    for (index_t i = 0; i < k; i++) {
+      y[i * k + j] *= nrm;
+    }
+  }
+}
+
+/**
+ * Cuppen's divide and conquer for the symmetric tridiagonal (d, e), as in
+ * LAPACK stedc. The halves are solved recursively and merged through the
+ * rank-one secular problem after deflating small components of z and close
+ * eigenvalue pairs; the merged vectors are formed with a GEMM. Subproblems of
+ * at most HOST_SOLVER_SMALL_DIM use implicit QL. q receives the n x n
+ * row-major eigenvectors as columns and d the eigenvalues in ascending order.
+ */
+template <typename R>
+bool matxHostTridiagDC(R *d, R *e, index_t n, R *q, const HostExecutor &exec)
+{
+  if (n <= HOST_SOLVER_SMALL_DIM) {
+    std::fill(q, q + n * n, R(0));
+    for (index_t i = 0; i < n; i++) {
+      q[i * n + i] = 1;
+    }
+    if (!matxHostTridiagQL(d, e, n, q)) {
+      return false;
+    }
+    matxHostEigSort(d, n, q);
+    return true;
+  }
+
+  // T = diag(T1, T2) + beta * u * u^T with u = [e_last; sign * e_first]
+  const index_t m = n / 2;
+  const index_t n2 = n - m;
+  const R beta = std::abs(e[m - 1]);
+  const R sgn = e[m - 1] < R(0) ? R(-1) : R(1);
+  d[m - 1] -= beta;
+  d[m] -= beta;
+  e[m - 1] = 0;
+
+  std::vector<R> q1(static_cast<size_t>(m * m));
+  std::vector<R> q2(static_cast<size_t>(n2 * n2));
+  if (!matxHostTridiagDC(d, e, m, q1.data(), exec) ||
+      !matxHostTridiagDC(d + m, e + m, n2, q2.data(), exec)) {
+    return false;
+  }
+
+  // Merge the two sorted spectra, carrying z and the block diagonal basis
+  std::vector<index_t> perm(static_cast<size_t>(n));
+  for (index_t i = 0, a = 0, b = m; i < n; i++) {
+    perm[i] = (b == n || (a < m && d[a] <= d[b])) ? a++ : b++;
+  }
+
+  std::vector<R> dd(static_cast<size_t>(n));
+  std::vector<R> z(static_cast<size_t>(n));
+  std::vector<R> basis(static_cast<size_t>(n * n), R(0));
+  R znrm = 0;
+  for (index_t j = 0; j < n; j++) {
+    const index_t p = perm[j];
+    dd[j] = d[p];
+    if (p < m) {
+      z[j] = q1[(m - 1) * m + p];
+      for (index_t i = 0; i < m; i++) {
+        basis[i * n + j] = q1[i * m + p];
+      }
+    }
+    else {
+      z[j] = sgn * q2[p - m];
+      for (index_t i = 0; i < n2; i++) {
+        basis[(m + i) * n + j] = q2[i * n2 + p - m];
+      }
+    }
+    znrm += z[j] * z[j];
+  }
+
+  // Normalize z so that the rank-one term is rho * zh * zh^T
+  const R rho = beta * znrm;
+  znrm = std::sqrt(znrm);
+  for (index_t j = 0; j < n; j++) {
+    z[j] /= znrm;
+  }
+  R dmax = 0;
+  for (index_t j = 0; j < n; j++) {
+    dmax = std::max(dmax, std::abs(dd[j]));
+  }
+  const R tol =
+      R(8) * std::numeric_limits<R>::epsilon() * std::max(dmax, rho);
+
+  // Deflation as in LAPACK laed2
+  std::vector<index_t> keep;
+  std::vector<index_t> defl;
+  index_t pj = -1;
+  for (index_t j = 0; j < n; j++) {
+    if (rho * std::abs(z[j]) <= tol) {
+      defl.push_back(j);
+      continue;
+    }
+    if (pj < 0) {
+      pj = j;
+      continue;
+    }
+
+    const R tau = std::hypot(z[pj], z[j]);
+    const R c = z[j] / tau;
+    const R s = -z[pj] / tau;
+    if (std::abs((dd[j] - dd[pj]) * c * s) <= tol) {
+      z[j] = tau;
+      z[pj] = 0;
+      for (index_t i = 0; i < n; i++) {
+        const R x = basis[i * n + pj];
+        const R y = basis[i * n + j];
+        basis[i * n + pj] = c * x + s * y;
+        basis[i * n + j] = c * y - s * x;
+      }
+      const R t = dd[pj] * c * c + dd[j] * s * s;
+      dd[j] = dd[pj] * s * s + dd[j] * c * c;
+      dd[pj] = t;
+      defl.push_back(pj);
+    }
+    else {
+      keep.push_back(pj);
+    }
+    pj = j;
+  }
+  if (pj >= 0) {
+    keep.push_back(pj);
+  }
+
+  std::vector<R> lam(static_cast<size_t>(n));
+  std::fill(q, q + n * n, R(0));
+  const index_t k = static_cast<index_t>(keep.size());
+  if (k > 0) {
+    std::vector<R> dk(static_cast<size_t>(k));
+    std::vector<R> zk(static_cast<size_t>(k));
+    std::vector<R> bk(static_cast<size_t>(n * k));
+    for (index_t j = 0; j < k; j++) {
+      dk[j] = dd[keep[j]];
+      zk[j] = z[keep[j]];
+      for (index_t i = 0; i < n; i++) {
+        bk[i * k + j] = basis[i * n + keep[j]];
+      }
+    }
+
+    // Rotations can reorder nearly equal values by a rounding error
+    std::vector<index_t> ord(static_cast<size_t>(k));
+    std::iota(ord.begin(), ord.end(), 0);
+    std::stable_sort(ord.begin(), ord.end(),
+                     [&](index_t x, index_t y) { return dk[x] < dk[y]; });
+    std::vector<R> ds(static_cast<size_t>(k));
+    std::vector<R> zs(static_cast<size_t>(k));
+    std::vector<R> bs(static_cast<size_t>(n * k));
+    for (index_t j = 0; j < k; j++) {
+      ds[j] = dk[ord[j]];
+      zs[j] = zk[ord[j]];
+      for (index_t i = 0; i < n; i++) {
+        bs[i * k + j] = bk[i * k + ord[j]];
+      }
+    }
+
+    std::vector<R> y(static_cast<size_t>(k * k));
+    matxHostSecular(ds.data(), zs.data(), rho, k, lam.data(), y.data());
+    matxHostSolverGemm(matxHostSolverMat_t<R>{q, n, 1},
+                       matxHostSolverMat_t<R>{bs.data(), k, 1}.Operand(),
+                       matxHostSolverMat_t<R>{y.data(), k, 1}.Operand(), n, k,
+                       k, R(1), R(0), exec);
+  }
+
+  for (index_t j = 0; j < static_cast<index_t>(defl.size()); j++) {
+    lam[k + j] = dd[defl[j]];
+    for (index_t i = 0; i < n; i++) {
+      q[i * n + k + j] = basis[i * n + defl[j]];
+    }
+  }
+
+  std::copy(lam.begin(), lam.end(), d);
+  matxHostEigSort(d, n, q);
+  return true;
+}
+
+/**
+ * Eigen decomposition of one n x n Hermitian matrix read from the uplo
+ * triangle of a. w receives the eigenvalues in ascending order and, when
+ * vectors are requested, the columns of x the eigenvectors. The matrix is
+ * reduced to tridiagonal form, solved by divide and conquer, and the vectors
+ * are back-transformed with the blocked reflectors. Eigenvalues alone use
+ * implicit QL on the tridiagonal, which needs O(n^2) work after the
+ * reduction. Returns false if the tridiagonal solver does not converge.
+ */
+template <typename T>
+bool matxHostEigOne(const matxHostSolverMat_t<T> &a, value_type_t<T> *w,
+                    index_t w_stride, const matxHostSolverMat_t<T> &x,
+                    index_t n, bool vectors, bool upper,
+                    const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  std::vector<T> full(static_cast<size_t>(n * n));
+  const matxHostSolverMat_t<T> f{full.data(), n, 1};
+  for (index_t i = 0; i < n; i++) {
+    f(i, i) = matxHostRealPart(a(i, i));
+    for (index_t j = i + 1; j < n; j++) {
+      const T v = upper ? a(i, j) : matxHostConj(a(j, i));
+      f(i, j) = v;
+      f(j, i) = matxHostConj(v);
+    }
+  }
+
+  std::vector<real_t> d(static_cast<size_t>(n));
+  std::vector<real_t> e(static_cast<size_t>(n));
+  std::vector<T> tau(static_cast<size_t>(n));
+  matxHostTridiag(f, n, d.data(), e.data(), tau.data(), exec);
+
+  if (!vectors) {
+    if (!matxHostTridiagQL(d.data(), e.data(), n, static_cast<real_t *>(nullptr))) {
+      return false;
+    }
+    std::sort(d.begin(), d.end());
+    for (index_t j = 0; j < n; j++) {
+      w[j * w_stride] = d[j];
+    }
+    return true;
+  }
+
+  std::vector<real_t> z(static_cast<size_t>(n * n));
+  if (!matxHostTridiagDC(d.data(), e.data(), n, z.data(), exec)) {
+    return false;
+  }
+
+  // x = Q * Z, with Q acting on rows 1 to n - 1
+  for (index_t i = 0; i < n; i++) {
+    w[i * w_stride] = d[i];
+    for (index_t j = 0; j < n; j++) {
+      x(i, j) = z[i * n + j];
+    }
+  }
+  if (n > 1) {
+    matxHostQRApplyQ(f.Sub(1, 0), tau.data(), n - 1, n - 1, x.Sub(1, 0), n,
+                     exec);
+  }
+  return true;
+}
+
+/**
+ * Eigen decomposition of every batch of a into the eigenvectors x and
+ * eigenvalues w. Independent batches run in parallel.
+ */
+template <typename T, typename R, int RANK>
+bool matxHostEig(tensor_t<T, RANK> &x, tensor_t<R, RANK - 1> &w,
+                 const tensor_t<T, RANK> &a, bool vectors, bool upper,
+                 const HostExecutor &exec)
+{
+  const index_t batches = batch_count(a, 2);
+  const index_t n = a.Size(RANK - 1);
+  std::atomic<bool> ok{true};
+  matxHostSolverBatches(batches, exec, [&](index_t b, const HostExecutor &ex) {
+    if (!matxHostEigOne(matxHostSolverBatch(a, b), &batch_at(w, b, 0),
+                        w.Stride(RANK - 2), matxHostSolverBatch(x, b), n,
+                        vectors, upper, ex)) {
+      ok = false;
+    }
+  });
+  return ok;
+}
+
+/***************************************** INVERSE
+ * *********************************************/
+
+/**
+ * True if a is exactly Hermitian with a positive real diagonal, the
+ * necessary conditions for a Cholesky factorization to exist
+ */
+template <typename T>
+bool matxHostIsHermitianCandidate(const matxHostSolverMat_t<T> &a, index_t n)
+{
+  for (index_t i = 0; i < n; i++) {
+    const T d = a(i, i);
+    if (!(matxHostRealPart(d) > 0) || d != matxHostConj(d)) {
+      return false;
+    }
+    for (index_t j = i + 1; j < n; j++) {
+      if (a(i, j) != matxHostConj(a(j, i))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * x = inv(a) for one n x n matrix. Hermitian inputs with a positive diagonal
+ * first try Cholesky, a = L * L^H, giving inv(a) = Y^H * Y with Y = inv(L)
+ * formed by a triangular solve against the identity and the product taken
+ * over the upper triangle only. Everything else, including Hermitian inputs
+ * that turn out not to be positive definite, uses blocked LU with partial
+ * pivoting, solving L * U * X = I and undoing the row interchanges on the
+ * columns of X as in getri. The identity's zeros are skipped by solving it
+ * one block of columns at a time. x may alias a. Returns false if a is
+ * singular.
+ */
+template <typename T>
+bool matxHostInvOne(const matxHostSolverMat_t<T> &a,
+                    const matxHostSolverMat_t<T> &x, index_t n,
+                    const HostExecutor &exec)
+{
+  using real_t = value_type_t<T>;
+  constexpr index_t NB = HOST_SOLVER_BLOCK;
+  std::vector<T> fbuf(static_cast<size_t>(n * n));
+  const matxHostSolverMat_t<T> f{fbuf.data(), n, 1};
+  const auto load = [&]() {
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        f(i, j) = a(i, j);
+      }
+    }
+  };
+
+  // Solve tri * Y = I over the lower triangle of y, which must start zeroed
+  const auto solve_identity = [&](const matxHostSolverMat_t<T> &y, bool unit) {
+    for (index_t i = 0; i < n; i++) {
+      y(i, i) = T(1);
+    }
+    for (index_t c0 = 0; c0 < n; c0 += NB) {
+      matxHostTrsm(f.Sub(c0, c0), y.Sub(c0, c0), n - c0,
+                   std::min(NB, n - c0), true, unit, false, exec);
+    }
+  };
+
+  load();
+  if (matxHostIsHermitianCandidate(f, n) && matxHostCholBlocked(f, n, exec)) {
+    std::vector<T> ybuf(static_cast<size_t>(n * n), T(0));
+    const matxHostSolverMat_t<T> y{ybuf.data(), n, 1};
+    solve_identity(y, false);
+
+    matxHostGemm<T>([&](index_t) { return x.Operand(); },
+                    [&](index_t) { return y.Trans().Operand(true); },
+                    [&](index_t) { return y.Operand(); }, n, n, n, 1,
+                    real_t(1), real_t(0), exec, matxNoEpilogue_t{}, true);
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < i; j++) {
+        x(i, j) = matxHostConj(x(j, i));
+      }
+    }
+    return true;
+  }
+
+  load();
+  std::vector<int64_t> piv(static_cast<size_t>(n));
+  if (!matxHostLUBlocked(f, piv.data(), n, n, exec)) {
+    return false;
+  }
+
+  for (index_t i = 0; i < n; i++) {
+    for (index_t j = 0; j < n; j++) {
+      x(i, j) = T(0);
+    }
+  }
+  solve_identity(x, true);
+  matxHostTrsm(f, x, n, n, false, false, false, exec);
+
+  for (index_t j = n - 1; j >= 0; j--) {
+    const index_t p = static_cast<index_t>(piv[j] - 1);
+    if (p != j) {
+      for (index_t i = 0; i < n; i++) {
+        std::swap(x(i, j), x(i, p));
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Invert every batch of a into x. Independent batches run in parallel.
+ * Returns false if any batch is singular.
+ */
+template <typename T, int RANK>
+bool matxHostInv(const tensor_t<T, RANK> &x, const tensor_t<T, RANK> &a,
+                 const HostExecutor &exec)
+{
+  const index_t batches = batch_count(a, 2);
+  const index_t n = a.Size(RANK - 1);
+  std::atomic<bool> ok{true};
+  matxHostSolverBatches(batches, exec, [&](index_t b, const HostExecutor &ex) {
+    if (!matxHostInvOne(matxHostSolverBatch(a, b), matxHostSolverBatch(x, b),
+                        n, ex)) {
+      ok = false;
+    }
+  });
+  return ok;
+}
+
+} // end namespace matx
@@ -912,6 +912,31 @@ class tensor_impl_t {
     return shape_.Size(Rank() - 1);
   }
 
+  /**
+   * Get the data pointer of the view
+   *
+   * @returns Pointer to the first element of the view
+   *
+   */
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T *Data() const noexcept
+  {
+    return ldata_;
+  }
+
+  /**
+   * Get the stride of a single dimension of the tensor
+   *
+   * @param dim
+   *   Desired dimension
+   *
+   * @returns Stride (in elements) in dimension
+   *
+   */
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Stride(uint32_t dim) const noexcept
+  {
+    return s_[dim];
+  }
+
   protected:
     T *ldata_;
     tensorShape_t<RANK> shape_;
@@ -283,9 +283,9 @@ namespace matx
         {
           index_t size1 = get_expanded_size<Rank()>(cond_, i);
           index_t size2 = get_expanded_size<Rank()>(op_, i);
+          size_[i] = MAX(size1, size2);
           MATX_ASSERT(size1 == 0 || size1 == Size(i), matxInvalidSize);
           MATX_ASSERT(size2 == 0 || size2 == Size(i), matxInvalidSize);
-          size_[i] = MAX(size1, size2);
         }
       }
     }
@@ -586,6 +586,11 @@ namespace matx
 
     __MATX_INLINE__ HermitianTransOp(T1 op) : op_(op) {}
 
+    /**
+     * Operator being transposed and conjugated
+     */
+    __MATX_INLINE__ __MATX_HOST__ const auto &Operand() const { return op_; }
+
     __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()() { return conj(op_()); }
     __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(index_t i) { return conj(op_(i)); }
     __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(index_t i, index_t j)
@@ -1418,6 +1423,11 @@ namespace matx
       }
     }
 
+    /**
+     * Input of the unary operator
+     */
+    __MATX_INLINE__ __MATX_HOST__ const auto &Operand() const { return in1_; }
+
     __MATX_DEVICE__ __MATX_HOST__ __MATX_INLINE__ auto operator()()
     {
       auto i1 = get_value(in1_);
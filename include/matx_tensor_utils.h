@@ -320,4 +320,119 @@ namespace matx
       return get_matx_value(i, idw, idz, idy, idx);
     }
   }
-}
\ No newline at end of file
+
+  /**
+   * Returns element n of the last dimension of batch b, where b is the
+   * row-major linearization of all outer dimensions. Used by host transforms
+   * that treat every dimension but the last as a batch.
+   */
+  template <class T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ decltype(auto) batch_at(T &i, [[maybe_unused]] index_t b, index_t n)
+  {
+    if constexpr (T::Rank() == 1)
+    {
+      return i(n);
+    }
+    else if constexpr (T::Rank() == 2)
+    {
+      return i(b, n);
+    }
+    else if constexpr (T::Rank() == 3)
+    {
+      const index_t s1 = i.Size(1);
+      return i(b / s1, b % s1, n);
+    }
+    else
+    {
+      const index_t s1 = i.Size(1);
+      const index_t s2 = i.Size(2);
+      return i(b / (s1 * s2), (b / s2) % s1, b % s2, n);
+    }
+  }
+
+  /**
+   * Returns element (y, x) of the last two dimensions of batch b, where b is
+   * the row-major linearization of all outer dimensions
+   */
+  template <class T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ decltype(auto) batch_at2(T &i, [[maybe_unused]] index_t b, index_t y, index_t x)
+  {
+    if constexpr (T::Rank() == 2)
+    {
+      return i(y, x);
+    }
+    else if constexpr (T::Rank() == 3)
+    {
+      return i(b, y, x);
+    }
+    else
+    {
+      const index_t s1 = i.Size(1);
+      return i(b / s1, b % s1, y, x);
+    }
+  }
+
+  /**
+   * Access element b of a tensor whose every dimension is a batch, with b
+   * being the row-major linearization of the dimensions (ranks 0-2)
+   */
+  template <class T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ decltype(auto) batch_at0(T &i, [[maybe_unused]] index_t b)
+  {
+    if constexpr (T::Rank() == 0)
+    {
+      return i();
+    }
+    else if constexpr (T::Rank() == 1)
+    {
+      return i(b);
+    }
+    else
+    {
+      const index_t s1 = i.Size(1);
+      return i(b / s1, b % s1);
+    }
+  }
+
+  /**
+   * Marker for a GEMM with no elementwise epilogue
+   */
+  struct matxNoEpilogue_t {};
+
+  /**
+   * Value of operator op at row y and column x of batch b of a tensor shaped
+   * like ref. Lower-rank operators and scalars are broadcast as in get_value.
+   */
+  template <class Op, class T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ auto batch_get_value2(const Op &op, const T &ref, [[maybe_unused]] index_t b, index_t y, index_t x)
+  {
+    if constexpr (T::Rank() == 2)
+    {
+      return get_value(op, y, x);
+    }
+    else if constexpr (T::Rank() == 3)
+    {
+      return get_value(op, b, y, x);
+    }
+    else
+    {
+      const index_t s1 = ref.Size(1);
+      return get_value(op, b / s1, b % s1, y, x);
+    }
+  }
+
+  /**
+   * Number of batches formed by all dimensions except the last inner_dims
+   */
+  template <class T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t batch_count(const T &i, int inner_dims)
+  {
+    index_t b = 1;
+    for (int d = 0; d < T::Rank() - inner_dims; d++)
+    {
+      b *= i.Size(d);
+    }
+
+    return b;
+  }
+}
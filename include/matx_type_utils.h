@@ -214,6 +214,13 @@ template <class T> using value_type_t = typename value_type<T>::type;
 
 template <typename T> using value_promote_t = promote_half_t<value_type_t<T>>;
 
+// Promotes MatX half-precision types to the single-precision type host code
+// computes in
+template <typename T>
+using promote_matx_half_t = typename std::conditional_t<
+    is_matx_half_v<T>, float,
+    std::conditional_t<is_complex_half_v<T>, cuda::std::complex<float>, T>>;
+
 
 // Helpers for extracting types in the aliases
 template <typename T, typename = void> struct extract_scalar_type_impl {
@@ -536,6 +536,42 @@ TYPED_TEST(OperatorTestsNumericNoHalf, HostAdvancedOperators)
   MATX_EXIT_HANDLER();
 }
 
+// The host executor reuses pooled threads across calls, supports nested
+// ParallelFor calls, and rethrows errors raised on worker threads
+TEST(OperatorTests, HostExecutorParallelFor)
+{
+  MATX_ENTER_HANDLER();
+  const HostExecutor exec{4};
+
+  for (int rep = 0; rep < 50; rep++) {
+    std::vector<index_t> hits(1000, 0);
+    exec.ParallelFor(1000, [&](index_t i) { hits[i]++; });
+    for (index_t i = 0; i < 1000; i++) {
+      ASSERT_EQ(hits[i], 1);
+    }
+  }
+
+  std::atomic<index_t> total{0};
+  exec.ParallelFor(8, [&](index_t i) {
+    exec.ParallelFor(100, [&](index_t j) { total += i * 100 + j; });
+  });
+  ASSERT_EQ(total.load(), 799 * 800 / 2);
+
+  EXPECT_THROW(exec.ParallelFor(100,
+                                [](index_t i) {
+                                  MATX_ASSERT_STR(i != 57, matxInvalidSize,
+                                                  "bad item");
+                                }),
+               matxException);
+
+  // Operators run on the same pooled threads
+  tensor_t<float, 1> a({10000});
+  (a = ones<float>({10000})).run(exec);
+  ASSERT_EQ(a(9999), 1.0f);
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(OperatorTestsFloatHalf, AdvancedOperators)
 {
   MATX_ENTER_HANDLER();
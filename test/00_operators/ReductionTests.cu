@@ -317,6 +317,49 @@ TEST(ReductionTests, Median)
   MATX_EXIT_HANDLER();
 }
 
+TEST(ReductionTests, MedianPercentileHost)
+{
+  MATX_ENTER_HANDLER();
+  using TypeParam = float;
+  {
+    tensor_t<TypeParam, 0> t0{};
+    tensor_t<TypeParam, 1> t1e{{10}};
+    tensor_t<TypeParam, 1> t1o{{11}};
+    tensor_t<TypeParam, 2> t2e{{2, 4}};
+    tensor_t<TypeParam, 1> t1out{{2}};
+
+    t1e.SetVals({1, 3, 8, 2, 9, 6, 7, 4, 5, 0});
+    t1o.SetVals({1, 3, 8, 2, 9, 6, 7, 4, 5, 0, 10});
+    t2e.SetVals({{2, 4, 1, 3}, {3, 1, 2, 4}});
+
+    median(t0, t1e, HostExecutor{});
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0(), (TypeParam)(4.5f)));
+
+    median(t0, t1o, HostExecutor{});
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0(), (TypeParam)(5)));
+
+    median(t1out, t2e, HostExecutor{});
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t1out(0), (TypeParam)(2.5f)));
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t1out(1), (TypeParam)(2.5f)));
+
+    // Percentiles interpolate between neighbouring sorted elements
+    percentile(t0, t1o, 0.0, HostExecutor{});
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0(), (TypeParam)(0)));
+
+    percentile(t0, t1o, 100.0, HostExecutor{});
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0(), (TypeParam)(10)));
+
+    percentile(t0, t1e, 25.0, HostExecutor{});
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0(), (TypeParam)(2.25f)));
+
+    percentile(t1out, t2e, 75.0, HostExecutor{});
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t1out(0), (TypeParam)(3.25f)));
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t1out(1), (TypeParam)(3.25f)));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TEST(ReductionTests, MinMax)
 {
   MATX_ENTER_HANDLER();
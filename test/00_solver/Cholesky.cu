@@ -81,3 +81,167 @@ TYPED_TEST(CholSolverTestNonComplexFloatTypes, CholeskyBasic)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(CholSolverTestNonComplexFloatTypes, CholeskyHost)
+{
+  MATX_ENTER_HANDLER();
+
+  chol(this->Bv, this->Bv, HostExecutor{}, CUBLAS_FILL_MODE_LOWER);
+
+  for (index_t i = 0; i < this->Bv.Size(0); i++) {
+    for (index_t j = 0; j <= i; j++) {
+      ASSERT_NEAR(this->Bv(i, j), this->Lv(i, j), 0.001);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CholSolverTestNonComplexFloatTypes, Solve)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 3;
+  constexpr index_t nrhs = 3;
+  tensor_t<TypeParam, 3> a{{batches, dim_size, dim_size}};
+  tensor_t<TypeParam, 3> l{{batches, dim_size, dim_size}};
+  tensor_t<TypeParam, 3> xref{{batches, dim_size, nrhs}};
+  tensor_t<TypeParam, 3> b{{batches, dim_size, nrhs}};
+  tensor_t<TypeParam, 3> x{{batches, dim_size, nrhs}};
+
+  // Shifting the diagonal keeps every batch positive definite, and distinct
+  for (index_t k = 0; k < batches; k++) {
+    for (index_t i = 0; i < dim_size; i++) {
+      for (index_t j = 0; j < dim_size; j++) {
+        a(k, i, j) = this->Bv(i, j) +
+                     (i == j ? static_cast<TypeParam>(k) : TypeParam(0));
+      }
+      for (index_t j = 0; j < nrhs; j++) {
+        xref(k, i, j) =
+            static_cast<TypeParam>((i + 2 * j + k) % 5) - TypeParam(2);
+      }
+    }
+  }
+  matmul(b, a, xref);
+  cudaStreamSynchronize(0);
+
+  const auto check = [&]() {
+    for (index_t k = 0; k < batches; k++) {
+      for (index_t i = 0; i < dim_size; i++) {
+        for (index_t j = 0; j < nrhs; j++) {
+          ASSERT_NEAR(x(k, i, j), xref(k, i, j), 0.01);
+        }
+      }
+    }
+  };
+
+  // getrf/getrs, twice to reuse the cached plan
+  for (int rep = 0; rep < 2; rep++) {
+    solve(x, a, b);
+    cudaStreamSynchronize(0);
+    check();
+  }
+
+  // potrs from a lower factor
+  chol(l, a, 0, CUBLAS_FILL_MODE_LOWER);
+  cho_solve(x, l, b, 0, CUBLAS_FILL_MODE_LOWER);
+  cudaStreamSynchronize(0);
+  check();
+
+  // A singular batch is reported after the batched factorization
+  for (index_t j = 0; j < dim_size; j++) {
+    a(1, dim_size - 1, j) = TypeParam(0);
+  }
+  EXPECT_THROW(solve(x, a, b), matxException);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CholSolverTestNonComplexFloatTypes, SolveHost)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t nrhs = 3;
+  tensor_t<TypeParam, 2> xref{{dim_size, nrhs}};
+  tensor_t<TypeParam, 2> b{{dim_size, nrhs}};
+  tensor_t<TypeParam, 2> x{{dim_size, nrhs}};
+  for (index_t i = 0; i < dim_size; i++) {
+    for (index_t j = 0; j < nrhs; j++) {
+      xref(i, j) = static_cast<TypeParam>((i + 2 * j) % 5) - TypeParam(2);
+    }
+  }
+  matmul(b, this->Bv, xref, HostExecutor{});
+
+  const auto check = [&]() {
+    for (index_t i = 0; i < dim_size; i++) {
+      for (index_t j = 0; j < nrhs; j++) {
+        ASSERT_NEAR(x(i, j), xref(i, j), 0.01);
+      }
+    }
+  };
+
+  solve(x, this->Bv, b, HostExecutor{});
+  check();
+
+  // A factorization reused across solves, with B overwritten in place
+  matxDnSolveHostPlan_t<TypeParam, 2> factor{this->Bv, MAT_SOLVE_ALGO_CHOL};
+  factor.Factor(this->Bv, HostExecutor{});
+  (x = b).run(HostExecutor{});
+  factor.Solve(x, x, HostExecutor{});
+  check();
+
+  chol(this->Lv, this->Bv, HostExecutor{}, CUBLAS_FILL_MODE_LOWER);
+  cho_solve(x, this->Lv, b, HostExecutor{}, CUBLAS_FILL_MODE_LOWER);
+  check();
+
+  MATX_EXIT_HANDLER();
+}
+
+// Batches of matrices up to HOST_SOLVER_SMALL_DIM are factored in interleaved
+// lanes. The batch count is not a multiple of the lane width, so the last
+// group is partly padding.
+TYPED_TEST(CholSolverTestNonComplexFloatTypes, CholeskyHostBatchedSmall)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 37;
+
+  for (index_t n : {3, 12, 16}) {
+    tensor_t<TypeParam, 3> a{{batches, n, n}};
+    tensor_t<TypeParam, 3> l{{batches, n, n}};
+    tensor_t<TypeParam, 3> u{{batches, n, n}};
+
+    // A = M * M^T + n * I is positive definite
+    for (index_t b = 0; b < batches; b++) {
+      for (index_t i = 0; i < n; i++) {
+        for (index_t j = 0; j < n; j++) {
+          TypeParam v = i == j ? static_cast<TypeParam>(n) : TypeParam(0);
+          for (index_t k = 0; k < n; k++) {
+            v += static_cast<TypeParam>((i * 3 + k * 5 + b) % 7 - 3) *
+                 static_cast<TypeParam>((j * 3 + k * 5 + b) % 7 - 3) /
+                 TypeParam(4);
+          }
+          a(b, i, j) = v;
+        }
+      }
+    }
+
+    chol(l, a, HostExecutor{}, CUBLAS_FILL_MODE_LOWER);
+    chol(u, a, HostExecutor{}, CUBLAS_FILL_MODE_UPPER);
+
+    for (index_t b = 0; b < batches; b++) {
+      for (index_t i = 0; i < n; i++) {
+        for (index_t j = 0; j <= i; j++) {
+          TypeParam ll = 0;
+          TypeParam uu = 0;
+          for (index_t k = 0; k <= j; k++) {
+            ll += l(b, i, k) * l(b, j, k);
+            uu += u(b, k, i) * u(b, k, j);
+          }
+          ASSERT_NEAR(ll, a(b, i, j), 0.001 * n);
+          ASSERT_NEAR(uu, a(b, i, j), 0.001 * n);
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
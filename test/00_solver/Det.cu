@@ -80,3 +80,111 @@ TYPED_TEST(DetSolverTestNonComplexFloatTypes, Determinant)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(DetSolverTestNonComplexFloatTypes, BatchedSmall)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 300;
+  constexpr index_t n = 5;
+  tensor_t<TypeParam, 3> a{{batches, n, n}};
+  tensor_t<TypeParam, 1> d{{batches}};
+  tensor_t<TypeParam, 1> d_host{{batches}};
+
+  // Upper triangular with the first two rows swapped, so the determinant is
+  // minus the product of the diagonal and requires pivoting
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        const index_t r = i < 2 ? 1 - i : i;
+        if (j < i) {
+          a(b, r, j) = 0;
+        }
+        else if (j == i) {
+          a(b, r, j) = static_cast<TypeParam>(i + b % 7 + 1) / TypeParam(4);
+        }
+        else {
+          a(b, r, j) = static_cast<TypeParam>((i + j + b) % 3) / TypeParam(3);
+        }
+      }
+    }
+  }
+
+  det(d, a);
+  det_small<n>(d_host, a, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t b = 0; b < batches; b++) {
+    TypeParam ref = -1;
+    for (index_t i = 0; i < n; i++) {
+      ref *= static_cast<TypeParam>(i + b % 7 + 1) / TypeParam(4);
+    }
+    ASSERT_NEAR(d(b), ref, 1e-4 * std::abs(ref));
+    ASSERT_NEAR(d_host(b), ref, 1e-4 * std::abs(ref));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Rows of an upper triangular matrix shifted down by one (with wrap), so LU
+// takes n - 1 row interchanges and the determinant is minus the product of
+// the diagonal for even n
+TYPED_TEST(DetSolverTestNonComplexFloatTypes, PivotSign)
+{
+  MATX_ENTER_HANDLER();
+  auto fill = [](auto &a, index_t b, index_t n) {
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        TypeParam v = 0;
+        if (j == i) {
+          v = static_cast<TypeParam>(i % 3 + 2) / TypeParam(2);
+        }
+        else if (j > i) {
+          v = static_cast<TypeParam>((i + j + b) % 3) / TypeParam(3);
+        }
+
+        if constexpr (std::decay_t<decltype(a)>::Rank() == 2) {
+          a((i + 1) % n, j) = v;
+        }
+        else {
+          a(b, (i + 1) % n, j) = v;
+        }
+      }
+    }
+  };
+  auto ref = [](index_t n) {
+    TypeParam r = -1;
+    for (index_t i = 0; i < n; i++) {
+      r *= static_cast<TypeParam>(i % 3 + 2) / TypeParam(2);
+    }
+    return r;
+  };
+
+  // Single matrix at n = 4
+  {
+    constexpr index_t n = 4;
+    tensor_t<TypeParam, 2> a{{n, n}};
+    tensor_t<TypeParam, 0> d{};
+    fill(a, 0, n);
+    det(d, a);
+    cudaStreamSynchronize(0);
+    ASSERT_NEAR(d(), ref(n), 1e-4 * std::abs(ref(n)));
+  }
+
+  // Batch at n = 16, above the small-matrix kernels
+  {
+    constexpr index_t batches = 3;
+    constexpr index_t n = 16;
+    tensor_t<TypeParam, 3> a{{batches, n, n}};
+    tensor_t<TypeParam, 1> d{{batches}};
+    for (index_t b = 0; b < batches; b++) {
+      fill(a, b, n);
+    }
+    det(d, a);
+    cudaStreamSynchronize(0);
+    for (index_t b = 0; b < batches; b++) {
+      ASSERT_NEAR(d(b), ref(n), 1e-4 * std::abs(ref(n)));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -96,3 +96,88 @@ TYPED_TEST(EigenSolverTestNonComplexFloatTypes, EigenBasic)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(EigenSolverTestNonComplexFloatTypes, EigenHost)
+{
+  MATX_ENTER_HANDLER();
+  eig(this->Evv, this->Wov, this->Bv, HostExecutor{});
+
+  for (index_t i = 1; i < dim_size; i++) {
+    ASSERT_LE(this->Wov(i - 1), this->Wov(i));
+  }
+
+  // A*v = lambda*v for every column of the eigenvector output
+  for (index_t i = 0; i < dim_size; i++) {
+    auto v = this->Evv.template Slice<2>({0, i}, {matxEnd, i + 1});
+    (this->Wv = v).run(HostExecutor{});
+    (this->Lvv = v * this->Wov(i)).run(HostExecutor{});
+    matmul(this->Gtv, this->Bv, this->Wv, HostExecutor{});
+    for (index_t j = 0; j < dim_size; j++) {
+      ASSERT_NEAR(this->Gtv(j, 0), this->Lvv(j, 0), 0.001);
+    }
+  }
+
+  // The eigenvalue-only path matches
+  tensor_t<TypeParam, 1> w2{{dim_size}};
+  eig(this->Evv, w2, this->Bv, HostExecutor{}, CUSOLVER_EIG_MODE_NOVECTOR);
+  for (index_t i = 0; i < dim_size; i++) {
+    ASSERT_NEAR(w2(i), this->Wov(i), 0.001);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+template <typename TensorType>
+class EigenSolverTestComplexFloatTypes : public ::testing::Test {
+};
+
+TYPED_TEST_SUITE(EigenSolverTestComplexFloatTypes, MatXComplexNonHalfTypes);
+
+TYPED_TEST(EigenSolverTestComplexFloatTypes, EigenHostHermitian)
+{
+  MATX_ENTER_HANDLER();
+  using vtype = typename TypeParam::value_type;
+  constexpr index_t n = 40;
+
+  // Hermitian input with a nonzero imaginary part in every off-diagonal
+  tensor_t<TypeParam, 2> Bv{{n, n}};
+  tensor_t<TypeParam, 2> Ev{{n, n}};
+  tensor_t<vtype, 1> Wov{{n}};
+  for (index_t i = 0; i < n; i++) {
+    for (index_t j = i; j < n; j++) {
+      vtype re = static_cast<vtype>(((i * 7 + j * 13) % 17) - 8) / 8;
+      vtype im = (i == j) ? vtype(0)
+                          : static_cast<vtype>(((i * 5 + j * 3) % 11) + 1) / 11;
+      Bv(i, j) = TypeParam{re, im};
+      Bv(j, i) = TypeParam{re, -im};
+    }
+  }
+
+  eig(Ev, Wov, Bv, HostExecutor{});
+
+  for (index_t i = 1; i < n; i++) {
+    ASSERT_LE(Wov(i - 1), Wov(i));
+  }
+
+  // A*v = lambda*v for every column of the eigenvector output
+  for (index_t i = 0; i < n; i++) {
+    for (index_t r = 0; r < n; r++) {
+      TypeParam av{0};
+      for (index_t k = 0; k < n; k++) {
+        av += Bv(r, k) * Ev(k, i);
+      }
+      TypeParam lv = Ev(r, i) * Wov(i);
+      ASSERT_NEAR(av.real(), lv.real(), 0.001);
+      ASSERT_NEAR(av.imag(), lv.imag(), 0.001);
+    }
+  }
+
+  // The eigenvalue-only path matches
+  tensor_t<vtype, 1> w2{{n}};
+  eig(Ev, w2, Bv, HostExecutor{}, CUSOLVER_EIG_MODE_NOVECTOR);
+  for (index_t i = 0; i < n; i++) {
+    ASSERT_NEAR(w2(i), Wov(i), 0.001);
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -93,3 +93,21 @@ TYPED_TEST(QRSolverTestNonComplexFloatTypes, QRBasic)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(QRSolverTestNonComplexFloatTypes, QRHost)
+{
+  MATX_ENTER_HANDLER();
+
+  qr(this->Av, this->TauV, this->Av, HostExecutor{});
+
+  for (index_t i = 0; i < this->Av.Size(0); i++) {
+    for (index_t j = 0; j < this->Av.Size(1); j++) {
+      // R is stored only in the top triangle of A
+      if (i <= j) {
+        ASSERT_NEAR(this->Av(i, j), this->Rv(i, j), 0.001);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
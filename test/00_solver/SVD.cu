@@ -117,3 +117,129 @@ TYPED_TEST(SVDSolverTestNonComplexFloatTypes, SVDBasic)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(SVDSolverTestNonComplexFloatTypes, SVDHost)
+{
+  MATX_ENTER_HANDLER();
+
+  // Like the stream version, U and V^H are column-major and are transposed
+  // back to verify the identity
+  svd(this->Uv, this->Sv, this->Vv, this->Av, HostExecutor{});
+  (this->Uav = this->Uv.Permute({1, 0})).run(HostExecutor{});
+  (this->Vav = this->Vv.Permute({1, 0})).run(HostExecutor{});
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      this->Sav(i, j) = i == j ? this->Sv(i) : TypeParam(0);
+    }
+  }
+
+  for (index_t i = 1; i < n; i++) {
+    ASSERT_GE(this->Sv(i - 1), this->Sv(i));
+  }
+
+  matmul(this->tmpV, this->Uav, this->Sav, HostExecutor{}); // U * S
+  matmul(this->Sav, this->tmpV, this->Vav, HostExecutor{}); // (U * S) * V'
+
+  for (index_t i = 0; i < this->Av.Size(0); i++) {
+    for (index_t j = 0; j < this->Av.Size(1); j++) {
+      ASSERT_NEAR(this->Av(i, j), this->Sav(i, j), 0.001) << i << " " << j;
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Square, wide and rank-deficient inputs with every job type. U and V^H are
+// read through their column-major layout: U(i, j) = u(j, i).
+TYPED_TEST(SVDSolverTestNonComplexFloatTypes, SVDHostShapes)
+{
+  MATX_ENTER_HANDLER();
+  struct shape_t {
+    index_t rows;
+    index_t cols;
+    index_t rank;
+    char job;
+  };
+  const std::array<shape_t, 4> shapes{{{128, 128, 128, 'A'},
+                                       {30, 70, 30, 'S'},
+                                       {60, 60, 20, 'A'},
+                                       {40, 25, 25, 'N'}}};
+
+  for (const auto &sh : shapes) {
+    const index_t k = std::min(sh.rows, sh.cols);
+    const index_t ucols = sh.job == 'A' ? sh.rows : k;
+    const index_t vrows = sh.job == 'A' ? sh.cols : k;
+    tensor_t<TypeParam, 2> a{{sh.rows, sh.cols}};
+    tensor_t<TypeParam, 2> u{{ucols, sh.rows}};
+    tensor_t<TypeParam, 1> sv{{k}};
+    tensor_t<TypeParam, 2> v{{sh.cols, vrows}};
+
+    // A = X * Y with X (rows x rank) and Y (rank x cols) from an LCG, so
+    // only the first rank singular values are nonzero
+    uint32_t state = 12345;
+    auto next = [&]() {
+      state = state * 1664525u + 1013904223u;
+      return static_cast<TypeParam>(static_cast<int>(state >> 24) - 128) /
+             TypeParam(128);
+    };
+    std::vector<TypeParam> x(sh.rows * sh.rank);
+    std::vector<TypeParam> y(sh.rank * sh.cols);
+    std::generate(x.begin(), x.end(), next);
+    std::generate(y.begin(), y.end(), next);
+    for (index_t i = 0; i < sh.rows; i++) {
+      for (index_t j = 0; j < sh.cols; j++) {
+        TypeParam acc = 0;
+        for (index_t r = 0; r < sh.rank; r++) {
+          acc += x[i * sh.rank + r] * y[r * sh.cols + j];
+        }
+        a(i, j) = acc;
+      }
+    }
+
+    svd(u, sv, v, a, HostExecutor{}, sh.job, sh.job);
+
+    for (index_t i = 1; i < k; i++) {
+      ASSERT_GE(sv(i - 1), sv(i));
+    }
+    ASSERT_GT(sv(sh.rank - 1), TypeParam(0.001));
+    for (index_t i = sh.rank; i < k; i++) {
+      ASSERT_NEAR(sv(i), TypeParam(0), 0.001);
+    }
+    if (sh.job == 'N') {
+      continue;
+    }
+
+    for (index_t i = 0; i < sh.rows; i++) {
+      for (index_t j = 0; j < sh.cols; j++) {
+        TypeParam r = 0;
+        for (index_t p = 0; p < k; p++) {
+          r += u(p, i) * sv(p) * v(j, p);
+        }
+        ASSERT_NEAR(r, a(i, j), 0.001) << i << " " << j;
+      }
+    }
+
+    // Every returned vector is orthonormal, including the completed ones
+    for (index_t p = 0; p < ucols; p++) {
+      for (index_t q = 0; q < ucols; q++) {
+        TypeParam d = 0;
+        for (index_t i = 0; i < sh.rows; i++) {
+          d += u(p, i) * u(q, i);
+        }
+        ASSERT_NEAR(d, p == q ? TypeParam(1) : TypeParam(0), 0.001);
+      }
+    }
+    for (index_t p = 0; p < vrows; p++) {
+      for (index_t q = 0; q < vrows; q++) {
+        TypeParam d = 0;
+        for (index_t j = 0; j < sh.cols; j++) {
+          d += v(j, p) * v(j, q);
+        }
+        ASSERT_NEAR(d, p == q ? TypeParam(1) : TypeParam(0), 0.001);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -117,6 +117,121 @@ TEST(TensorStats, Hist)
   MATX_EXIT_HANDLER();
 }
 
+TEST(TensorStats, HistHost)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr int levels = 7;
+  tensor_t<float, 1> inv({10});
+  tensor_t<int, 1> outv({levels - 1});
+
+  inv.SetVals({2.2, 6.0, 7.1, 2.9, 3.5, 0.3, 2.9, 2.0, 6.1, 999.5});
+
+  hist(outv, inv, 0.0f, 12.0f, HostExecutor{});
+
+  std::array<int, levels - 1> sol = {1, 5, 0, 3, 0, 0};
+  for (index_t i = 0; i < outv.Lsize(); i++) {
+    ASSERT_EQ(outv(i), sol[i]);
+  }
+
+  // Custom edges, with an empty bin from a repeated edge
+  tensor_t<float, 1> edges({5});
+  tensor_t<int, 1> oute({4});
+  edges.SetVals({0.0f, 2.9f, 2.9f, 6.05f, 10.0f});
+
+  hist(oute, inv, edges, HostExecutor{});
+
+  std::array<int, 4> sole = {3, 0, 4, 2};
+  for (index_t i = 0; i < oute.Lsize(); i++) {
+    ASSERT_EQ(oute(i), sole[i]);
+  }
+
+  // Batched rows
+  tensor_t<float, 2> inv2({3, 10});
+  tensor_t<int, 2> outv2({3, levels - 1});
+  for (index_t i = 0; i < inv2.Size(0); i++) {
+    for (index_t j = 0; j < inv2.Size(1); j++) {
+      inv2(i, j) = inv(j) + static_cast<float>(2 * i);
+    }
+  }
+
+  hist(outv2, inv2, 0.0f, 12.0f, HostExecutor{});
+
+  for (index_t i = 0; i < outv2.Size(0); i++) {
+    int total = 0;
+    for (index_t j = 0; j < outv2.Size(1); j++) {
+      ASSERT_EQ(outv2(i, j), j >= i ? sol[j - i] : 0);
+      total += outv2(i, j);
+    }
+    ASSERT_EQ(total, 9);
+  }
+
+  // Joint histogram of a sample index ramp against the data
+  tensor_t<float, 1> ramp({10});
+  tensor_t<int, 2> out2d({2, levels - 1});
+  ramp.SetVals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+  hist2d(out2d, ramp, inv, 0.0f, 10.0f, 0.0f, 12.0f, HostExecutor{});
+
+  std::array<int, 2 * (levels - 1)> sol2d = {0, 3, 0, 2, 0, 0,
+                                             1, 2, 0, 1, 0, 0};
+  for (index_t i = 0; i < out2d.Size(0); i++) {
+    for (index_t j = 0; j < out2d.Size(1); j++) {
+      ASSERT_EQ(out2d(i, j), sol2d[i * out2d.Size(1) + j]);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Rows long enough to be split into chunks counted by separate threads, both
+// contiguous and strided, with samples outside the range
+TEST(TensorStats, HistHostChunked)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr int bins = 13;
+  constexpr index_t n = 4 * HOST_HIST_MIN_CHUNK + 77;
+  tensor_t<float, 2> in({2, n});
+  tensor_t<float, 2> inT({n, 2});
+  uint32_t x = 1;
+  for (index_t i = 0; i < 2; i++) {
+    for (index_t j = 0; j < n; j++) {
+      x = x * 1664525u + 1013904223u;
+      in(i, j) = static_cast<float>(x >> 8) / static_cast<float>(1 << 24) *
+                     14.0f - 1.0f;
+      inT(j, i) = in(i, j);
+    }
+  }
+
+  std::array<std::array<int, bins>, 2> ref{};
+  for (index_t i = 0; i < 2; i++) {
+    for (index_t j = 0; j < n; j++) {
+      const float v = in(i, j);
+      if (v >= 0.0f && v < 12.0f) {
+        const int b = static_cast<int>(v * (static_cast<float>(bins) / 12.0f));
+        ref[i][std::min(bins - 1, b)]++;
+      }
+    }
+  }
+
+  tensor_t<int, 1> out1({bins});
+  tensor_t<int, 2> out2({2, bins});
+  auto row0 = in.Slice<1>({0, 0}, {matxDropDim, matxEnd});
+  auto strided = inT.Permute({1, 0});
+  hist(out1, row0, 0.0f, 12.0f, HostExecutor{4});
+  hist(out2, strided, 0.0f, 12.0f, HostExecutor{4});
+
+  for (index_t b = 0; b < bins; b++) {
+    ASSERT_EQ(out1(b), ref[0][b]);
+    for (index_t i = 0; i < 2; i++) {
+      ASSERT_EQ(out2(i, b), ref[i][b]);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CUBTestsNumericNonComplex, CumSum)
 {
   MATX_ENTER_HANDLER();
@@ -159,6 +274,82 @@ TYPED_TEST(CUBTestsNumericNonComplex, CumSum)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(CUBTestsNumericNonComplex, CumSumHost)
+{
+  MATX_ENTER_HANDLER();
+
+  for (index_t i = 0; i < this->t1.Lsize(); i++) {
+    this->t1(i) = static_cast<TypeParam>((2 * (i % 2) - 1) * i);
+  }
+
+  tensor_t<TypeParam, 1> tmpv({this->t1.Lsize()});
+
+  // Inclusive and exclusive
+  cumsum(tmpv, this->t1, HostExecutor{});
+
+  TypeParam ttl = 0;
+  for (index_t i = 0; i < tmpv.Lsize(); i++) {
+    ttl += this->t1(i);
+    ASSERT_NEAR(tmpv(i), ttl, 0.001);
+  }
+
+  cumsum(tmpv, this->t1, HostExecutor{}, 0, SCAN_MODE_EXCLUSIVE);
+
+  ttl = 0;
+  for (index_t i = 0; i < tmpv.Lsize(); i++) {
+    ASSERT_NEAR(tmpv(i), ttl, 0.001);
+    ttl += this->t1(i);
+  }
+
+  // 2D tests along both dimensions
+  tensor_t<TypeParam, 2> tmpv2(this->t2.Shape());
+
+  for (index_t i = 0; i < this->t2.Size(0); i++) {
+    for (index_t j = 0; j < this->t2.Size(1); j++) {
+      this->t2(i, j) = static_cast<TypeParam>((2 * (j % 2) - 1) * j + i);
+    }
+  }
+
+  cumsum(tmpv2, this->t2, HostExecutor{});
+  for (index_t i = 0; i < tmpv2.Size(0); i++) {
+    ttl = 0;
+    for (index_t j = 0; j < tmpv2.Size(1); j++) {
+      ttl += this->t2(i, j);
+      ASSERT_NEAR(tmpv2(i, j), ttl, 0.001) << i << j;
+    }
+  }
+
+  cumsum(tmpv2, this->t2, HostExecutor{}, 0);
+  for (index_t j = 0; j < tmpv2.Size(1); j++) {
+    ttl = 0;
+    for (index_t i = 0; i < tmpv2.Size(0); i++) {
+      ttl += this->t2(i, j);
+      ASSERT_NEAR(tmpv2(i, j), ttl, 0.001) << i << j;
+    }
+  }
+
+  // Any associative operator can be scanned, here a cumulative product down
+  // the columns of a permuted view
+  auto t2t = this->t2.Permute({1, 0});
+  tensor_t<TypeParam, 2> tmpv2t(t2t.Shape());
+  for (index_t i = 0; i < this->t2.Size(0); i++) {
+    for (index_t j = 0; j < this->t2.Size(1); j++) {
+      this->t2(i, j) = static_cast<TypeParam>(1 + (i + j) % 2);
+    }
+  }
+
+  scan(tmpv2t, t2t, reduceOpProd<TypeParam>(), HostExecutor{}, 1);
+  for (index_t i = 0; i < tmpv2t.Size(0); i++) {
+    ttl = 1;
+    for (index_t j = 0; j < tmpv2t.Size(1); j++) {
+      ttl *= t2t(i, j);
+      ASSERT_NEAR(tmpv2t(i, j), ttl, 0.001) << i << j;
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CUBTestsNumericNonComplex, Sort)
 {
   MATX_ENTER_HANDLER();
@@ -216,3 +407,297 @@ TYPED_TEST(CUBTestsNumericNonComplex, Sort)
 
   MATX_EXIT_HANDLER();
 }
+
+// Lines long enough that, with fewer work items than threads, the scanned
+// dimension is split into blocks with carries. Sums of small integers are
+// exact, so every type must match the serial scan and a single thread.
+TYPED_TEST(CUBTestsNumericNonComplex, ScanHostBlocked)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t len = 8 * HOST_SCAN_MIN_BLOCK + 123;
+  constexpr index_t cols = 3;
+  tensor_t<TypeParam, 2> in{{len, cols}};
+  tensor_t<TypeParam, 2> out{{len, cols}};
+  tensor_t<TypeParam, 2> out1{{len, cols}};
+  tensor_t<TypeParam, 1> in1{{len}};
+  tensor_t<TypeParam, 1> out11{{len}};
+
+  for (index_t i = 0; i < len; i++) {
+    for (index_t j = 0; j < cols; j++) {
+      int v = static_cast<int>((i * 7 + j * 3) % 5);
+      if constexpr (std::is_signed_v<TypeParam>) {
+        v -= 2;
+      }
+      in(i, j) = static_cast<TypeParam>(v);
+    }
+    // Climbing with dips, so the running maximum and minimum change late
+    in1(i) = static_cast<TypeParam>((i % 1000) * 3 + i / 1000);
+  }
+
+  const auto check = [&](auto op, auto &ref_in, auto &res, auto &res1,
+                         bool exclusive) {
+    TypeParam acc = op.Init();
+    for (index_t i = 0; i < len; i++) {
+      if (!exclusive) {
+        acc = op.Reduce(acc, ref_in(i));
+      }
+      ASSERT_EQ(res(i), acc);
+      ASSERT_EQ(res1(i), acc);
+      if (exclusive) {
+        acc = op.Reduce(acc, ref_in(i));
+      }
+    }
+  };
+
+  // Contiguous 1D lines
+  for (auto mode : {SCAN_MODE_INCLUSIVE, SCAN_MODE_EXCLUSIVE}) {
+    tensor_t<TypeParam, 1> res{{len}};
+    scan(res, in1, reduceOpMax<TypeParam>(), HostExecutor{4}, 0, mode);
+    scan(out11, in1, reduceOpMax<TypeParam>(), HostExecutor{1}, 0, mode);
+    check(reduceOpMax<TypeParam>(), in1, res, out11,
+          mode == SCAN_MODE_EXCLUSIVE);
+
+    scan(res, in1, reduceOpMin<TypeParam>(), HostExecutor{4}, 0, mode);
+    scan(out11, in1, reduceOpMin<TypeParam>(), HostExecutor{1}, 0, mode);
+    check(reduceOpMin<TypeParam>(), in1, res, out11,
+          mode == SCAN_MODE_EXCLUSIVE);
+  }
+
+  // Strided lines down the columns
+  for (auto mode : {SCAN_MODE_INCLUSIVE, SCAN_MODE_EXCLUSIVE}) {
+    cumsum(out, in, HostExecutor{4}, 0, mode);
+    cumsum(out1, in, HostExecutor{1}, 0, mode);
+    for (index_t j = 0; j < cols; j++) {
+      auto col_in = in.template Slice<1>({0, j}, {matxEnd, matxDropDim});
+      auto col = out.template Slice<1>({0, j}, {matxEnd, matxDropDim});
+      auto col1 = out1.template Slice<1>({0, j}, {matxEnd, matxDropDim});
+      check(reduceOpSum<TypeParam>(), col_in, col, col1,
+            mode == SCAN_MODE_EXCLUSIVE);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// index_t is long long, which is a different type from int64_t on LP64
+// platforms, so max and min scans over indices need their own limits
+TEST(CUBTestsIndex, ScanHostIndexMaxMin)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t len = 100;
+  tensor_t<index_t, 1> in{{len}};
+  tensor_t<index_t, 1> out{{len}};
+  for (index_t i = 0; i < len; i++) {
+    in(i) = (i * 37) % 101 - 50;
+  }
+
+  scan(out, in, reduceOpMax<index_t>(), HostExecutor{}, 0,
+       SCAN_MODE_EXCLUSIVE);
+  index_t acc = reduceOpMax<index_t>().Init();
+  ASSERT_EQ(acc, LLONG_MIN);
+  for (index_t i = 0; i < len; i++) {
+    ASSERT_EQ(out(i), acc);
+    acc = std::max(acc, in(i));
+  }
+
+  scan(out, in, reduceOpMin<index_t>(), HostExecutor{}, 0,
+       SCAN_MODE_EXCLUSIVE);
+  acc = reduceOpMin<index_t>().Init();
+  ASSERT_EQ(acc, LLONG_MAX);
+  for (index_t i = 0; i < len; i++) {
+    ASSERT_EQ(out(i), acc);
+    acc = std::min(acc, in(i));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CUBTestsNumericNonComplex, SortHost)
+{
+  MATX_ENTER_HANDLER();
+
+  for (index_t i = 0; i < this->t1.Lsize(); i++) {
+    this->t1(i) = static_cast<TypeParam>((2 * (i % 2) - 1) * i);
+  }
+
+  tensor_t<TypeParam, 1> tmpv({this->t1.Lsize()});
+  tensor_t<index_t, 1> idxv({this->t1.Lsize()});
+
+  // Ascending
+  sort(tmpv, idxv, this->t1, SORT_DIR_ASC, HostExecutor{});
+
+  for (index_t i = 0; i < tmpv.Lsize(); i++) {
+    ASSERT_EQ(this->t1(idxv(i)), tmpv(i));
+    if (i > 0) {
+      ASSERT_TRUE(tmpv(i) > tmpv(i - 1));
+    }
+  }
+
+  // Descending
+  sort(tmpv, this->t1, SORT_DIR_DESC, HostExecutor{});
+
+  for (index_t i = 1; i < tmpv.Lsize(); i++) {
+    ASSERT_TRUE(tmpv(i) < tmpv(i - 1));
+  }
+
+  // 2D tests. Rows hold repeated values, so the indices also check that the
+  // sort is stable in both directions
+  tensor_t<TypeParam, 2> tmpv2(this->t2.Shape());
+  tensor_t<index_t, 2> idxv2(this->t2.Shape());
+
+  for (index_t i = 0; i < this->t2.Size(0); i++) {
+    for (index_t j = 0; j < this->t2.Size(1); j++) {
+      this->t2(i, j) = static_cast<TypeParam>((2 * (j % 2) - 1) * (j / 3) + i);
+    }
+  }
+
+  for (auto dir : {SORT_DIR_ASC, SORT_DIR_DESC}) {
+    sort(tmpv2, idxv2, this->t2, dir, HostExecutor{});
+
+    for (index_t i = 0; i < tmpv2.Size(0); i++) {
+      for (index_t j = 0; j < tmpv2.Size(1); j++) {
+        ASSERT_EQ(this->t2(i, idxv2(i, j)), tmpv2(i, j));
+        if (j > 0) {
+          const bool ordered = dir == SORT_DIR_ASC
+                                   ? tmpv2(i, j) >= tmpv2(i, j - 1)
+                                   : tmpv2(i, j) <= tmpv2(i, j - 1);
+          ASSERT_TRUE(ordered);
+          if (tmpv2(i, j) == tmpv2(i, j - 1)) {
+            ASSERT_TRUE(idxv2(i, j) > idxv2(i, j - 1));
+          }
+        }
+      }
+    }
+  }
+
+  // argsort and in-place sort agree with the key-value sort
+  tensor_t<index_t, 2> argv2(this->t2.Shape());
+  argsort(argv2, this->t2, SORT_DIR_DESC, HostExecutor{});
+  sort(this->t2, this->t2, SORT_DIR_DESC, HostExecutor{});
+
+  for (index_t i = 0; i < tmpv2.Size(0); i++) {
+    for (index_t j = 0; j < tmpv2.Size(1); j++) {
+      ASSERT_EQ(argv2(i, j), idxv2(i, j));
+      ASSERT_EQ(this->t2(i, j), tmpv2(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Rows long enough for the radix passes. Row 0 is nonnegative, so the high
+// digits of every key match and those passes are skipped; row 1 mixes signs
+// and, for floating point, fractions so the keys are flipped. The last row
+// alone is over 2 * HOST_RADIX_MIN_CHUNK, so it is split across threads, and
+// must match a single-threaded sort exactly.
+TYPED_TEST(CUBTestsNumericNonComplex, SortHostLarge)
+{
+  MATX_ENTER_HANDLER();
+
+  const auto fill = [](auto &t, index_t r, uint64_t seed, bool mixed) {
+    uint64_t x = seed;
+    for (index_t j = 0; j < t.Size(1); j++) {
+      x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+      int64_t v = static_cast<int64_t>((x >> 33) % 20011);
+      if (mixed && std::is_signed_v<TypeParam>) {
+        v -= 10005;
+      }
+      TypeParam tv = static_cast<TypeParam>(v);
+      if constexpr (std::is_floating_point_v<TypeParam>) {
+        tv = static_cast<TypeParam>(v) / 4;
+      }
+      t(r, j) = tv;
+    }
+  };
+
+  const auto check = [](const auto &in, const auto &out, const auto &idx,
+                        SortDirection_t dir) {
+    for (index_t r = 0; r < in.Size(0); r++) {
+      std::vector<index_t> ref(in.Size(1));
+      std::iota(ref.begin(), ref.end(), 0);
+      std::stable_sort(ref.begin(), ref.end(), [&](index_t a, index_t b) {
+        return dir == SORT_DIR_ASC ? in(r, a) < in(r, b) : in(r, a) > in(r, b);
+      });
+      for (index_t j = 0; j < in.Size(1); j++) {
+        ASSERT_EQ(idx(r, j), ref[j]);
+        ASSERT_EQ(out(r, j), in(r, ref[j]));
+      }
+    }
+  };
+
+  constexpr index_t n = 1000;
+  tensor_t<TypeParam, 2> a{{2, n}};
+  tensor_t<TypeParam, 2> out{{2, n}};
+  tensor_t<index_t, 2> idx{{2, n}};
+  fill(a, 0, 1, false);
+  fill(a, 1, 2, true);
+
+  for (auto dir : {SORT_DIR_ASC, SORT_DIR_DESC}) {
+    sort(out, idx, a, dir, HostExecutor{});
+    check(a, out, idx, dir);
+  }
+
+  constexpr index_t nl = 2 * HOST_RADIX_MIN_CHUNK + 4099;
+  tensor_t<TypeParam, 2> al{{1, nl}};
+  tensor_t<TypeParam, 2> outl{{1, nl}};
+  tensor_t<TypeParam, 2> outl1{{1, nl}};
+  tensor_t<index_t, 2> idxl{{1, nl}};
+  tensor_t<index_t, 2> idxl1{{1, nl}};
+  fill(al, 0, 3, true);
+
+  for (auto dir : {SORT_DIR_ASC, SORT_DIR_DESC}) {
+    sort(outl, idxl, al, dir, HostExecutor{4});
+    sort(outl1, idxl1, al, dir, HostExecutor{1});
+    check(al, outl, idxl, dir);
+    for (index_t j = 0; j < nl; j++) {
+      ASSERT_EQ(idxl(0, j), idxl1(0, j));
+      ASSERT_EQ(outl(0, j), outl1(0, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CUBTestsNumericNonComplex, TopKHost)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t k = 4;
+  tensor_t<TypeParam, 2> topv({this->t2.Size(0), k});
+  tensor_t<TypeParam, 2> botv({this->t2.Size(0), k});
+  tensor_t<index_t, 2> topi({this->t2.Size(0), k});
+  tensor_t<index_t, 2> boti({this->t2.Size(0), k});
+
+  // Row i holds i + {0, 9, 1, 8, ...}, with a repeated value at the end
+  for (index_t i = 0; i < this->t2.Size(0); i++) {
+    for (index_t j = 0; j < this->t2.Size(1) - 1; j++) {
+      this->t2(i, j) = static_cast<TypeParam>((j % 2) ? 9 - j / 2 : j / 2) + i;
+    }
+    this->t2(i, this->t2.Size(1) - 1) = static_cast<TypeParam>(9 + i);
+  }
+
+  topk(topv, topi, this->t2, HostExecutor{});
+  bottomk(botv, boti, this->t2, HostExecutor{});
+
+  const std::array<index_t, k> top_idx = {1, 9, 3, 5};
+  const std::array<index_t, k> top_val = {9, 9, 8, 7};
+  const std::array<index_t, k> bot_idx = {0, 2, 4, 6};
+  for (index_t i = 0; i < topv.Size(0); i++) {
+    for (index_t j = 0; j < k; j++) {
+      ASSERT_EQ(topi(i, j), top_idx[j]);
+      ASSERT_EQ(topv(i, j), static_cast<TypeParam>(top_val[j] + i));
+      ASSERT_EQ(boti(i, j), bot_idx[j]);
+      ASSERT_EQ(botv(i, j), static_cast<TypeParam>(j + i));
+    }
+  }
+
+  // Values only
+  topk(botv, this->t2, HostExecutor{});
+  for (index_t i = 0; i < topv.Size(0); i++) {
+    for (index_t j = 0; j < k; j++) {
+      ASSERT_EQ(botv(i, j), topv(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -505,6 +505,138 @@ TEST(ViewTests, Random)
   MATX_EXIT_HANDLER();
 }
 
+TEST(ViewTests, RandomOp)
+{
+  MATX_ENTER_HANDLER();
+  {
+    index_t count = 100;
+    tensor_t<float, 3> t3f({count, count, count});
+    tensor_t<float, 3> t3h({count, count, count});
+
+    // The counter-based operator gives bit-identical uniforms on the device
+    // and the host
+    (t3f = random<float>(t3f.Shape(), UNIFORM, 1234)).run();
+    (t3h = random<float>(t3h.Shape(), UNIFORM, 1234)).run(HostExecutor{2});
+    t3f.PrefetchHost(0);
+    cudaDeviceSynchronize();
+
+    double total = 0;
+    for (index_t i = 0; i < count; i++) {
+      for (index_t j = 0; j < count; j++) {
+        for (index_t k = 0; k < count; k++) {
+          ASSERT_EQ(t3f(i, j, k), t3h(i, j, k));
+          ASSERT_LT(0.0f, t3f(i, j, k));
+          ASSERT_LE(t3f(i, j, k), 1.0f);
+          total += t3f(i, j, k) - 0.5;
+        }
+      }
+    }
+    ASSERT_LT(fabs(total / (count * count * count)), .01);
+
+    (t3f = random<float>(t3f.Shape(), NORMAL, 1234)).run();
+    (t3h = random<float>(t3h.Shape(), NORMAL, 1234)).run(HostExecutor{2});
+    t3f.PrefetchHost(0);
+    cudaDeviceSynchronize();
+
+    total = 0;
+    double sq = 0;
+    for (index_t i = 0; i < count; i++) {
+      for (index_t j = 0; j < count; j++) {
+        for (index_t k = 0; k < count; k++) {
+          ASSERT_NEAR(t3f(i, j, k), t3h(i, j, k), 1e-5);
+          total += t3f(i, j, k);
+          sq += t3f(i, j, k) * t3f(i, j, k);
+        }
+      }
+    }
+    ASSERT_LT(fabs(total / (count * count * count)), .01);
+    ASSERT_LT(fabs(sq / (count * count * count) - 1.0), .01);
+  }
+  MATX_EXIT_HANDLER();
+}
+
+// Known-answer vector from the Random123 distribution for Philox4x32-10 with
+// a zero counter and key. The upper counter words are always zero here, so
+// the other published vectors do not apply.
+TEST(ViewTests, PhiloxKnownAnswer)
+{
+  const matxPhiloxBlock_t r = matxPhilox4x32_10(0, 0);
+  ASSERT_EQ(r.v[0], 0x6627e8d5u);
+  ASSERT_EQ(r.v[1], 0xe169c58du);
+  ASSERT_EQ(r.v[2], 0xbc57ac4cu);
+  ASSERT_EQ(r.v[3], 0x9b00dbd8u);
+}
+
+TEST(ViewTests, RandHost)
+{
+  MATX_ENTER_HANDLER();
+  {
+    // Over 2 * HOST_RANDOM_MIN_TASK values, so several threads each fill
+    // their own range
+    constexpr index_t rows = 300;
+    constexpr index_t cols = 301;
+    static_assert(rows * cols > 2 * HOST_RANDOM_MIN_TASK);
+    tensor_t<double, 2> t2d({rows, cols});
+    tensor_t<double, 2> t2h({rows, cols});
+    tensor_t<double, 2> t2h1({rows, cols});
+    tensor_t<float, 2> t2f({rows, cols});
+    tensor_t<float, 2> t2fh({rows, cols});
+    tensor_t<float, 2> t2fh1({rows, cols});
+
+    // The vectorized host fill gives the operator's values for any number of
+    // threads. Uniform values are bit-identical.
+    for (auto dist : {UNIFORM, NORMAL}) {
+      (t2d = random<double>(t2d.Shape(), dist, 77)).run(HostExecutor{1});
+      rand(t2h, dist, 77, HostExecutor{4});
+      rand(t2h1, dist, 77, HostExecutor{1});
+      (t2f = random<float>(t2f.Shape(), dist, 77)).run(HostExecutor{1});
+      rand(t2fh, dist, 77, HostExecutor{4});
+      rand(t2fh1, dist, 77, HostExecutor{1});
+      for (index_t i = 0; i < rows; i++) {
+        for (index_t j = 0; j < cols; j++) {
+          ASSERT_EQ(t2h(i, j), t2h1(i, j));
+          ASSERT_EQ(t2fh(i, j), t2fh1(i, j));
+          if (dist == UNIFORM) {
+            ASSERT_EQ(t2d(i, j), t2h(i, j));
+            ASSERT_EQ(t2f(i, j), t2fh(i, j));
+          }
+          else {
+            ASSERT_NEAR(t2d(i, j), t2h(i, j), 1e-12);
+            ASSERT_NEAR(t2f(i, j), t2fh(i, j), 1e-5);
+          }
+        }
+      }
+    }
+
+    // The device overload fills the same values
+    rand(t2f, NORMAL, 77);
+    cudaStreamSynchronize(0);
+    for (index_t i = 0; i < rows; i++) {
+      for (index_t j = 0; j < cols; j++) {
+        ASSERT_NEAR(t2f(i, j), t2fh(i, j), 1e-5);
+      }
+    }
+  }
+  {
+    index_t count = 100;
+    tensor_t<cuda::std::complex<float>, 2> t2c({count, count});
+    tensor_t<cuda::std::complex<float>, 2> t2ch({count, count});
+
+    // A transposed view is filled in its own row-major order
+    (t2c = random<cuda::std::complex<float>>(t2c.Shape(), NORMAL, 77))
+        .run(HostExecutor{1});
+    auto t2ct = t2ch.Permute({1, 0});
+    rand(t2ct, NORMAL, 77, HostExecutor{2});
+    for (index_t i = 0; i < count; i++) {
+      for (index_t j = 0; j < count; j++) {
+        ASSERT_NEAR(t2c(i, j).real(), t2ct(i, j).real(), 1e-5);
+        ASSERT_NEAR(t2c(i, j).imag(), t2ct(i, j).imag(), 1e-5);
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
 
 TYPED_TEST(ViewTestsComplex, RealComplexView)
 {
@@ -99,6 +99,18 @@ TYPED_TEST(CorrelationConvolutionTestFloatTypes, Direct1DConvolutionSwap)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(CorrelationConvolutionTestFloatTypes, Direct1DConvolutionHost)
+{
+  MATX_ENTER_HANDLER();
+  this->pb->RunTVGenerator("conv");
+  this->pb->NumpyToTensorView(this->av, "a_op");
+  this->pb->NumpyToTensorView(this->bv, "b_op");
+  conv1d(this->cv, this->av, this->bv, MATX_C_MODE_FULL, HostExecutor{});
+
+  MATX_TEST_ASSERT_COMPARE(this->pb, this->cv, "conv", this->thresh);
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CorrelationConvolutionTestFloatTypes, Direct1DCorrelation)
 {
   MATX_ENTER_HANDLER();
@@ -123,6 +135,498 @@ TYPED_TEST(CorrelationConvolutionTestFloatTypes, Direct1DCorrelationSwap)
   MATX_EXIT_HANDLER();
 }
 
+template <typename TensorType>
+class CorrelationConvolutionTestNonHalfFloatTypes
+    : public CorrelationConvolutionTest<TensorType> {
+};
+
+TYPED_TEST_SUITE(CorrelationConvolutionTestNonHalfFloatTypes,
+                 MatXFloatNonComplexNonHalfTypes);
+
+// Streaming overlap-save convolution across several blocks against a direct
+// reference over the whole signal. Covers both the direct (short filter) and
+// FFT (long filter) paths as well as blocks shorter than the filter.
+TYPED_TEST(CorrelationConvolutionTestNonHalfFloatTypes, StreamingConv1D)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t chans = 3;
+  constexpr index_t nblocks = 5;
+
+  const std::vector<std::pair<index_t, index_t>> cfgs = {
+      {7, 64}, {100, 256}, {100, 32}};
+
+  for (const auto &[flen, blen] : cfgs) {
+    tensor_t<TypeParam, 1> filt({flen});
+    tensor_t<TypeParam, 2> in({chans, blen});
+    tensor_t<TypeParam, 2> out({chans, blen});
+    std::vector<TypeParam> sig(chans * blen * nblocks);
+    std::vector<TypeParam> ref(sig.size(), 0);
+
+    for (index_t k = 0; k < flen; k++) {
+      filt(k) = static_cast<TypeParam>((k % 5) - 2) / static_cast<TypeParam>(flen);
+    }
+    for (size_t n = 0; n < sig.size(); n++) {
+      sig[n] = static_cast<TypeParam>((n * 7) % 11) / static_cast<TypeParam>(11);
+    }
+
+    const index_t total = blen * nblocks;
+    for (index_t c = 0; c < chans; c++) {
+      for (index_t n = 0; n < total; n++) {
+        for (index_t k = 0; k < flen && k <= n; k++) {
+          ref[c * total + n] += filt(k) * sig[c * total + n - k];
+        }
+      }
+    }
+
+    matxStreamingConv1D_t<TypeParam, 2, TypeParam> sconv(filt, blen, chans);
+    for (index_t b = 0; b < nblocks; b++) {
+      for (index_t c = 0; c < chans; c++) {
+        for (index_t n = 0; n < blen; n++) {
+          in(c, n) = sig[c * total + b * blen + n];
+        }
+      }
+
+      sconv.Exec(out, in, 0);
+      cudaStreamSynchronize(0);
+
+      for (index_t c = 0; c < chans; c++) {
+        for (index_t n = 0; n < blen; n++) {
+          ASSERT_NEAR(out(c, n), ref[c * total + b * blen + n], this->thresh);
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+template <typename TensorType>
+class CorrelationConvolutionTestComplexNonHalfTypes
+    : public CorrelationConvolutionTest<TensorType> {
+};
+
+TYPED_TEST_SUITE(CorrelationConvolutionTestComplexNonHalfTypes,
+                 MatXComplexNonHalfTypes);
+
+// Complex streaming convolution with a complex filter on both the direct and
+// FFT paths. The FFT path must keep the imaginary part of the result.
+TYPED_TEST(CorrelationConvolutionTestComplexNonHalfTypes, StreamingConv1D)
+{
+  MATX_ENTER_HANDLER();
+  using scalar_type = typename TypeParam::value_type;
+  constexpr index_t chans = 2;
+  constexpr index_t nblocks = 4;
+
+  const std::vector<std::pair<index_t, index_t>> cfgs = {{7, 64}, {100, 32}};
+
+  for (const auto &[flen, blen] : cfgs) {
+    tensor_t<TypeParam, 1> filt({flen});
+    tensor_t<TypeParam, 2> in({chans, blen});
+    tensor_t<TypeParam, 2> out({chans, blen});
+    std::vector<TypeParam> sig(chans * blen * nblocks);
+    std::vector<TypeParam> ref(sig.size(), TypeParam(0));
+
+    for (index_t k = 0; k < flen; k++) {
+      filt(k) = TypeParam(static_cast<scalar_type>((k % 5) - 2),
+                          static_cast<scalar_type>(k % 3)) /
+                static_cast<scalar_type>(flen);
+    }
+    for (size_t n = 0; n < sig.size(); n++) {
+      sig[n] = TypeParam(static_cast<scalar_type>((n * 7) % 11),
+                         static_cast<scalar_type>((n * 3) % 5) - 2) /
+               static_cast<scalar_type>(11);
+    }
+
+    const index_t total = blen * nblocks;
+    for (index_t c = 0; c < chans; c++) {
+      for (index_t n = 0; n < total; n++) {
+        for (index_t k = 0; k < flen && k <= n; k++) {
+          ref[c * total + n] += filt(k) * sig[c * total + n - k];
+        }
+      }
+    }
+
+    matxStreamingConv1D_t<TypeParam, 2, TypeParam> sconv(filt, blen, chans);
+    ASSERT_EQ(sconv.UsesFFT(), flen > 64);
+    for (index_t b = 0; b < nblocks; b++) {
+      for (index_t c = 0; c < chans; c++) {
+        for (index_t n = 0; n < blen; n++) {
+          in(c, n) = sig[c * total + b * blen + n];
+        }
+      }
+
+      sconv.Exec(out, in, 0);
+      cudaStreamSynchronize(0);
+
+      for (index_t c = 0; c < chans; c++) {
+        for (index_t n = 0; n < blen; n++) {
+          const TypeParam r = ref[c * total + b * blen + n];
+          ASSERT_NEAR(out(c, n).real(), r.real(), this->thresh);
+          ASSERT_NEAR(out(c, n).imag(), r.imag(), this->thresh);
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Complex inputs with real filters take the split-plane host paths. They must
+// match the same filters promoted to complex on the all-complex paths.
+TYPED_TEST(CorrelationConvolutionTestComplexNonHalfTypes, RealFilterHost)
+{
+  MATX_ENTER_HANDLER();
+  using scalar_type = typename TypeParam::value_type;
+  constexpr index_t batches = 2;
+  constexpr index_t ih = 37;
+  constexpr index_t iw = 45;
+  constexpr index_t fh = 5;
+  constexpr index_t fw = 3;
+  HostExecutor exec{};
+
+  tensor_t<TypeParam, 3> in({batches, ih, iw});
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < ih; y++) {
+      for (index_t x = 0; x < iw; x++) {
+        in(b, y, x) =
+            TypeParam(static_cast<scalar_type>((b + 3 * y + 7 * x) % 13),
+                      static_cast<scalar_type>((2 * b + y + 5 * x) % 11) - 5) /
+            static_cast<scalar_type>(13);
+      }
+    }
+  }
+
+  // 1D along each row
+  tensor_t<scalar_type, 1> rf1({fh});
+  tensor_t<TypeParam, 1> cf1({fh});
+  for (index_t k = 0; k < fh; k++) {
+    rf1(k) = static_cast<scalar_type>(k % 3) - static_cast<scalar_type>(0.5);
+    cf1(k) = TypeParam(rf1(k), 0);
+  }
+  tensor_t<TypeParam, 3> split1({batches, ih, iw + fh - 1});
+  tensor_t<TypeParam, 3> full1({batches, ih, iw + fh - 1});
+  conv1d(split1, in, rf1, MATX_C_MODE_FULL, exec);
+  conv1d(full1, in, cf1, MATX_C_MODE_FULL, exec);
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < ih; y++) {
+      for (index_t x = 0; x < full1.Size(2); x++) {
+        ASSERT_NEAR(split1(b, y, x).real(), full1(b, y, x).real(),
+                    this->thresh);
+        ASSERT_NEAR(split1(b, y, x).imag(), full1(b, y, x).imag(),
+                    this->thresh);
+      }
+    }
+  }
+
+  // Dense 2D with a filter that is not separable, then a separable one
+  tensor_t<scalar_type, 2> rf2({fh, fw});
+  tensor_t<TypeParam, 2> cf2({fh, fw});
+  tensor_t<TypeParam, 3> split2({batches, ih + fh - 1, iw + fw - 1});
+  tensor_t<TypeParam, 3> full2({batches, ih + fh - 1, iw + fw - 1});
+  for (bool separable : {false, true}) {
+    for (index_t y = 0; y < fh; y++) {
+      for (index_t x = 0; x < fw; x++) {
+        rf2(y, x) = separable ? static_cast<scalar_type>((y + 1) * (2 - x))
+                              : static_cast<scalar_type>(y - x);
+        rf2(y, x) /= static_cast<scalar_type>(4);
+        cf2(y, x) = TypeParam(rf2(y, x), 0);
+      }
+    }
+    conv2d(split2, in, rf2, MATX_C_MODE_FULL, exec);
+    conv2d(full2, in, cf2, MATX_C_MODE_FULL, exec);
+    for (index_t b = 0; b < batches; b++) {
+      for (index_t y = 0; y < full2.Size(1); y++) {
+        for (index_t x = 0; x < full2.Size(2); x++) {
+          ASSERT_NEAR(split2(b, y, x).real(), full2(b, y, x).real(),
+                      this->thresh);
+          ASSERT_NEAR(split2(b, y, x).imag(), full2(b, y, x).imag(),
+                      this->thresh);
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Host and device 2D convolution must agree on batched inputs
+TYPED_TEST(CorrelationConvolutionTestNonHalfFloatTypes, Direct2DConvolutionHost)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 2;
+  constexpr index_t ih = 37;
+  constexpr index_t iw = 45;
+  constexpr index_t fh = 5;
+  constexpr index_t fw = 3;
+
+  tensor_t<TypeParam, 3> in({batches, ih, iw});
+  tensor_t<TypeParam, 2> filt({fh, fw});
+  tensor_t<TypeParam, 3> dev_out({batches, ih + fh - 1, iw + fw - 1});
+  tensor_t<TypeParam, 3> host_out({batches, ih + fh - 1, iw + fw - 1});
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < ih; y++) {
+      for (index_t x = 0; x < iw; x++) {
+        in(b, y, x) = static_cast<TypeParam>((b + 3 * y + 7 * x) % 13) /
+                      static_cast<TypeParam>(13);
+      }
+    }
+  }
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      filt(y, x) = static_cast<TypeParam>(y - x) / static_cast<TypeParam>(4);
+    }
+  }
+
+  conv2d(dev_out, in, filt, MATX_C_MODE_FULL, 0);
+  conv2d(host_out, in, filt, MATX_C_MODE_FULL, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < dev_out.Size(1); y++) {
+      for (index_t x = 0; x < dev_out.Size(2); x++) {
+        ASSERT_NEAR(host_out(b, y, x), dev_out(b, y, x), this->thresh);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Host SAME and VALID keep the centered and fully overlapped parts of the FULL
+// output. An even filter height checks the even SAME offset.
+TYPED_TEST(CorrelationConvolutionTestNonHalfFloatTypes, Direct2DConvolutionHostModes)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 2;
+  constexpr index_t ih = 37;
+  constexpr index_t iw = 45;
+  constexpr index_t fh = 4;
+  constexpr index_t fw = 3;
+
+  tensor_t<TypeParam, 3> in({batches, ih, iw});
+  tensor_t<TypeParam, 2> filt({fh, fw});
+  tensor_t<TypeParam, 3> full({batches, ih + fh - 1, iw + fw - 1});
+  tensor_t<TypeParam, 3> same({batches, ih, iw});
+  tensor_t<TypeParam, 3> valid({batches, ih - fh + 1, iw - fw + 1});
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < ih; y++) {
+      for (index_t x = 0; x < iw; x++) {
+        in(b, y, x) = static_cast<TypeParam>((b + 3 * y + 7 * x) % 13) /
+                      static_cast<TypeParam>(13);
+      }
+    }
+  }
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      filt(y, x) = static_cast<TypeParam>(y - x) / static_cast<TypeParam>(4);
+    }
+  }
+
+  HostExecutor exec{};
+  conv2d(full, in, filt, MATX_C_MODE_FULL, exec);
+  conv2d(same, in, filt, MATX_C_MODE_SAME, exec);
+  conv2d(valid, in, filt, MATX_C_MODE_VALID, exec);
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < same.Size(1); y++) {
+      for (index_t x = 0; x < same.Size(2); x++) {
+        ASSERT_NEAR(same(b, y, x), full(b, y + fh / 2, x + (fw - 1) / 2),
+                    this->thresh);
+      }
+    }
+    for (index_t y = 0; y < valid.Size(1); y++) {
+      for (index_t x = 0; x < valid.Size(2); x++) {
+        ASSERT_NEAR(valid(b, y, x), full(b, y + fh - 1, x + fw - 1),
+                    this->thresh);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+// Lag-limited correlation on every path must match the FULL output around
+// zero lag
+TYPED_TEST(CorrelationConvolutionTestNonHalfFloatTypes, LagLimitedCorrelation)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t max_lag = 8;
+  constexpr index_t nlags = 2 * max_lag + 1;
+  this->pb->RunTVGenerator("corr");
+  this->pb->NumpyToTensorView(this->av, "a_op");
+  this->pb->NumpyToTensorView(this->bv, "b_op");
+  corr(this->cv, this->av, this->bv, MATX_C_MODE_FULL, MATX_C_METHOD_DIRECT, 0);
+
+  tensor_t<TypeParam, 1> direct({nlags});
+  tensor_t<TypeParam, 1> fftv({nlags});
+  tensor_t<TypeParam, 1> host({nlags});
+  corr(direct, this->av, this->bv, max_lag, MATX_C_METHOD_DIRECT,
+       MATX_C_NORM_NONE, 0);
+  corr(fftv, this->av, this->bv, max_lag, MATX_C_METHOD_FFT, MATX_C_NORM_NONE,
+       0);
+  corr(host, this->av, this->bv, max_lag, MATX_C_NORM_NONE, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  // Zero lag sits at b_len - 1 in the FULL output
+  for (index_t j = 0; j < nlags; j++) {
+    const index_t k = b_len - 1 - max_lag + j;
+    ASSERT_NEAR(direct(j), this->cv(k), this->thresh);
+    ASSERT_NEAR(fftv(j), this->cv(k), this->thresh);
+    ASSERT_NEAR(host(j), this->cv(k), this->thresh);
+  }
+
+  // Normalized autocorrelation peaks at exactly one for zero lag
+  corr(direct, this->av, this->av, max_lag, MATX_C_METHOD_DIRECT,
+       MATX_C_NORM_COEFF, 0);
+  corr(host, this->av, this->av, max_lag, MATX_C_NORM_COEFF, HostExecutor{});
+  cudaStreamSynchronize(0);
+  ASSERT_NEAR(direct(max_lag), static_cast<TypeParam>(1), this->thresh);
+  ASSERT_NEAR(host(max_lag), static_cast<TypeParam>(1), this->thresh);
+
+  MATX_EXIT_HANDLER();
+}
+
+// AUTO picks direct for few lags and FFT for many. Both sides of the
+// crossover must match the host result.
+TYPED_TEST(CorrelationConvolutionTestNonHalfFloatTypes, LagLimitedCorrelationAuto)
+{
+  MATX_ENTER_HANDLER();
+  this->pb->RunTVGenerator("corr");
+  this->pb->NumpyToTensorView(this->av, "a_op");
+  this->pb->NumpyToTensorView(this->bv, "b_op");
+
+  for (index_t max_lag : {8, 60}) {
+    const index_t nlags = 2 * max_lag + 1;
+    index_t nfft = 1;
+    while (nfft < a_len + max_lag) {
+      nfft <<= 1;
+    }
+    ASSERT_EQ(matxCorrLagMethod(max_lag, nfft),
+              max_lag == 8 ? MATX_C_METHOD_DIRECT : MATX_C_METHOD_FFT);
+
+    tensor_t<TypeParam, 1> autov({nlags});
+    tensor_t<TypeParam, 1> host({nlags});
+    corr(autov, this->av, this->bv, max_lag, MATX_C_METHOD_AUTO,
+         MATX_C_NORM_NONE, 0);
+    corr(host, this->av, this->bv, max_lag, MATX_C_NORM_NONE, HostExecutor{});
+    cudaStreamSynchronize(0);
+
+    for (index_t j = 0; j < nlags; j++) {
+      ASSERT_NEAR(autov(j), host(j), this->thresh);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CorrelationConvolutionTestNonHalfFloatTypes, Separable2DConvolution)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 2;
+  constexpr index_t ih = 37;
+  constexpr index_t iw = 45;
+  constexpr index_t fh = 7;
+  constexpr index_t fw = 5;
+
+  tensor_t<TypeParam, 3> in({batches, ih, iw});
+  tensor_t<TypeParam, 1> hcol({fh});
+  tensor_t<TypeParam, 1> hrow({fw});
+  tensor_t<TypeParam, 2> filt({fh, fw});
+  tensor_t<TypeParam, 3> dense_out({batches, ih + fh - 1, iw + fw - 1});
+  tensor_t<TypeParam, 3> sep_out({batches, ih + fh - 1, iw + fw - 1});
+  tensor_t<TypeParam, 3> host_out({batches, ih + fh - 1, iw + fw - 1});
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < ih; y++) {
+      for (index_t x = 0; x < iw; x++) {
+        in(b, y, x) = static_cast<TypeParam>((b + 3 * y + 7 * x) % 13) /
+                      static_cast<TypeParam>(13);
+      }
+    }
+  }
+  for (index_t y = 0; y < fh; y++) {
+    hcol(y) = static_cast<TypeParam>(y + 1) / static_cast<TypeParam>(fh);
+  }
+  for (index_t x = 0; x < fw; x++) {
+    hrow(x) = static_cast<TypeParam>(2 - x) / static_cast<TypeParam>(4);
+  }
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      filt(y, x) = hcol(y) * hrow(x);
+    }
+  }
+
+  // Detection recovers a factorization of the dense filter
+  tensor_t<TypeParam, 1> dcol({fh});
+  tensor_t<TypeParam, 1> drow({fw});
+  ASSERT_TRUE(matxSeparateFilter2D(dcol, drow, filt));
+  for (index_t y = 0; y < fh; y++) {
+    for (index_t x = 0; x < fw; x++) {
+      ASSERT_NEAR(dcol(y) * drow(x), filt(y, x), this->thresh);
+    }
+  }
+
+  conv2d(dense_out, in, filt, MATX_C_MODE_FULL, 0);
+  conv2d(sep_out, in, hcol, hrow, MATX_C_MODE_FULL, 0);
+  // Dense host call takes the separable path after detection
+  conv2d(host_out, in, filt, MATX_C_MODE_FULL, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < dense_out.Size(1); y++) {
+      for (index_t x = 0; x < dense_out.Size(2); x++) {
+        ASSERT_NEAR(sep_out(b, y, x), dense_out(b, y, x), this->thresh);
+        ASSERT_NEAR(host_out(b, y, x), dense_out(b, y, x), this->thresh);
+      }
+    }
+  }
+
+  // The dense device kernel ignores the mode, so SAME and VALID are checked
+  // against the host, on both the device and host separable overloads. Calls
+  // are repeated to reuse the cached device buffers.
+  tensor_t<TypeParam, 3> same_sep({batches, ih, iw});
+  tensor_t<TypeParam, 3> same_host({batches, ih, iw});
+  tensor_t<TypeParam, 3> same_hsep({batches, ih, iw});
+  tensor_t<TypeParam, 3> valid_sep({batches, ih - fh + 1, iw - fw + 1});
+  tensor_t<TypeParam, 3> valid_host({batches, ih - fh + 1, iw - fw + 1});
+  tensor_t<TypeParam, 3> valid_hsep({batches, ih - fh + 1, iw - fw + 1});
+  for (int rep = 0; rep < 2; rep++) {
+    conv2d(same_sep, in, hcol, hrow, MATX_C_MODE_SAME, 0);
+    conv2d(valid_sep, in, hcol, hrow, MATX_C_MODE_VALID, 0);
+  }
+  conv2d(same_host, in, filt, MATX_C_MODE_SAME, HostExecutor{});
+  conv2d(valid_host, in, filt, MATX_C_MODE_VALID, HostExecutor{});
+  conv2d(same_hsep, in, hcol, hrow, MATX_C_MODE_SAME, HostExecutor{});
+  conv2d(valid_hsep, in, hcol, hrow, MATX_C_MODE_VALID, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t y = 0; y < ih; y++) {
+      for (index_t x = 0; x < iw; x++) {
+        ASSERT_NEAR(same_host(b, y, x), host_out(b, y + 3, x + 2),
+                    this->thresh);
+        ASSERT_NEAR(same_sep(b, y, x), same_host(b, y, x), this->thresh);
+        ASSERT_NEAR(same_hsep(b, y, x), same_host(b, y, x), this->thresh);
+      }
+    }
+    for (index_t y = 0; y < ih - fh + 1; y++) {
+      for (index_t x = 0; x < iw - fw + 1; x++) {
+        ASSERT_NEAR(valid_host(b, y, x), host_out(b, y + fh - 1, x + fw - 1),
+                    this->thresh);
+        ASSERT_NEAR(valid_sep(b, y, x), valid_host(b, y, x), this->thresh);
+        ASSERT_NEAR(valid_hsep(b, y, x), valid_host(b, y, x), this->thresh);
+      }
+    }
+  }
+
+  filt(0, 0) = filt(0, 0) + static_cast<TypeParam>(1);
+  ASSERT_FALSE(matxSeparateFilter2D(dcol, drow, filt));
+
+  MATX_EXIT_HANDLER();
+}
+
 // // Complex/complex direct 1D convolution
 // TEST_F(CorrelationConvolutionTest, Direct1DC2CConvolution)
 // {
@@ -80,3 +80,46 @@ TYPED_TEST(CovarianceTestFloatTypes, SmallCov)
   MATX_TEST_ASSERT_COMPARE(this->pb, this->cv, "c_cov", this->thresh);
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(CovarianceTestFloatTypes, BatchedCov)
+{
+  MATX_ENTER_HANDLER();
+  this->pb->RunTVGenerator("cov");
+  this->pb->NumpyToTensorView(this->av, "a");
+
+  this->pb->NumpyToTensorView(this->cv, "c_cov");
+
+  // Batch b holds a / (b + 1) + b, so its covariance is c_cov / (b + 1)^2 and
+  // a kernel that mixes up batches or their means fails
+  const index_t n = this->cov_dim;
+  tensor_t<TypeParam, 3> ab({2, n, n});
+  tensor_t<TypeParam, 3> cb({2, n, n});
+  tensor_t<TypeParam, 3> ch({2, n, n});
+  for (index_t b = 0; b < 2; b++) {
+    const TypeParam scale =
+        static_cast<TypeParam>(1.0f / static_cast<float>(b + 1));
+    const TypeParam shift = static_cast<TypeParam>(static_cast<float>(b));
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ab(b, i, j) = this->av(i, j) * scale + shift;
+      }
+    }
+  }
+
+  cov(cb, ab, 0);
+  cov(ch, ab, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t b = 0; b < 2; b++) {
+    const TypeParam scale =
+        static_cast<TypeParam>(1.0f / static_cast<float>((b + 1) * (b + 1)));
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        const TypeParam ref = this->cv(i, j) * scale;
+        EXPECT_TRUE(MatXUtils::MatXTypeCompare(cb(b, i, j), ref, this->thresh));
+        EXPECT_TRUE(MatXUtils::MatXTypeCompare(ch(b, i, j), ref, this->thresh));
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
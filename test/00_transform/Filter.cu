@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "matx_filter.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+// Direct evaluation of y[n] = sum_k b[k] * x[n-k] + sum_r a[r] * y[n-r-1]
+template <size_t NR, size_t NNR>
+static std::vector<double> FilterRef(const std::vector<double> &x,
+                                     const std::array<double, NR> &a,
+                                     const std::array<double, NNR> &b)
+{
+  std::vector<double> y(x.size());
+  for (size_t n = 0; n < x.size(); n++) {
+    double acc = 0;
+    for (size_t k = 0; k < NNR && k <= n; k++) {
+      acc += b[k] * x[n - k];
+    }
+    for (size_t r = 0; r < NR && r < n; r++) {
+      acc += a[r] * y[n - r - 1];
+    }
+    y[n] = acc;
+  }
+
+  return y;
+}
+
+TEST(FilterTests, RecursiveHost)
+{
+  MATX_ENTER_HANDLER();
+  const std::array<double, 2> rec{1.8, -0.82};
+  const std::array<double, 2> nonrec{0.5, 0.25};
+
+  // A few long signals take the chunked path and many short ones the batched
+  // path. The long signal ends one sample into its last chunk
+  for (auto [rows, len] : {std::pair<index_t, index_t>{2, 9 * 8192 + 1},
+                           std::pair<index_t, index_t>{37, 3000}}) {
+    tensor_t<double, 2> x({rows, len});
+    tensor_t<double, 2> y({rows, len});
+    std::vector<std::vector<double>> xv(rows, std::vector<double>(len));
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t n = 0; n < len; n++) {
+        xv[r][n] = std::sin(0.01 * static_cast<double>(n * (r + 1)));
+        x(r, n) = xv[r][n];
+      }
+    }
+
+    filter(y, x, rec, nonrec, HostExecutor{4});
+    // In place
+    filter(x, x, rec, nonrec, HostExecutor{3});
+
+    for (index_t r = 0; r < rows; r++) {
+      auto ref = FilterRef(xv[r], rec, nonrec);
+      for (index_t n = 0; n < len; n++) {
+        ASSERT_NEAR(y(r, n), ref[n], 1e-8 * (1 + std::abs(ref[n])));
+        ASSERT_NEAR(x(r, n), ref[n], 1e-8 * (1 + std::abs(ref[n])));
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(FilterTests, StreamingHost)
+{
+  MATX_ENTER_HANDLER();
+  const std::array<double, 2> rec{1.8, -0.82};
+  const std::array<double, 3> nonrec{0.5, 0.25, -0.125};
+  const index_t rows = 3;
+  // Blocks shorter than the filter history and blocks long enough to chunk
+  const std::vector<index_t> blocks{1, 700, 2 * 8192 + 5, 2, 3000};
+
+  index_t total = 0;
+  for (auto len : blocks) {
+    total += len;
+  }
+  std::vector<std::vector<double>> xv(rows, std::vector<double>(total));
+  for (index_t r = 0; r < rows; r++) {
+    for (index_t n = 0; n < total; n++) {
+      xv[r][n] = std::cos(0.003 * static_cast<double>(n * (r + 2)));
+    }
+  }
+
+  tensor_t<double, 2> x0({rows, blocks[0]});
+  auto plan = matxMakeFilterHost(x0, x0, rec, nonrec);
+  decltype(plan)::state_t checkpoint;
+  std::vector<std::vector<double>> yv(rows, std::vector<double>(total));
+  index_t off = 0;
+  for (size_t b = 0; b < blocks.size(); b++) {
+    tensor_t<double, 2> x({rows, blocks[b]});
+    tensor_t<double, 2> y({rows, blocks[b]});
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t n = 0; n < blocks[b]; n++) {
+        x(r, n) = xv[r][off + n];
+      }
+    }
+
+    if (b == 2) {
+      checkpoint = plan.GetState();
+    }
+    plan.Exec(y, x, HostExecutor{2});
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t n = 0; n < blocks[b]; n++) {
+        yv[r][off + n] = y(r, n);
+      }
+    }
+
+    // Resuming from the checkpoint repeats the block exactly
+    if (b == 2) {
+      plan.SetState(checkpoint);
+      plan.Exec(x, x, HostExecutor{2});
+      for (index_t r = 0; r < rows; r++) {
+        for (index_t n = 0; n < blocks[b]; n++) {
+          ASSERT_EQ(x(r, n), y(r, n));
+        }
+      }
+    }
+    off += blocks[b];
+  }
+
+  for (index_t r = 0; r < rows; r++) {
+    auto ref = FilterRef(xv[r], rec, nonrec);
+    for (index_t n = 0; n < total; n++) {
+      ASSERT_NEAR(yv[r][n], ref[n], 1e-8 * (1 + std::abs(ref[n])));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -140,4 +140,345 @@ TYPED_TEST(MatMulTestFloatTypes, MediumRect)
   // MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+
+TYPED_TEST(MatMulTestFloatTypes, MediumRectHostMixedPrecision)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 128;
+  constexpr index_t k = 256;
+  constexpr index_t n = 512;
+  using acc_t = promote_matx_half_t<TypeParam>;
+  tensor_t<TypeParam, 2> a{{m, k}};
+  tensor_t<TypeParam, 2> b{{k, n}};
+  tensor_t<TypeParam, 2> c{{m, n}};
+  tensor_t<acc_t, 2> c_acc{{m, n}};
+
+  this->pb->template InitAndRunTVGenerator<TypeParam>(
+      "00_transforms", "matmul_operators", "run", {m, k, n});
+
+  this->pb->NumpyToTensorView(a, "a");
+  this->pb->NumpyToTensorView(b, "b");
+
+  // Half precision inputs are widened on the fly with both half and float
+  // outputs
+  matmul(c, a, b, HostExecutor{});
+  MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
+
+  matmul(c_acc, a, b, HostExecutor{});
+  MATX_TEST_ASSERT_COMPARE(this->pb, c_acc, "c", this->thresh);
+
+  MATX_EXIT_HANDLER();
+}
+
+template <typename TensorType>
+class MatMulTestFloatNonHalfTypes : public MatMulTest<TensorType> {
+};
+
+TYPED_TEST_SUITE(MatMulTestFloatNonHalfTypes, MatXFloatNonHalfTypes);
+
+TYPED_TEST(MatMulTestFloatNonHalfTypes, MediumRectHost)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 128;
+  constexpr index_t k = 256;
+  constexpr index_t n = 512;
+  tensor_t<TypeParam, 2> a{{m, k}};
+  tensor_t<TypeParam, 2> b{{k, n}};
+  tensor_t<TypeParam, 2> c{{m, n}};
+
+  this->pb->template InitAndRunTVGenerator<TypeParam>(
+      "00_transforms", "matmul_operators", "run", {m, k, n});
+
+  this->pb->NumpyToTensorView(a, "a");
+  this->pb->NumpyToTensorView(b, "b");
+
+  matmul(c, a, b, HostExecutor{});
+  MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
+
+  matxMatMulHandle_t<TypeParam, TypeParam, TypeParam, 2, PROVIDER_TYPE_HOST>
+      handle{c, a, b};
+  handle.Exec(c, a, b, HostExecutor{2});
+  MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(MatMulTestFloatNonHalfTypes, BatchedHost)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 5;
+  constexpr index_t m = 37;
+  constexpr index_t k = 300;
+  constexpr index_t n = 41;
+  tensor_t<TypeParam, 3> a{{batches, m, k}};
+  tensor_t<TypeParam, 3> b{{batches, k, n}};
+  tensor_t<TypeParam, 3> c{{batches, m, n}};
+  tensor_t<TypeParam, 3> c_host{{batches, m, n}};
+
+  for (index_t i = 0; i < batches; i++) {
+    for (index_t j = 0; j < m; j++) {
+      for (index_t l = 0; l < k; l++) {
+        a(i, j, l) = static_cast<TypeParam>((i + 3 * j + 5 * l) % 7) /
+                     static_cast<TypeParam>(7);
+      }
+    }
+    for (index_t j = 0; j < k; j++) {
+      for (index_t l = 0; l < n; l++) {
+        b(i, j, l) = static_cast<TypeParam>((2 * i + j + 3 * l) % 5) /
+                     static_cast<TypeParam>(5);
+      }
+    }
+  }
+
+  matmul<TypeParam, TypeParam, TypeParam, 3, PROVIDER_TYPE_CUBLASLT>(c, a, b);
+  matmul(c_host, a, b, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t i = 0; i < batches; i++) {
+    for (index_t j = 0; j < m; j++) {
+      for (index_t l = 0; l < n; l++) {
+        EXPECT_TRUE(MatXUtils::MatXTypeCompare(c_host(i, j, l), c(i, j, l),
+                                               this->thresh));
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(MatMulTestFloatNonHalfTypes, BatchedSmall)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 1000;
+  constexpr index_t n = 6;
+  tensor_t<TypeParam, 3> a{{batches, n, n}};
+  tensor_t<TypeParam, 3> b{{batches, n, n}};
+  tensor_t<TypeParam, 3> c{{batches, n, n}};
+  tensor_t<TypeParam, 3> c_host{{batches, n, n}};
+  tensor_t<TypeParam, 3> a_inv{{batches, n, n}};
+
+  // Diagonally dominant so every matrix is well conditioned
+  for (index_t i = 0; i < batches; i++) {
+    for (index_t j = 0; j < n; j++) {
+      for (index_t l = 0; l < n; l++) {
+        a(i, j, l) = static_cast<TypeParam>((i + 3 * j + 5 * l) % 7) /
+                         static_cast<TypeParam>(7) +
+                     (j == l ? static_cast<TypeParam>(n) : TypeParam(0));
+        b(i, j, l) = static_cast<TypeParam>((2 * i + j + 3 * l) % 5) /
+                     static_cast<TypeParam>(5);
+      }
+    }
+  }
+
+  matmul(c, a, b);
+  matmul(c_host, a, b, HostExecutor{});
+  inv_small<n>(a_inv, a, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t i = 0; i < batches; i++) {
+    for (index_t j = 0; j < n; j++) {
+      for (index_t l = 0; l < n; l++) {
+        TypeParam ref = 0;
+        TypeParam eye = 0;
+        for (index_t p = 0; p < n; p++) {
+          ref += a(i, j, p) * b(i, p, l);
+          eye += a(i, j, p) * a_inv(i, p, l);
+        }
+        EXPECT_TRUE(MatXUtils::MatXTypeCompare(c(i, j, l), ref, this->thresh));
+        EXPECT_TRUE(
+            MatXUtils::MatXTypeCompare(c_host(i, j, l), ref, this->thresh));
+        EXPECT_TRUE(MatXUtils::MatXTypeCompare(
+            eye, j == l ? TypeParam(1) : TypeParam(0), this->thresh));
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(MatMulTestFloatNonHalfTypes, InverseHost)
+{
+  MATX_ENTER_HANDLER();
+  // Every dispatched small size through the closed-form and Gauss-Jordan
+  // inverses, then the blocked LU path and, with a * a^H Hermitian positive
+  // definite for real and complex types, the Cholesky path
+  for (index_t n : {2, 3, 4, 5, 6, 7, 8, 100}) {
+    constexpr index_t batches = 3;
+    tensor_t<TypeParam, 3> a{{batches, n, n}};
+    tensor_t<TypeParam, 3> spd{{batches, n, n}};
+    tensor_t<TypeParam, 3> a_inv{{batches, n, n}};
+    for (index_t i = 0; i < batches; i++) {
+      for (index_t j = 0; j < n; j++) {
+        for (index_t l = 0; l < n; l++) {
+          a(i, j, l) = static_cast<TypeParam>((i + 3 * j + 5 * l) % 7) /
+                           static_cast<TypeParam>(7) +
+                       (j == l ? static_cast<TypeParam>(n) : TypeParam(0));
+          if constexpr (is_complex_v<TypeParam>) {
+            using vtype = typename TypeParam::value_type;
+            a(i, j, l) +=
+                TypeParam{0, static_cast<vtype>((2 * i + j + l) % 5) / 5};
+          }
+        }
+      }
+    }
+    matmul(spd, a, conj(a.Permute({0, 2, 1})), HostExecutor{});
+
+    for (auto *in : {&a, &spd}) {
+      inv(a_inv, *in, HostExecutor{});
+      for (index_t i = 0; i < batches; i++) {
+        for (index_t j = 0; j < n; j++) {
+          for (index_t l = 0; l < n; l++) {
+            TypeParam eye = 0;
+            for (index_t p = 0; p < n; p++) {
+              eye += (*in)(i, j, p) * a_inv(i, p, l);
+            }
+            EXPECT_TRUE(MatXUtils::MatXTypeCompare(
+                eye, j == l ? TypeParam(1) : TypeParam(0), this->thresh));
+          }
+        }
+      }
+    }
+
+    // A zero row in one batch makes the whole call fail
+    for (index_t l = 0; l < n; l++) {
+      a(1, n - 1, l) = TypeParam(0);
+    }
+    EXPECT_THROW(inv(a_inv, a, HostExecutor{}), matxException);
+  }
+
+  // A single matrix up to 4 x 4 takes the closed-form path as a batch of one
+  tensor_t<TypeParam, 2> s{{3, 3}};
+  tensor_t<TypeParam, 2> s_inv{{3, 3}};
+  for (index_t j = 0; j < 3; j++) {
+    for (index_t l = 0; l < 3; l++) {
+      s(j, l) = static_cast<TypeParam>((j + 2 * l) % 3 + (j == l ? 3 : 0));
+    }
+  }
+  inv(s_inv, s, HostExecutor{});
+  for (index_t j = 0; j < 3; j++) {
+    for (index_t l = 0; l < 3; l++) {
+      TypeParam eye = 0;
+      for (index_t p = 0; p < 3; p++) {
+        eye += s(j, p) * s_inv(p, l);
+      }
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(
+          eye, j == l ? TypeParam(1) : TypeParam(0), this->thresh));
+    }
+  }
+  for (index_t l = 0; l < 3; l++) {
+    s(2, l) = s(0, l);
+  }
+  EXPECT_THROW(inv(s_inv, s, HostExecutor{}), matxException);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(MatMulTestFloatNonHalfTypes, Epilogue)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 3;
+  constexpr index_t m = 37;
+  constexpr index_t k = 300;
+  constexpr index_t n = 41;
+  tensor_t<TypeParam, 3> a{{batches, m, k}};
+  tensor_t<TypeParam, 3> b{{batches, k, n}};
+  tensor_t<TypeParam, 3> c{{batches, m, n}};
+  tensor_t<TypeParam, 3> c_host{{batches, m, n}};
+  tensor_t<TypeParam, 3> c_ref{{batches, m, n}};
+  tensor_t<TypeParam, 2> bias{{m, n}};
+  const TypeParam load = static_cast<TypeParam>(0.25);
+
+  for (index_t i = 0; i < batches; i++) {
+    for (index_t j = 0; j < m; j++) {
+      for (index_t l = 0; l < k; l++) {
+        a(i, j, l) = static_cast<TypeParam>((i + 3 * j + 5 * l) % 7) /
+                     static_cast<TypeParam>(7);
+      }
+    }
+    for (index_t j = 0; j < k; j++) {
+      for (index_t l = 0; l < n; l++) {
+        b(i, j, l) = static_cast<TypeParam>((2 * i + j + 3 * l) % 5) /
+                     static_cast<TypeParam>(5);
+      }
+    }
+  }
+  for (index_t j = 0; j < m; j++) {
+    for (index_t l = 0; l < n; l++) {
+      bias(j, l) = static_cast<TypeParam>((j + l) % 3);
+    }
+  }
+
+  auto epi = bias + eye<TypeParam>({m, n}) * load;
+  matmul(c_ref, a, b, HostExecutor{}, 0.5f);
+  matmul(c, a, b, epi, 0, 0.5f);
+  matmul(c_host, a, b, epi, HostExecutor{}, 0.5f);
+  cudaStreamSynchronize(0);
+
+  for (index_t i = 0; i < batches; i++) {
+    for (index_t j = 0; j < m; j++) {
+      for (index_t l = 0; l < n; l++) {
+        const TypeParam ref =
+            c_ref(i, j, l) + bias(j, l) + (j == l ? load : TypeParam(0));
+        EXPECT_TRUE(MatXUtils::MatXTypeCompare(c(i, j, l), ref, this->thresh));
+        EXPECT_TRUE(
+            MatXUtils::MatXTypeCompare(c_host(i, j, l), ref, this->thresh));
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(MatMulTestFloatNonHalfTypes, HermitianOperands)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 37;
+  constexpr index_t k = 45;
+  constexpr index_t n = 29;
+  tensor_t<TypeParam, 2> x{{k, m}};
+  tensor_t<TypeParam, 2> xh{{m, k}};
+  tensor_t<TypeParam, 2> b{{k, n}};
+  tensor_t<TypeParam, 2> c{{m, n}};
+  tensor_t<TypeParam, 2> c_host{{m, n}};
+  tensor_t<TypeParam, 2> c_conj{{m, n}};
+  tensor_t<TypeParam, 2> c_ref{{m, n}};
+  tensor_t<TypeParam, 2> c_conj_ref{{m, n}};
+
+  for (index_t i = 0; i < k; i++) {
+    for (index_t j = 0; j < m; j++) {
+      x(i, j) = static_cast<TypeParam>((i + 3 * j) % 7) /
+                static_cast<TypeParam>(7);
+    }
+    for (index_t j = 0; j < n; j++) {
+      b(i, j) = static_cast<TypeParam>((2 * i + j) % 5) /
+                static_cast<TypeParam>(5);
+    }
+  }
+
+  // Reference through a materialized Hermitian transpose
+  (xh = hermitianT(x)).run();
+  cudaStreamSynchronize(0);
+  matmul(c_ref, xh, b, HostExecutor{});
+  (xh = conj(xh)).run();
+  cudaStreamSynchronize(0);
+  matmul(c_conj_ref, xh, b, HostExecutor{});
+
+  matmul(c, hermitianT(x), b);
+  matmul(c_host, hermitianT(x), b, HostExecutor{});
+  matmul(c_conj, conj(x.Permute({1, 0})), b, HostExecutor{});
+  cudaStreamSynchronize(0);
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      EXPECT_TRUE(
+          MatXUtils::MatXTypeCompare(c(i, j), c_ref(i, j), this->thresh));
+      EXPECT_TRUE(
+          MatXUtils::MatXTypeCompare(c_host(i, j), c_ref(i, j), this->thresh));
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(c_conj(i, j), c_conj_ref(i, j),
+                                             this->thresh));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
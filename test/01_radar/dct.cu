@@ -70,3 +70,78 @@ TEST_F(DctTests, Real1DN100)
 
   MATX_EXIT_HANDLER();
 }
+
+/* Real 1D DCT with N=100 on the host */
+TEST_F(DctTests, Real1DN100Host)
+{
+  MATX_ENTER_HANDLER();
+
+  tensor_t<float, 1> out{{sig_size}};
+  signal::dct(out, xv, HostExecutor{2});
+  MATX_TEST_ASSERT_COMPARE(pb, out, "Y", 0.01);
+
+  MATX_EXIT_HANDLER();
+}
+
+/* Batched host DCT-II, III and IV against the direct sums, for even and odd
+ * lengths including the N=100 of the device tests. The in-place transform
+ * must match the out-of-place one exactly. */
+TEST(DctHostTests, BatchedTypes)
+{
+  MATX_ENTER_HANDLER();
+
+  for (index_t n : {64, 75, 100}) {
+    tensor_t<double, 3> in{{2, 3, n}};
+    tensor_t<double, 3> out{{2, 3, n}};
+    tensor_t<double, 3> io{{2, 3, n}};
+    for (index_t b = 0; b < 2; b++) {
+      for (index_t r = 0; r < 3; r++) {
+        for (index_t i = 0; i < n; i++) {
+          in(b, r, i) = cos(0.37 * static_cast<double>(i * (b + 1) + r)) +
+                        0.25 * static_cast<double>(r);
+        }
+      }
+    }
+
+    for (auto type : {signal::DCT_TYPE_II, signal::DCT_TYPE_III,
+                      signal::DCT_TYPE_IV}) {
+      signal::dct(out, in, HostExecutor{3}, type);
+      for (index_t b = 0; b < 2; b++) {
+        for (index_t r = 0; r < 3; r++) {
+          for (index_t k = 0; k < n; k++) {
+            double ref = 0;
+            for (index_t i = 0; i < n; i++) {
+              const double x = in(b, r, i);
+              const double di = static_cast<double>(i);
+              const double dk = static_cast<double>(k);
+              if (type == signal::DCT_TYPE_II) {
+                ref += 2 * x * cos(M_PI * dk * (2 * di + 1) / (2.0 * n));
+              }
+              else if (type == signal::DCT_TYPE_III) {
+                ref += (i == 0 ? 1 : 2) * x *
+                       cos(M_PI * di * (2 * dk + 1) / (2.0 * n));
+              }
+              else {
+                ref += 2 * x *
+                       cos(M_PI * (2 * di + 1) * (2 * dk + 1) / (4.0 * n));
+              }
+            }
+            ASSERT_NEAR(out(b, r, k), ref, 1e-9);
+          }
+        }
+      }
+
+      (io = in).run(HostExecutor{});
+      signal::dct(io, io, HostExecutor{3}, type);
+      for (index_t b = 0; b < 2; b++) {
+        for (index_t r = 0; r < 3; r++) {
+          for (index_t k = 0; k < n; k++) {
+            ASSERT_EQ(io(b, r, k), out(b, r, k));
+          }
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -87,6 +87,9 @@ typedef Types<matx::matxFp16, matx::matxBf16, float, double,
 typedef Types<matx::matxFp16, matx::matxBf16, float, double>
     MatXFloatNonComplexTypes;
 typedef Types<matx::matxFp16, matx::matxBf16> MatXFloatHalfTypes;
+typedef Types<float, double, cuda::std::complex<float>,
+              cuda::std::complex<double>>
+    MatXFloatNonHalfTypes;
 typedef Types<matx::matxFp16, matx::matxBf16, uint32_t, int32_t, uint64_t,
               int64_t, float, double, cuda::std::complex<float>,
               cuda::std::complex<double>, matx::matxFp16Complex,